@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../set.h"
+#include "../student.h"
+#include "../semester.h"
+#include "../id_vector.h"
+#include "../typed_containers.h"
+
+/**
+ * Compares the callback based set.h against the type-specialized containers of id_vector.h and typed_containers.h,
+ * on the operations the course manager does with students' ids and semesters.
+ */
+
+#define IDS_COUNT 5000
+#define IDS_LOOKUPS 20000
+#define SEMESTERS_COUNT 16
+#define SEMESTER_LOOKUPS 2000000
+
+static double secondsSince(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void printResult(const char* name, double callback_seconds, double typed_seconds) {
+    printf("%-28s set.h: %8.4fs   typed: %8.4fs   speedup: %7.1fx\n", name, callback_seconds, typed_seconds,
+           typed_seconds > 0 ? callback_seconds / typed_seconds : 0.0);
+}
+
+static int benchmarkIds() {
+    int checksum = 0;
+    clock_t start = clock();
+    Set set = setCreate(copyInt, destroyInt, compareInt);
+    for (int i = 0; i < IDS_COUNT; i++) {
+        int id = (i * 7919) % 1000000000;
+        setAdd(set, &id);
+    }
+    for (int i = 0; i < IDS_LOOKUPS; i++) {
+        int id = (i * 7919) % 1000000000;
+        checksum += setIsIn(set, &id);
+    }
+    setDestroy(set);
+    double callback_seconds = secondsSince(start);
+
+    start = clock();
+    IdVector vector;
+    idVectorInit(&vector);
+    for (int i = 0; i < IDS_COUNT; i++) {
+        idVectorInsert(&vector, (i * 7919) % 1000000000);
+    }
+    for (int i = 0; i < IDS_LOOKUPS; i++) {
+        checksum += (idVectorFind(&vector, (i * 7919) % 1000000000) != NULL);
+    }
+    idVectorDestroy(&vector);
+    printResult("ids (add + lookup)", callback_seconds, secondsSince(start));
+    return checksum;
+}
+
+static int benchmarkSemesters() {
+    int checksum = 0;
+    Set set = setCreate(semesterCopy, semesterDestroy, semesterCompare);
+    SemesterVector vector;
+    semesterVectorInit(&vector);
+    for (int i = 1; i <= SEMESTERS_COUNT; i++) {
+        Semester semester = NULL;
+        semesterCreate(i, &semester);
+        setAdd(set, semester);
+        SemesterEntry entry = {i, semester};
+        semesterVectorInsert(&vector, entry);
+    }
+
+    clock_t start = clock();
+    for (int i = 0; i < SEMESTER_LOOKUPS; i++) {
+        checksum += (getSemesterFromSet(set, i % SEMESTERS_COUNT + 1) != NULL);
+    }
+    double callback_seconds = secondsSince(start);
+
+    start = clock();
+    for (int i = 0; i < SEMESTER_LOOKUPS; i++) {
+        checksum += (semesterVectorFind(&vector, i % SEMESTERS_COUNT + 1) != NULL);
+    }
+    printResult("semesters (find by number)", callback_seconds, secondsSince(start));
+
+    for (int i = 0; i < semesterVectorSize(&vector); i++) {
+        semesterDestroy(semesterVectorAt(&vector, i)->semester);
+    }
+    semesterVectorDestroy(&vector);
+    setDestroy(set);
+    return checksum;
+}
+
+int main() {
+    int checksum = benchmarkIds() + benchmarkSemesters();
+    printf("checksum: %d\n", checksum);
+    return 0;
+}
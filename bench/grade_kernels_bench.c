@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../grade_kernels.h"
+
+/**
+ * Measures the throughput of every version of the reductions of grade_kernels.h (scalar, SSE2 and AVX2) over a sheet
+ * of a million grades, like the points and grade columns of a GradeColumns mirror.
+ */
+
+#define GRADES_COUNT 1000000
+#define PASSES 200
+
+static const char* level_names[] = {"scalar", "sse2", "avx2"};
+
+static double secondsSince(clock_t start) {
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void printResult(const char* name, GradeKernelsLevel level, double seconds, long long checksum) {
+    double grades_per_second = (seconds > 0) ? (double)GRADES_COUNT * PASSES / seconds : 0.0;
+    printf("%-20s %-7s %8.4fs   %9.1f M grades/s   checksum: %lld\n", name, level_names[level], seconds,
+           grades_per_second / 1e6, checksum);
+}
+
+int main() {
+    int* points_x2 = malloc(sizeof(int) * GRADES_COUNT);
+    int* grades = malloc(sizeof(int) * GRADES_COUNT);
+    if (points_x2 == NULL || grades == NULL) {
+        free(points_x2);
+        free(grades);
+        return 1;
+    }
+    unsigned int seed = 12345;
+    for (int i = 0; i < GRADES_COUNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        points_x2[i] = (int)((seed >> 8) % 21);
+        grades[i] = (int)((seed >> 16) % 101);
+    }
+    for (GradeKernelsLevel level = GRADE_KERNELS_SCALAR; level <= GRADE_KERNELS_AVX2; level++) {
+        if (gradeKernelsSetLevel(level) != level) {
+            printf("%s is not supported by this CPU\n", level_names[level]);
+            continue;
+        }
+        long long checksum = 0;
+        clock_t start = clock();
+        for (int pass = 0; pass < PASSES; pass++) {
+            checksum += gradeKernelsSumPointsX2(points_x2, GRADES_COUNT);
+        }
+        printResult("points", level, secondsSince(start), checksum);
+        checksum = 0;
+        start = clock();
+        for (int pass = 0; pass < PASSES; pass++) {
+            checksum += gradeKernelsSumFailedPointsX2(points_x2, grades, GRADES_COUNT);
+        }
+        printResult("failed points", level, secondsSince(start), checksum);
+        checksum = 0;
+        start = clock();
+        for (int pass = 0; pass < PASSES; pass++) {
+            checksum += gradeKernelsSumGradePointsX2(points_x2, grades, GRADES_COUNT);
+        }
+        printResult("grade points", level, secondsSince(start), checksum);
+    }
+    free(points_x2);
+    free(grades);
+    return 0;
+}
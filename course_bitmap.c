@@ -0,0 +1,355 @@
+#include "course_bitmap.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_COURSE_ID 999999
+#define CHUNKS_COUNT ((MAX_COURSE_ID >> 16) + 1)
+#define CHUNK_BITS 65536
+#define BITMAP_WORDS (CHUNK_BITS / 64)
+#define ARRAY_CONTAINER_MAX_SIZE 4096 // above this size a bitmap container is smaller than an array container
+#define ARRAY_CONTAINER_INITIAL_CAPACITY 4
+
+/** the ids of a single chunk. exactly one of values/bits is allocated */
+typedef struct container_t {
+    int size;
+    int capacity; // the capacity of values
+    uint16_t* values; // sorted ascending. used while size <= ARRAY_CONTAINER_MAX_SIZE
+    uint64_t* bits; // BITMAP_WORDS words. used when size > ARRAY_CONTAINER_MAX_SIZE
+} container_t;
+
+typedef struct course_bitmap_t {
+    container_t* chunks[CHUNKS_COUNT]; // NULL for an empty chunk
+    int size;
+} course_bitmap_t;
+
+/**
+ * lowestBitIndex - returns the index of the lowest set bit of the given (non zero) word
+ */
+static int lowestBitIndex(uint64_t word) {
+#ifdef __GNUC__
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while ((word & 1) == 0) {
+        word >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * arrayLowerBound - returns the index of the first value in the array container that is not smaller than value
+ */
+static int arrayLowerBound(const container_t* container, uint16_t value) {
+    int low = 0, high = container->size;
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (container->values[middle] < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * containerContains - checks if the given low 16 bits of an id are in the container
+ */
+static bool containerContains(const container_t* container, uint16_t value) {
+    if (container->bits != NULL) {
+        return (container->bits[value / 64] >> (value % 64)) & 1;
+    }
+    int index = arrayLowerBound(container, value);
+    return (index < container->size && container->values[index] == value);
+}
+
+/**
+ * containerToBitmap - converts an array container to a bitmap container
+ * @return false if there was a memory error (the container is not changed), true otherwise
+ */
+static bool containerToBitmap(container_t* container) {
+    uint64_t* bits = (uint64_t*) calloc(BITMAP_WORDS, sizeof(*bits));
+    if (bits == NULL) return false;
+    for (int i = 0; i < container->size; i++) {
+        bits[container->values[i] / 64] |= (uint64_t)1 << (container->values[i] % 64);
+    }
+    free(container->values);
+    container->values = NULL;
+    container->capacity = 0;
+    container->bits = bits;
+    return true;
+}
+
+/**
+ * containerToArray - converts a bitmap container to an array container
+ * @return false if there was a memory error (the container is not changed), true otherwise
+ */
+static bool containerToArray(container_t* container) {
+    uint16_t* values = (uint16_t*) malloc(sizeof(*values) * ARRAY_CONTAINER_MAX_SIZE);
+    if (values == NULL) return false;
+    int size = 0;
+    for (int word = 0; word < BITMAP_WORDS; word++) {
+        for (uint64_t bits = container->bits[word]; bits != 0; bits &= bits - 1) {
+            values[size++] = (uint16_t)(word * 64 + lowestBitIndex(bits));
+        }
+    }
+    free(container->bits);
+    container->bits = NULL;
+    container->values = values;
+    container->capacity = ARRAY_CONTAINER_MAX_SIZE;
+    return true;
+}
+
+/**
+ * containerAdd - adds the given low 16 bits of an id to the container
+ * @return
+ * COURSE_BITMAP_OUT_OF_MEMORY - if there was a memory error
+ * COURSE_BITMAP_ITEM_ALREADY_EXISTS - if the value is already in the container
+ * COURSE_BITMAP_OK - otherwise
+ */
+static CourseBitmapResult containerAdd(container_t* container, uint16_t value) {
+    if (containerContains(container, value)) return COURSE_BITMAP_ITEM_ALREADY_EXISTS;
+    if (container->bits == NULL && container->size == ARRAY_CONTAINER_MAX_SIZE) {
+        if (containerToBitmap(container) == false) return COURSE_BITMAP_OUT_OF_MEMORY;
+    }
+    if (container->bits != NULL) {
+        container->bits[value / 64] |= (uint64_t)1 << (value % 64);
+        container->size++;
+        return COURSE_BITMAP_OK;
+    }
+    if (container->size == container->capacity) {
+        int new_capacity = (container->capacity == 0) ? ARRAY_CONTAINER_INITIAL_CAPACITY : container->capacity * 2;
+        uint16_t* new_values = (uint16_t*) realloc(container->values, sizeof(*new_values) * new_capacity);
+        if (new_values == NULL) return COURSE_BITMAP_OUT_OF_MEMORY;
+        container->values = new_values;
+        container->capacity = new_capacity;
+    }
+    int index = arrayLowerBound(container, value);
+    memmove(container->values + index + 1, container->values + index,
+            sizeof(*container->values) * (container->size - index));
+    container->values[index] = value;
+    container->size++;
+    return COURSE_BITMAP_OK;
+}
+
+/**
+ * containerRemove - removes the given low 16 bits of an id, that must be in the container, from the container
+ */
+static void containerRemove(container_t* container, uint16_t value) {
+    if (container->bits != NULL) {
+        container->bits[value / 64] &= ~((uint64_t)1 << (value % 64));
+        container->size--;
+        // if converting fails the container just stays a bitmap
+        if (container->size <= ARRAY_CONTAINER_MAX_SIZE / 2) {
+            containerToArray(container);
+        }
+        return;
+    }
+    int index = arrayLowerBound(container, value);
+    memmove(container->values + index, container->values + index + 1,
+            sizeof(*container->values) * (container->size - index - 1));
+    container->size--;
+}
+
+/**
+ * containerNext - returns the smallest value in the container that is not smaller than the given one, or -1
+ */
+static int containerNext(const container_t* container, int value) {
+    if (container->bits == NULL) {
+        int index = arrayLowerBound(container, (uint16_t)value);
+        return (index < container->size) ? container->values[index] : -1;
+    }
+    int word = value / 64;
+    uint64_t bits = container->bits[word] & (~(uint64_t)0 << (value % 64));
+    while (bits == 0) {
+        word++;
+        if (word == BITMAP_WORDS) return -1;
+        bits = container->bits[word];
+    }
+    return word * 64 + lowestBitIndex(bits);
+}
+
+/**
+ * containerDestroy - deallocate all the memory of the container. if container is NULL nothing will be done
+ */
+static void containerDestroy(container_t* container) {
+    if (container == NULL) return;
+    free(container->values);
+    free(container->bits);
+    free(container);
+}
+
+/**
+ * containerCopy - creates a copy of the given container
+ * @return NULL if a memory allocation failed, the copy otherwise
+ */
+static container_t* containerCopy(const container_t* container) {
+    container_t* new_container = (container_t*) calloc(1, sizeof(*new_container));
+    if (new_container == NULL) return NULL;
+    new_container->size = container->size;
+    if (container->bits != NULL) {
+        new_container->bits = (uint64_t*) malloc(sizeof(*new_container->bits) * BITMAP_WORDS);
+        if (new_container->bits == NULL) {
+            free(new_container);
+            return NULL;
+        }
+        memcpy(new_container->bits, container->bits, sizeof(*new_container->bits) * BITMAP_WORDS);
+        return new_container;
+    }
+    new_container->values = (uint16_t*) malloc(sizeof(*new_container->values) * container->size);
+    if (new_container->values == NULL) {
+        free(new_container);
+        return NULL;
+    }
+    memcpy(new_container->values, container->values, sizeof(*new_container->values) * container->size);
+    new_container->capacity = container->size;
+    return new_container;
+}
+
+/**
+ * courseBitmapCreate - creates a new empty bitmap. no memory is allocated for the containers until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseBitmap in case of success.
+ */
+CourseBitmap courseBitmapCreate() {
+    CourseBitmap bitmap = (CourseBitmap) malloc(sizeof(*bitmap));
+    if (bitmap == NULL) return NULL;
+    for (int i = 0; i < CHUNKS_COUNT; i++) {
+        bitmap->chunks[i] = NULL;
+    }
+    bitmap->size = 0;
+    return bitmap;
+}
+
+/**
+ * courseBitmapCopy - creates a copy of the given bitmap
+ * @param bitmap - the bitmap to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A CourseBitmap with the same courses as the given bitmap otherwise.
+ */
+CourseBitmap courseBitmapCopy(CourseBitmap bitmap) {
+    if (bitmap == NULL) return NULL;
+    CourseBitmap new_bitmap = courseBitmapCreate();
+    if (new_bitmap == NULL) return NULL;
+    for (int i = 0; i < CHUNKS_COUNT; i++) {
+        if (bitmap->chunks[i] == NULL) continue;
+        new_bitmap->chunks[i] = containerCopy(bitmap->chunks[i]);
+        if (new_bitmap->chunks[i] == NULL) {
+            courseBitmapDestroy(new_bitmap);
+            return NULL;
+        }
+    }
+    new_bitmap->size = bitmap->size;
+    return new_bitmap;
+}
+
+/**
+ * courseBitmapGetSize - returns the number of courses in the bitmap
+ * @param bitmap - the bitmap to get its size
+ * @return the number of courses in the bitmap. -1 if the bitmap is NULL
+ */
+int courseBitmapGetSize(CourseBitmap bitmap) {
+    if (bitmap == NULL) return -1;
+    return bitmap->size;
+}
+
+/**
+ * courseBitmapContains - checks if the given course is in the bitmap
+ * @param bitmap - the bitmap to search in
+ * @param course_id - the id of the course to search
+ * @return true if the course is in the bitmap, false otherwise (or if the bitmap is NULL)
+ */
+bool courseBitmapContains(CourseBitmap bitmap, int course_id) {
+    if (bitmap == NULL || course_id <= 0 || course_id > MAX_COURSE_ID) return false;
+    container_t* container = bitmap->chunks[course_id >> 16];
+    return (container != NULL && containerContains(container, (uint16_t)(course_id & 0xFFFF)));
+}
+
+/**
+ * courseBitmapAdd - adds the given course to the bitmap
+ * @param bitmap - the bitmap to add the course to
+ * @param course_id - the id of the course to add (must be positive number lower than 1000000)
+ * @return
+ * COURSE_BITMAP_NULL_ARGUMENT - if the bitmap is NULL
+ * COURSE_BITMAP_INVALID_PARAMETER - if the course id is not valid
+ * COURSE_BITMAP_OUT_OF_MEMORY - if there was a memory error
+ * COURSE_BITMAP_ITEM_ALREADY_EXISTS - if the course is already in the bitmap
+ * COURSE_BITMAP_OK - otherwise
+ */
+CourseBitmapResult courseBitmapAdd(CourseBitmap bitmap, int course_id) {
+    if (bitmap == NULL) return COURSE_BITMAP_NULL_ARGUMENT;
+    if (course_id <= 0 || course_id > MAX_COURSE_ID) return COURSE_BITMAP_INVALID_PARAMETER;
+    container_t** container = &bitmap->chunks[course_id >> 16];
+    bool created = false;
+    if (*container == NULL) {
+        *container = (container_t*) calloc(1, sizeof(**container));
+        if (*container == NULL) return COURSE_BITMAP_OUT_OF_MEMORY;
+        created = true;
+    }
+    CourseBitmapResult result = containerAdd(*container, (uint16_t)(course_id & 0xFFFF));
+    if (result == COURSE_BITMAP_OK) {
+        bitmap->size++;
+    } else if (created) {
+        containerDestroy(*container);
+        *container = NULL;
+    }
+    return result;
+}
+
+/**
+ * courseBitmapRemove - removes the given course from the bitmap
+ * @param bitmap - the bitmap to remove the course from
+ * @param course_id - the id of the course to remove
+ * @return
+ * COURSE_BITMAP_NULL_ARGUMENT - if the bitmap is NULL
+ * COURSE_BITMAP_ITEM_DOES_NOT_EXIST - if the course is not in the bitmap
+ * COURSE_BITMAP_OK - otherwise
+ */
+CourseBitmapResult courseBitmapRemove(CourseBitmap bitmap, int course_id) {
+    if (bitmap == NULL) return COURSE_BITMAP_NULL_ARGUMENT;
+    if (courseBitmapContains(bitmap, course_id) == false) return COURSE_BITMAP_ITEM_DOES_NOT_EXIST;
+    container_t** container = &bitmap->chunks[course_id >> 16];
+    containerRemove(*container, (uint16_t)(course_id & 0xFFFF));
+    if ((*container)->size == 0) {
+        containerDestroy(*container);
+        *container = NULL;
+    }
+    bitmap->size--;
+    return COURSE_BITMAP_OK;
+}
+
+/**
+ * courseBitmapNext - returns the smallest course id in the bitmap that is bigger than the given one
+ * @param bitmap - the bitmap to search in
+ * @param previous_course_id - the course id to search after (0 to get the first course)
+ * @return the next course id, or -1 if there is no such course (or the bitmap is NULL)
+ */
+int courseBitmapNext(CourseBitmap bitmap, int previous_course_id) {
+    if (bitmap == NULL || previous_course_id >= MAX_COURSE_ID) return -1;
+    int course_id = (previous_course_id < 0) ? 0 : previous_course_id + 1;
+    for (int chunk = course_id >> 16; chunk < CHUNKS_COUNT; chunk++) {
+        if (bitmap->chunks[chunk] != NULL) {
+            int low = (chunk == (course_id >> 16)) ? (course_id & 0xFFFF) : 0;
+            int next = containerNext(bitmap->chunks[chunk], low);
+            if (next != -1) return (chunk << 16) | next;
+        }
+    }
+    return -1;
+}
+
+/**
+ * courseBitmapDestroy - deallocate all the memory of the bitmap
+ * @param bitmap - the bitmap to destroy. if bitmap is NULL nothing will be done
+ */
+void courseBitmapDestroy(CourseBitmap bitmap) {
+    if (bitmap == NULL) return;
+    for (int i = 0; i < CHUNKS_COUNT; i++) {
+        containerDestroy(bitmap->chunks[i]);
+    }
+    free(bitmap);
+}
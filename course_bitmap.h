@@ -0,0 +1,104 @@
+#ifndef EX3_COURSE_BITMAP_H
+#define EX3_COURSE_BITMAP_H
+
+#include <stdbool.h>
+
+/**
+ * Compressed bitmap of courses' ids (roaring bitmap style).
+ *
+ * The ids (positive numbers lower than 1000000) are split by their high 16 bits into chunks. every non empty chunk is
+ * kept in a container that is either a sorted array of the low 16 bits of its ids (while it has up to 4096 ids), or a
+ * plain bitmap of 65536 bits (when it has more). so a few courses take a few bytes, and many courses at most 8KB per
+ * chunk.
+ */
+typedef struct course_bitmap_t *CourseBitmap;
+
+/** Type used for returning error codes from functions */
+typedef enum CourseBitmapResult_t {
+    COURSE_BITMAP_OK,
+    COURSE_BITMAP_NULL_ARGUMENT,
+    COURSE_BITMAP_OUT_OF_MEMORY,
+    COURSE_BITMAP_INVALID_PARAMETER,
+    COURSE_BITMAP_ITEM_ALREADY_EXISTS,
+    COURSE_BITMAP_ITEM_DOES_NOT_EXIST
+} CourseBitmapResult;
+
+/**
+ * courseBitmapCreate - creates a new empty bitmap. no memory is allocated for the containers until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseBitmap in case of success.
+ */
+CourseBitmap courseBitmapCreate();
+
+/**
+ * courseBitmapCopy - creates a copy of the given bitmap
+ * @param bitmap - the bitmap to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A CourseBitmap with the same courses as the given bitmap otherwise.
+ */
+CourseBitmap courseBitmapCopy(CourseBitmap bitmap);
+
+/**
+ * courseBitmapGetSize - returns the number of courses in the bitmap
+ * @param bitmap - the bitmap to get its size
+ * @return the number of courses in the bitmap. -1 if the bitmap is NULL
+ */
+int courseBitmapGetSize(CourseBitmap bitmap);
+
+/**
+ * courseBitmapContains - checks if the given course is in the bitmap
+ * @param bitmap - the bitmap to search in
+ * @param course_id - the id of the course to search
+ * @return true if the course is in the bitmap, false otherwise (or if the bitmap is NULL)
+ */
+bool courseBitmapContains(CourseBitmap bitmap, int course_id);
+
+/**
+ * courseBitmapAdd - adds the given course to the bitmap
+ * @param bitmap - the bitmap to add the course to
+ * @param course_id - the id of the course to add (must be positive number lower than 1000000)
+ * @return
+ * COURSE_BITMAP_NULL_ARGUMENT - if the bitmap is NULL
+ * COURSE_BITMAP_INVALID_PARAMETER - if the course id is not valid
+ * COURSE_BITMAP_OUT_OF_MEMORY - if there was a memory error
+ * COURSE_BITMAP_ITEM_ALREADY_EXISTS - if the course is already in the bitmap
+ * COURSE_BITMAP_OK - otherwise
+ */
+CourseBitmapResult courseBitmapAdd(CourseBitmap bitmap, int course_id);
+
+/**
+ * courseBitmapRemove - removes the given course from the bitmap
+ * @param bitmap - the bitmap to remove the course from
+ * @param course_id - the id of the course to remove
+ * @return
+ * COURSE_BITMAP_NULL_ARGUMENT - if the bitmap is NULL
+ * COURSE_BITMAP_ITEM_DOES_NOT_EXIST - if the course is not in the bitmap
+ * COURSE_BITMAP_OK - otherwise
+ */
+CourseBitmapResult courseBitmapRemove(CourseBitmap bitmap, int course_id);
+
+/**
+ * courseBitmapNext - returns the smallest course id in the bitmap that is bigger than the given one
+ * @param bitmap - the bitmap to search in
+ * @param previous_course_id - the course id to search after (0 to get the first course)
+ * @return the next course id, or -1 if there is no such course (or the bitmap is NULL)
+ */
+int courseBitmapNext(CourseBitmap bitmap, int previous_course_id);
+
+/**
+ * courseBitmapDestroy - deallocate all the memory of the bitmap
+ * @param bitmap - the bitmap to destroy. if bitmap is NULL nothing will be done
+ */
+void courseBitmapDestroy(CourseBitmap bitmap);
+
+/**
+ * Macro for iterating over the courses of a bitmap, in ascending order.
+ * the bitmap must not be changed while iterating over it.
+ * declares a new int variable named iterator, that contains the current course id in every iteration.
+ */
+#define COURSE_BITMAP_FOREACH(iterator, bitmap) \
+    for (int iterator = courseBitmapNext(bitmap, 0); iterator != -1; iterator = courseBitmapNext(bitmap, iterator))
+
+#endif //EX3_COURSE_BITMAP_H
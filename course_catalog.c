@@ -0,0 +1,220 @@
+#include "course_catalog.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#define MIN_SPORT_COURSE_ID 390000
+#define MAX_SPORT_COURSE_ID 399999
+
+#define COURSE_CATALOG_INITIAL_BUCKETS 64
+
+typedef struct course_t {
+    CourseCatalog catalog; // NULL if the entry is not (or no longer) in a catalog
+    struct course_t* next; // the next entry in the same bucket of the catalog
+    int course_id;
+    int points_x2;
+    bool is_sport;
+    int references;
+} course_t;
+
+typedef struct course_catalog_t {
+    Course* buckets;
+    int buckets_count; // always a power of 2
+    int size;
+} course_catalog_t;
+
+/**
+ * hashCourse - hash of the key of a course entry
+ */
+static uint32_t hashCourse(int course_id, int points_x2) {
+    uint32_t hash = (uint32_t)course_id * 2654435761u;
+    return (hash ^ (uint32_t)points_x2) * 2246822519u;
+}
+
+/**
+ * courseCreate - allocates a new course entry with a single holder, which is not in any catalog
+ * @return NULL if the allocation failed, the new entry otherwise
+ */
+static Course courseCreate(int course_id, int points_x2) {
+    Course course = (Course) malloc(sizeof(*course));
+    if (course == NULL) return NULL;
+    course->catalog = NULL;
+    course->next = NULL;
+    course->course_id = course_id;
+    course->points_x2 = points_x2;
+    course->is_sport = isSportCourseId(course_id);
+    course->references = 1;
+    return course;
+}
+
+/**
+ * courseCatalogGrow - doubles the number of buckets of the catalog, and moves the entries to their new buckets
+ * @return false if there was a memory error (the catalog is not changed), true otherwise
+ */
+static bool courseCatalogGrow(CourseCatalog catalog) {
+    int new_buckets_count = catalog->buckets_count * 2;
+    Course* new_buckets = (Course*) calloc(new_buckets_count, sizeof(*new_buckets));
+    if (new_buckets == NULL) return false;
+    for (int i = 0; i < catalog->buckets_count; i++) {
+        Course course = catalog->buckets[i];
+        while (course != NULL) {
+            Course next = course->next;
+            int index = hashCourse(course->course_id, course->points_x2) & (new_buckets_count - 1);
+            course->next = new_buckets[index];
+            new_buckets[index] = course;
+            course = next;
+        }
+    }
+    free(catalog->buckets);
+    catalog->buckets = new_buckets;
+    catalog->buckets_count = new_buckets_count;
+    return true;
+}
+
+/**
+ * courseCatalogCreate - creates a new empty course catalog
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseCatalog in case of success.
+ */
+CourseCatalog courseCatalogCreate() {
+    CourseCatalog catalog = (CourseCatalog) malloc(sizeof(*catalog));
+    if (catalog == NULL) return NULL;
+    catalog->buckets = (Course*) calloc(COURSE_CATALOG_INITIAL_BUCKETS, sizeof(*catalog->buckets));
+    if (catalog->buckets == NULL) {
+        free(catalog);
+        return NULL;
+    }
+    catalog->buckets_count = COURSE_CATALOG_INITIAL_BUCKETS;
+    catalog->size = 0;
+    return catalog;
+}
+
+/**
+ * courseCatalogGet - returns a handle to the entry of the given course with the given points, adding it to the
+ * catalog if it is not there yet. the returned handle must be released with courseRelease.
+ * @param catalog - the catalog to search the course in. if NULL, a new entry that is not shared with anyone is created
+ * @param course_id - the id of the course
+ * @param points_x2 - the points of the course multiple by 2
+ * @return
+ * NULL - if a memory allocation failed.
+ * The handle of the course entry otherwise.
+ */
+Course courseCatalogGet(CourseCatalog catalog, int course_id, int points_x2) {
+    if (catalog == NULL) return courseCreate(course_id, points_x2);
+    uint32_t hash = hashCourse(course_id, points_x2);
+    for (Course course = catalog->buckets[hash & (catalog->buckets_count - 1)]; course != NULL; course = course->next) {
+        if (course->course_id == course_id && course->points_x2 == points_x2) {
+            return courseRetain(course);
+        }
+    }
+    // keep the average bucket length under 1. if growing fails, the catalog just gets a bit slower
+    if (catalog->size >= catalog->buckets_count) {
+        courseCatalogGrow(catalog);
+    }
+    Course course = courseCreate(course_id, points_x2);
+    if (course == NULL) return NULL;
+    int index = hash & (catalog->buckets_count - 1);
+    course->catalog = catalog;
+    course->next = catalog->buckets[index];
+    catalog->buckets[index] = course;
+    catalog->size++;
+    return course;
+}
+
+/**
+ * courseCatalogGetSize - returns the number of distinct course entries in the catalog
+ * @param catalog - the catalog to get its size
+ * @return the number of entries in the catalog. -1 if the catalog is NULL
+ */
+int courseCatalogGetSize(CourseCatalog catalog) {
+    if (catalog == NULL) return -1;
+    return catalog->size;
+}
+
+/**
+ * courseCatalogDestroy - deallocate the catalog. entries that are still held are detached from the catalog, and are
+ * deallocated when their last handle is released.
+ * @param catalog - the catalog to destroy. if catalog is NULL nothing will be done
+ */
+void courseCatalogDestroy(CourseCatalog catalog) {
+    if (catalog == NULL) return;
+    for (int i = 0; i < catalog->buckets_count; i++) {
+        for (Course course = catalog->buckets[i]; course != NULL; course = course->next) {
+            course->catalog = NULL;
+        }
+    }
+    free(catalog->buckets);
+    free(catalog);
+}
+
+/**
+ * courseRetain - adds a holder to the given course entry
+ * @param course - the course entry to retain
+ * @return the given course entry (NULL if course is NULL)
+ */
+Course courseRetain(Course course) {
+    if (course == NULL) return NULL;
+    course->references++;
+    return course;
+}
+
+/**
+ * courseRelease - removes a holder from the given course entry. the entry is deallocated when its last holder
+ * releases it
+ * @param course - the course entry to release. if course is NULL nothing will be done
+ */
+void courseRelease(Course course) {
+    if (course == NULL) return;
+    course->references--;
+    if (course->references > 0) return;
+    CourseCatalog catalog = course->catalog;
+    if (catalog != NULL) {
+        Course* link = &catalog->buckets[hashCourse(course->course_id, course->points_x2) &
+                                         (catalog->buckets_count - 1)];
+        while (*link != course) {
+            link = &(*link)->next;
+        }
+        *link = course->next;
+        catalog->size--;
+    }
+    free(course);
+}
+
+/**
+ * courseGetId - returns the id of the given course entry
+ * @param course - the course entry
+ * @return the id of the course. -1 if course is NULL
+ */
+int courseGetId(Course course) {
+    if (course == NULL) return -1;
+    return course->course_id;
+}
+
+/**
+ * courseGetPointsX2 - returns the points of the given course entry multiple by 2
+ * @param course - the course entry
+ * @return the points of the course multiple by 2. -1 if course is NULL
+ */
+int courseGetPointsX2(Course course) {
+    if (course == NULL) return -1;
+    return course->points_x2;
+}
+
+/**
+ * courseIsSport - checks if the given course entry is of a sport course
+ * @param course - the course entry
+ * @return whether this course is a sport course (false if course is NULL)
+ */
+bool courseIsSport(Course course) {
+    if (course == NULL) return false;
+    return course->is_sport;
+}
+
+/**
+ * isSportCourseId - checks if the course with the given id is a sport course
+ * @param course_id - the id of the course
+ * @return whether this course is a sport course
+ */
+bool isSportCourseId(int course_id) {
+    return (course_id >= MIN_SPORT_COURSE_ID && course_id <= MAX_SPORT_COURSE_ID);
+}
@@ -0,0 +1,92 @@
+#ifndef EX3_COURSE_CATALOG_H
+#define EX3_COURSE_CATALOG_H
+
+#include <stdbool.h>
+
+/**
+ * Catalog of the courses' metadata (points and derived flags), shared by all the grades of the same course.
+ *
+ * A course entry is keyed by the course id and its points, since nothing forces all the grades of a course to be added
+ * with the same points. entries are immutable and reference counted: every grade holds a Course handle, and an entry
+ * is removed from the catalog (and deallocated) when its last handle is released.
+ */
+typedef struct course_catalog_t *CourseCatalog;
+typedef struct course_t *Course;
+
+/**
+ * courseCatalogCreate - creates a new empty course catalog
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseCatalog in case of success.
+ */
+CourseCatalog courseCatalogCreate();
+
+/**
+ * courseCatalogGet - returns a handle to the entry of the given course with the given points, adding it to the
+ * catalog if it is not there yet. the returned handle must be released with courseRelease.
+ * @param catalog - the catalog to search the course in. if NULL, a new entry that is not shared with anyone is created
+ * @param course_id - the id of the course
+ * @param points_x2 - the points of the course multiple by 2
+ * @return
+ * NULL - if a memory allocation failed.
+ * The handle of the course entry otherwise.
+ */
+Course courseCatalogGet(CourseCatalog catalog, int course_id, int points_x2);
+
+/**
+ * courseCatalogGetSize - returns the number of distinct course entries in the catalog
+ * @param catalog - the catalog to get its size
+ * @return the number of entries in the catalog. -1 if the catalog is NULL
+ */
+int courseCatalogGetSize(CourseCatalog catalog);
+
+/**
+ * courseCatalogDestroy - deallocate the catalog. entries that are still held are detached from the catalog, and are
+ * deallocated when their last handle is released.
+ * @param catalog - the catalog to destroy. if catalog is NULL nothing will be done
+ */
+void courseCatalogDestroy(CourseCatalog catalog);
+
+/**
+ * courseRetain - adds a holder to the given course entry
+ * @param course - the course entry to retain
+ * @return the given course entry (NULL if course is NULL)
+ */
+Course courseRetain(Course course);
+
+/**
+ * courseRelease - removes a holder from the given course entry. the entry is deallocated when its last holder
+ * releases it
+ * @param course - the course entry to release. if course is NULL nothing will be done
+ */
+void courseRelease(Course course);
+
+/**
+ * courseGetId - returns the id of the given course entry
+ * @param course - the course entry
+ * @return the id of the course. -1 if course is NULL
+ */
+int courseGetId(Course course);
+
+/**
+ * courseGetPointsX2 - returns the points of the given course entry multiple by 2
+ * @param course - the course entry
+ * @return the points of the course multiple by 2. -1 if course is NULL
+ */
+int courseGetPointsX2(Course course);
+
+/**
+ * courseIsSport - checks if the given course entry is of a sport course
+ * @param course - the course entry
+ * @return whether this course is a sport course (false if course is NULL)
+ */
+bool courseIsSport(Course course);
+
+/**
+ * isSportCourseId - checks if the course with the given id is a sport course
+ * @param course_id - the id of the course
+ * @return whether this course is a sport course
+ */
+bool isSportCourseId(int course_id);
+
+#endif //EX3_COURSE_CATALOG_H
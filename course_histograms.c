@@ -0,0 +1,230 @@
+#include "course_histograms.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "grade_kernels.h"
+
+#define COURSE_HISTOGRAMS_INITIAL_BUCKETS 64
+#define MAX_GRADE 100
+
+typedef struct course_histogram_t {
+    int course_id;
+    int count;
+    long long sum;
+    int grades[MAX_GRADE + 1]; // the number of grades of every grade number
+} CourseHistogram;
+
+typedef struct course_histograms_t {
+    CourseHistogram** buckets; // open addressing with linear probing, NULL for an empty bucket
+    int buckets_count; // always a power of 2, and at least twice the size
+    int size; // the number of courses that have a histogram
+} course_histograms_t;
+
+/**
+ * hashCourseId - spreads the bits of the course id, so near ids do not fall into near buckets
+ */
+static uint32_t hashCourseId(int course_id) {
+    uint32_t hash = (uint32_t)course_id;
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bu;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * findBucket - returns the index of the bucket of the given course, or of the empty bucket it should be put in
+ */
+static int findBucket(CourseHistogram** buckets, int buckets_count, int course_id) {
+    int index = hashCourseId(course_id) & (buckets_count - 1);
+    while (buckets[index] != NULL && buckets[index]->course_id != course_id) {
+        index = (index + 1) & (buckets_count - 1);
+    }
+    return index;
+}
+
+/**
+ * findHistogram - inner function that returns the histogram of the given course, or NULL if it has none
+ */
+static CourseHistogram* findHistogram(CourseHistograms histograms, int course_id) {
+    if (histograms == NULL) return NULL;
+    return histograms->buckets[findBucket(histograms->buckets, histograms->buckets_count, course_id)];
+}
+
+/**
+ * courseHistogramsGrow - doubles the number of buckets, and moves the histograms to their new buckets
+ * @return false if there was a memory error (the histograms are not changed), true otherwise
+ */
+static bool courseHistogramsGrow(CourseHistograms histograms) {
+    int new_buckets_count = histograms->buckets_count * 2;
+    CourseHistogram** new_buckets = (CourseHistogram**) calloc(new_buckets_count, sizeof(*new_buckets));
+    if (new_buckets == NULL) return false;
+    for (int i = 0; i < histograms->buckets_count; i++) {
+        if (histograms->buckets[i] == NULL) continue;
+        new_buckets[findBucket(new_buckets, new_buckets_count, histograms->buckets[i]->course_id)] =
+                histograms->buckets[i];
+    }
+    free(histograms->buckets);
+    histograms->buckets = new_buckets;
+    histograms->buckets_count = new_buckets_count;
+    return true;
+}
+
+/**
+ * courseHistogramsCreate - creates new histograms without grades
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseHistograms in case of success.
+ */
+CourseHistograms courseHistogramsCreate() {
+    CourseHistograms histograms = (CourseHistograms) malloc(sizeof(*histograms));
+    if (histograms == NULL) return NULL;
+    histograms->buckets = (CourseHistogram**) calloc(COURSE_HISTOGRAMS_INITIAL_BUCKETS, sizeof(CourseHistogram*));
+    if (histograms->buckets == NULL) {
+        free(histograms);
+        return NULL;
+    }
+    histograms->buckets_count = COURSE_HISTOGRAMS_INITIAL_BUCKETS;
+    histograms->size = 0;
+    return histograms;
+}
+
+/**
+ * courseHistogramsAdd - adds a grade to the histogram of the course with the given id
+ * @param histograms - the histograms to add the grade to
+ * @param course_id - the id of the course
+ * @param grade - the grade (must be between 0 and 100)
+ * @return
+ * COURSE_HISTOGRAMS_NULL_ARGUMENT - if histograms is NULL
+ * COURSE_HISTOGRAMS_INVALID_PARAMETER - if the grade is not between 0 and 100
+ * COURSE_HISTOGRAMS_OUT_OF_MEMORY - if there was a memory error (the histograms are not changed)
+ * COURSE_HISTOGRAMS_OK - otherwise
+ */
+CourseHistogramsResult courseHistogramsAdd(CourseHistograms histograms, int course_id, int grade) {
+    if (histograms == NULL) return COURSE_HISTOGRAMS_NULL_ARGUMENT;
+    if (grade < 0 || grade > MAX_GRADE) return COURSE_HISTOGRAMS_INVALID_PARAMETER;
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    if (histogram == NULL) {
+        if ((histograms->size + 1) * 2 > histograms->buckets_count && !courseHistogramsGrow(histograms)) {
+            return COURSE_HISTOGRAMS_OUT_OF_MEMORY;
+        }
+        histogram = (CourseHistogram*) calloc(1, sizeof(*histogram));
+        if (histogram == NULL) return COURSE_HISTOGRAMS_OUT_OF_MEMORY;
+        histogram->course_id = course_id;
+        histograms->buckets[findBucket(histograms->buckets, histograms->buckets_count, course_id)] = histogram;
+        histograms->size++;
+    }
+    histogram->grades[grade]++;
+    histogram->count++;
+    histogram->sum += grade;
+    return COURSE_HISTOGRAMS_OK;
+}
+
+/**
+ * courseHistogramsRemove - removes a grade from the histogram of the course with the given id
+ * @param histograms - the histograms to remove the grade from
+ * @param course_id - the id of the course
+ * @param grade - the grade
+ * @return
+ * COURSE_HISTOGRAMS_NULL_ARGUMENT - if histograms is NULL
+ * COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST - if the course has no such grade
+ * COURSE_HISTOGRAMS_OK - otherwise
+ */
+CourseHistogramsResult courseHistogramsRemove(CourseHistograms histograms, int course_id, int grade) {
+    if (histograms == NULL) return COURSE_HISTOGRAMS_NULL_ARGUMENT;
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    if (histogram == NULL || grade < 0 || grade > MAX_GRADE || histogram->grades[grade] == 0) {
+        return COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST;
+    }
+    histogram->grades[grade]--;
+    histogram->count--;
+    histogram->sum -= grade;
+    return COURSE_HISTOGRAMS_OK;
+}
+
+/**
+ * courseHistogramsGetCount - returns the number of grades of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the number of grades of the course. 0 if it has none (or histograms is NULL)
+ */
+int courseHistogramsGetCount(CourseHistograms histograms, int course_id) {
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    return (histogram == NULL) ? 0 : histogram->count;
+}
+
+/**
+ * courseHistogramsGetMean - returns the mean of the grades of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the mean of the grades. -1 if the course has no grades (or histograms is NULL)
+ */
+double courseHistogramsGetMean(CourseHistograms histograms, int course_id) {
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    if (histogram == NULL || histogram->count == 0) return -1;
+    return (double)histogram->sum / histogram->count;
+}
+
+/**
+ * courseHistogramsGetPercentile - returns the given percentile of the grades of the course with the given id: the
+ * lowest grade that at least the given percent of the grades are not higher than (so the 50th percentile is the
+ * median, the lower one for an even number of grades)
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @param percent - the percentile (must be between 0 and 100)
+ * @return the percentile. -1 if the course has no grades, the percent is not valid (or histograms is NULL)
+ */
+int courseHistogramsGetPercentile(CourseHistograms histograms, int course_id, int percent) {
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    if (histogram == NULL || histogram->count == 0 || percent < 0 || percent > 100) return -1;
+    // the rank of the percentile among the sorted grades, at least the first one
+    long long rank = ((long long)percent * histogram->count + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+    long long seen = 0;
+    for (int grade = 0; grade <= MAX_GRADE; grade++) {
+        seen += histogram->grades[grade];
+        if (seen >= rank) return grade;
+    }
+    return MAX_GRADE;
+}
+
+/**
+ * courseHistogramsGetFailedCount - returns the number of failed grades (lower than 55) of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the number of failed grades. 0 if the course has no grades (or histograms is NULL)
+ */
+int courseHistogramsGetFailedCount(CourseHistograms histograms, int course_id) {
+    CourseHistogram* histogram = findHistogram(histograms, course_id);
+    if (histogram == NULL) return 0;
+    int failed = 0;
+    for (int grade = 0; grade < FAILED_GRADE_LIMIT; grade++) {
+        failed += histogram->grades[grade];
+    }
+    return failed;
+}
+
+/**
+ * courseHistogramsClear - removes all the grades of all the courses, so the histograms can be built again
+ * @param histograms - the histograms to clear. if histograms is NULL nothing will be done
+ */
+void courseHistogramsClear(CourseHistograms histograms) {
+    if (histograms == NULL) return;
+    for (int i = 0; i < histograms->buckets_count; i++) {
+        free(histograms->buckets[i]);
+        histograms->buckets[i] = NULL;
+    }
+    histograms->size = 0;
+}
+
+/**
+ * courseHistogramsDestroy - deallocate all the memory of the histograms
+ * @param histograms - the histograms to destroy. if histograms is NULL nothing will be done
+ */
+void courseHistogramsDestroy(CourseHistograms histograms) {
+    if (histograms == NULL) return;
+    courseHistogramsClear(histograms);
+    free(histograms->buckets);
+    free(histograms);
+}
@@ -0,0 +1,103 @@
+#ifndef EX3_COURSE_HISTOGRAMS_H
+#define EX3_COURSE_HISTOGRAMS_H
+
+/**
+ * The distribution of the effective grades of every course, over all the students.
+ *
+ * Every course has a histogram with a bucket for every grade (0 to 100), so adding or removing a grade is O(1), and
+ * the mean, the percentiles and the number of failed grades are derived from the 101 buckets, without going over the
+ * grades. the histograms are kept in a hash table by the course id. the histogram of a course is kept (empty) after
+ * its last grade is removed.
+ */
+typedef struct course_histograms_t *CourseHistograms;
+
+/** Type used for returning error codes from functions */
+typedef enum CourseHistogramsResult_t {
+    COURSE_HISTOGRAMS_OK,
+    COURSE_HISTOGRAMS_NULL_ARGUMENT,
+    COURSE_HISTOGRAMS_OUT_OF_MEMORY,
+    COURSE_HISTOGRAMS_INVALID_PARAMETER,
+    COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST
+} CourseHistogramsResult;
+
+/**
+ * courseHistogramsCreate - creates new histograms without grades
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseHistograms in case of success.
+ */
+CourseHistograms courseHistogramsCreate();
+
+/**
+ * courseHistogramsAdd - adds a grade to the histogram of the course with the given id
+ * @param histograms - the histograms to add the grade to
+ * @param course_id - the id of the course
+ * @param grade - the grade (must be between 0 and 100)
+ * @return
+ * COURSE_HISTOGRAMS_NULL_ARGUMENT - if histograms is NULL
+ * COURSE_HISTOGRAMS_INVALID_PARAMETER - if the grade is not between 0 and 100
+ * COURSE_HISTOGRAMS_OUT_OF_MEMORY - if there was a memory error (the histograms are not changed)
+ * COURSE_HISTOGRAMS_OK - otherwise
+ */
+CourseHistogramsResult courseHistogramsAdd(CourseHistograms histograms, int course_id, int grade);
+
+/**
+ * courseHistogramsRemove - removes a grade from the histogram of the course with the given id
+ * @param histograms - the histograms to remove the grade from
+ * @param course_id - the id of the course
+ * @param grade - the grade
+ * @return
+ * COURSE_HISTOGRAMS_NULL_ARGUMENT - if histograms is NULL
+ * COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST - if the course has no such grade
+ * COURSE_HISTOGRAMS_OK - otherwise
+ */
+CourseHistogramsResult courseHistogramsRemove(CourseHistograms histograms, int course_id, int grade);
+
+/**
+ * courseHistogramsGetCount - returns the number of grades of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the number of grades of the course. 0 if it has none (or histograms is NULL)
+ */
+int courseHistogramsGetCount(CourseHistograms histograms, int course_id);
+
+/**
+ * courseHistogramsGetMean - returns the mean of the grades of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the mean of the grades. -1 if the course has no grades (or histograms is NULL)
+ */
+double courseHistogramsGetMean(CourseHistograms histograms, int course_id);
+
+/**
+ * courseHistogramsGetPercentile - returns the given percentile of the grades of the course with the given id: the
+ * lowest grade that at least the given percent of the grades are not higher than (so the 50th percentile is the
+ * median, the lower one for an even number of grades)
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @param percent - the percentile (must be between 0 and 100)
+ * @return the percentile. -1 if the course has no grades, the percent is not valid (or histograms is NULL)
+ */
+int courseHistogramsGetPercentile(CourseHistograms histograms, int course_id, int percent);
+
+/**
+ * courseHistogramsGetFailedCount - returns the number of failed grades (lower than 55) of the course with the given id
+ * @param histograms - the histograms to search in
+ * @param course_id - the id of the course
+ * @return the number of failed grades. 0 if the course has no grades (or histograms is NULL)
+ */
+int courseHistogramsGetFailedCount(CourseHistograms histograms, int course_id);
+
+/**
+ * courseHistogramsClear - removes all the grades of all the courses, so the histograms can be built again
+ * @param histograms - the histograms to clear. if histograms is NULL nothing will be done
+ */
+void courseHistogramsClear(CourseHistograms histograms);
+
+/**
+ * courseHistogramsDestroy - deallocate all the memory of the histograms
+ * @param histograms - the histograms to destroy. if histograms is NULL nothing will be done
+ */
+void courseHistogramsDestroy(CourseHistograms histograms);
+
+#endif //EX3_COURSE_HISTOGRAMS_H
@@ -0,0 +1,303 @@
+#include "course_history.h"
+#include <stdlib.h>
+#include "typed_vector.h"
+
+/** the grades of a course in a single semester */
+typedef struct semester_history_t {
+    int semester_number;
+    int grades_count;
+    int last_grade;
+    int best_grade;
+} SemesterHistory;
+
+#define SEMESTER_HISTORY_KEY(entry) ((entry).semester_number)
+
+SORTED_VECTOR_DEFINE(SemesterHistoryVector, semesterHistoryVector, SemesterHistory, int, SEMESTER_HISTORY_KEY,
+                     VECTOR_COMPARE_INTS)
+
+/** the grades of a course in all the semesters it was taken in */
+typedef struct course_record_t {
+    int course_id;
+    int best_grade; // the best grade over all the semesters
+    SemesterHistoryVector semesters;
+} CourseRecord;
+
+#define COURSE_RECORD_KEY(record) ((record).course_id)
+
+SORTED_VECTOR_DEFINE(CourseRecordVector, courseRecordVector, CourseRecord, int, COURSE_RECORD_KEY, VECTOR_COMPARE_INTS)
+
+typedef struct course_history_t {
+    CourseRecordVector courses;
+} course_history_t;
+
+/**
+ * courseRecordUpdateBestGrade - recalculates the best grade of the course over all the semesters
+ */
+static void courseRecordUpdateBestGrade(CourseRecord* record) {
+    record->best_grade = -1;
+    for (int i = 0; i < semesterHistoryVectorSize(&record->semesters); i++) {
+        int semester_best_grade = semesterHistoryVectorAt(&record->semesters, i)->best_grade;
+        if (semester_best_grade > record->best_grade) {
+            record->best_grade = semester_best_grade;
+        }
+    }
+}
+
+/**
+ * courseHistoryCreate - creates a new empty history
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseHistory in case of success.
+ */
+CourseHistory courseHistoryCreate() {
+    CourseHistory history = (CourseHistory) malloc(sizeof(*history));
+    if (history == NULL) return NULL;
+    courseRecordVectorInit(&history->courses);
+    return history;
+}
+
+/**
+ * courseHistoryCopy - creates a copy of the given history
+ * @param history - the history to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A CourseHistory with the same data as the given history otherwise.
+ */
+CourseHistory courseHistoryCopy(CourseHistory history) {
+    if (history == NULL) return NULL;
+    CourseHistory new_history = courseHistoryCreate();
+    if (new_history == NULL) return NULL;
+    if (courseRecordVectorReserve(&new_history->courses, courseRecordVectorSize(&history->courses)) != VECTOR_OK) {
+        courseHistoryDestroy(new_history);
+        return NULL;
+    }
+    for (int i = 0; i < courseRecordVectorSize(&history->courses); i++) {
+        CourseRecord* record = courseRecordVectorAt(&history->courses, i);
+        CourseRecord new_record = {record->course_id, record->best_grade, {NULL, 0, 0}};
+        if (semesterHistoryVectorCopy(&new_record.semesters, &record->semesters) != VECTOR_OK) {
+            courseHistoryDestroy(new_history);
+            return NULL;
+        }
+        courseRecordVectorAppend(&new_history->courses, new_record); // the space is already reserved
+    }
+    return new_history;
+}
+
+/**
+ * courseHistoryAddGrade - records a new grade, added as the last grade of the course in the semester
+ * @param history - the history to add the grade to
+ * @param course_id - the id of the course of the grade
+ * @param semester_number - the semester of the grade
+ * @param grade - the grade number
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_OUT_OF_MEMORY - if there was a memory error (the history is not changed)
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryAddGrade(CourseHistory history, int course_id, int semester_number, int grade) {
+    if (history == NULL) return COURSE_HISTORY_NULL_ARGUMENT;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) {
+        CourseRecord new_record = {course_id, grade, {NULL, 0, 0}};
+        SemesterHistory semester = {semester_number, 1, grade, grade};
+        if (semesterHistoryVectorInsert(&new_record.semesters, semester) != VECTOR_OK) {
+            return COURSE_HISTORY_OUT_OF_MEMORY;
+        }
+        if (courseRecordVectorInsert(&history->courses, new_record) != VECTOR_OK) {
+            semesterHistoryVectorDestroy(&new_record.semesters);
+            return COURSE_HISTORY_OUT_OF_MEMORY;
+        }
+        return COURSE_HISTORY_OK;
+    }
+    SemesterHistory* semester = semesterHistoryVectorFind(&record->semesters, semester_number);
+    if (semester == NULL) {
+        SemesterHistory new_semester = {semester_number, 1, grade, grade};
+        if (semesterHistoryVectorInsert(&record->semesters, new_semester) != VECTOR_OK) {
+            return COURSE_HISTORY_OUT_OF_MEMORY;
+        }
+    } else {
+        semester->grades_count++;
+        semester->last_grade = grade;
+        if (grade > semester->best_grade) {
+            semester->best_grade = grade;
+        }
+    }
+    if (grade > record->best_grade) {
+        record->best_grade = grade;
+    }
+    return COURSE_HISTORY_OK;
+}
+
+/**
+ * courseHistoryRemoveGrade - records the removal of a grade of the course in the semester
+ * @param history - the history to remove the grade from
+ * @param course_id - the id of the course of the removed grade
+ * @param semester_number - the semester of the removed grade
+ * @param last_grade - the last grade of the course in the semester after the removal (ignored if no grades are left)
+ * @param best_grade - the best grade of the course in the semester after the removal (ignored if no grades are left)
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_COURSE_DOES_NOT_EXIST - if there are no grades of the course in the semester
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryRemoveGrade(CourseHistory history, int course_id, int semester_number,
+                                             int last_grade, int best_grade) {
+    if (history == NULL) return COURSE_HISTORY_NULL_ARGUMENT;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return COURSE_HISTORY_COURSE_DOES_NOT_EXIST;
+    SemesterHistory* semester = semesterHistoryVectorFind(&record->semesters, semester_number);
+    if (semester == NULL) return COURSE_HISTORY_COURSE_DOES_NOT_EXIST;
+    semester->grades_count--;
+    if (semester->grades_count > 0) {
+        semester->last_grade = last_grade;
+        semester->best_grade = best_grade;
+    } else {
+        semesterHistoryVectorRemove(&record->semesters, semester_number);
+    }
+    if (semesterHistoryVectorSize(&record->semesters) == 0) {
+        semesterHistoryVectorDestroy(&record->semesters);
+        courseRecordVectorRemove(&history->courses, course_id);
+        return COURSE_HISTORY_OK;
+    }
+    courseRecordUpdateBestGrade(record);
+    return COURSE_HISTORY_OK;
+}
+
+/**
+ * courseHistoryUpdateGrades - records a change of the grades of the course in the semester
+ * @param history - the history to update
+ * @param course_id - the id of the course
+ * @param semester_number - the semester of the changed grades
+ * @param last_grade - the new last grade of the course in the semester
+ * @param best_grade - the new best grade of the course in the semester
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_COURSE_DOES_NOT_EXIST - if there are no grades of the course in the semester
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryUpdateGrades(CourseHistory history, int course_id, int semester_number,
+                                              int last_grade, int best_grade) {
+    if (history == NULL) return COURSE_HISTORY_NULL_ARGUMENT;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return COURSE_HISTORY_COURSE_DOES_NOT_EXIST;
+    SemesterHistory* semester = semesterHistoryVectorFind(&record->semesters, semester_number);
+    if (semester == NULL) return COURSE_HISTORY_COURSE_DOES_NOT_EXIST;
+    semester->last_grade = last_grade;
+    semester->best_grade = best_grade;
+    courseRecordUpdateBestGrade(record);
+    return COURSE_HISTORY_OK;
+}
+
+/**
+ * courseHistoryContains - checks if there are grades of the given course in the history
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return true if there is at least one grade of the course, false otherwise (or if the history is NULL)
+ */
+bool courseHistoryContains(CourseHistory history, int course_id) {
+    if (history == NULL) return false;
+    return (courseRecordVectorFind(&history->courses, course_id) != NULL);
+}
+
+/**
+ * courseHistoryGetLastSemester - returns the last semester (the one with the highest number) the course was taken in
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return the number of the last semester of the course. -1 if there are no grades of the course (or history is NULL)
+ */
+int courseHistoryGetLastSemester(CourseHistory history, int course_id) {
+    if (history == NULL) return -1;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return -1;
+    int last_index = semesterHistoryVectorSize(&record->semesters) - 1;
+    return semesterHistoryVectorAt(&record->semesters, last_index)->semester_number;
+}
+
+/**
+ * courseHistoryGetPreviousSemester - returns the last semester before the given one that the course was taken in
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @param semester_number - the semester to search before
+ * @return the number of the semester. -1 if the course was not taken before the given semester (or history is NULL)
+ */
+int courseHistoryGetPreviousSemester(CourseHistory history, int course_id, int semester_number) {
+    if (history == NULL) return -1;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return -1;
+    int index = semesterHistoryVectorLowerBound(&record->semesters, semester_number); // the first one not before it
+    return (index == 0) ? -1 : semesterHistoryVectorAt(&record->semesters, index - 1)->semester_number;
+}
+
+/**
+ * courseHistoryGetBestGrade - returns the best grade of the course over all the semesters
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return the best grade of the course. -1 if there are no grades of the course (or history is NULL)
+ */
+int courseHistoryGetBestGrade(CourseHistory history, int course_id) {
+    if (history == NULL) return -1;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return -1;
+    return record->best_grade;
+}
+
+/**
+ * courseHistoryGetLastGrade - returns the last grade of the course in the given semester
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @param semester_number - the semester
+ * @return the last grade of the course in the semester. -1 if there are no such grades (or history is NULL)
+ */
+int courseHistoryGetLastGrade(CourseHistory history, int course_id, int semester_number) {
+    if (history == NULL) return -1;
+    CourseRecord* record = courseRecordVectorFind(&history->courses, course_id);
+    if (record == NULL) return -1;
+    SemesterHistory* semester = semesterHistoryVectorFind(&record->semesters, semester_number);
+    return (semester == NULL) ? -1 : semester->last_grade;
+}
+
+/**
+ * courseHistoryForEachSemester - calls the given visitor for every semester of every course in the history (sorted by
+ * the course id, and then by the semester number), with the last grade of the course in the semester
+ * @param history - the history to go over
+ * @param visitor - the function to call for every semester of every course
+ * @param context - passed as is to the visitor
+ */
+void courseHistoryForEachSemester(CourseHistory history, CourseSemesterVisitor visitor, void* context) {
+    if (history == NULL || visitor == NULL) return;
+    for (int i = 0; i < courseRecordVectorSize(&history->courses); i++) {
+        CourseRecord* record = courseRecordVectorAt(&history->courses, i);
+        for (int j = 0; j < semesterHistoryVectorSize(&record->semesters); j++) {
+            SemesterHistory* semester = semesterHistoryVectorAt(&record->semesters, j);
+            visitor(record->course_id, semester->semester_number, semester->last_grade, context);
+        }
+    }
+}
+
+/**
+ * courseHistoryRemoveLastCourse - removes the course with the highest id, with all its semesters
+ * @param history - the history to remove the course from
+ * @return the id of the removed course. -1 if the history is empty (or NULL)
+ */
+int courseHistoryRemoveLastCourse(CourseHistory history) {
+    if (history == NULL || courseRecordVectorSize(&history->courses) == 0) return -1;
+    int last = courseRecordVectorSize(&history->courses) - 1;
+    CourseRecord* record = courseRecordVectorAt(&history->courses, last);
+    int course_id = record->course_id;
+    semesterHistoryVectorDestroy(&record->semesters);
+    courseRecordVectorRemoveAt(&history->courses, last);
+    return course_id;
+}
+
+/**
+ * courseHistoryDestroy - deallocate all the memory of the history
+ * @param history - the history to destroy. if history is NULL nothing will be done
+ */
+void courseHistoryDestroy(CourseHistory history) {
+    if (history == NULL) return;
+    for (int i = 0; i < courseRecordVectorSize(&history->courses); i++) {
+        semesterHistoryVectorDestroy(&courseRecordVectorAt(&history->courses, i)->semesters);
+    }
+    courseRecordVectorDestroy(&history->courses);
+    free(history);
+}
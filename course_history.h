@@ -0,0 +1,150 @@
+#ifndef EX3_COURSE_HISTORY_H
+#define EX3_COURSE_HISTORY_H
+
+#include <stdbool.h>
+
+/**
+ * Index of the grades history of a single student, by course.
+ *
+ * For every course the student has grades in, it keeps the semesters the course was taken in (sorted by the semester
+ * number), with the last and the best grade of the course in every such semester, and the best grade of the course
+ * over all the semesters. it does not keep the grades themselves, so it must be told about every change in them.
+ */
+typedef struct course_history_t *CourseHistory;
+
+/** Type of function that is called on every semester a course was taken in, with the last grade of the course in it */
+typedef void (*CourseSemesterVisitor)(int course_id, int semester_number, int last_grade, void* context);
+
+/** Type used for returning error codes from functions */
+typedef enum CourseHistoryResult_t {
+    COURSE_HISTORY_OK,
+    COURSE_HISTORY_NULL_ARGUMENT,
+    COURSE_HISTORY_OUT_OF_MEMORY,
+    COURSE_HISTORY_COURSE_DOES_NOT_EXIST
+} CourseHistoryResult;
+
+/**
+ * courseHistoryCreate - creates a new empty history
+ * @return
+ * NULL - if allocations failed.
+ * A new CourseHistory in case of success.
+ */
+CourseHistory courseHistoryCreate();
+
+/**
+ * courseHistoryCopy - creates a copy of the given history
+ * @param history - the history to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A CourseHistory with the same data as the given history otherwise.
+ */
+CourseHistory courseHistoryCopy(CourseHistory history);
+
+/**
+ * courseHistoryAddGrade - records a new grade, added as the last grade of the course in the semester
+ * @param history - the history to add the grade to
+ * @param course_id - the id of the course of the grade
+ * @param semester_number - the semester of the grade
+ * @param grade - the grade number
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_OUT_OF_MEMORY - if there was a memory error (the history is not changed)
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryAddGrade(CourseHistory history, int course_id, int semester_number, int grade);
+
+/**
+ * courseHistoryRemoveGrade - records the removal of a grade of the course in the semester
+ * @param history - the history to remove the grade from
+ * @param course_id - the id of the course of the removed grade
+ * @param semester_number - the semester of the removed grade
+ * @param last_grade - the last grade of the course in the semester after the removal (ignored if no grades are left)
+ * @param best_grade - the best grade of the course in the semester after the removal (ignored if no grades are left)
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_COURSE_DOES_NOT_EXIST - if there are no grades of the course in the semester
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryRemoveGrade(CourseHistory history, int course_id, int semester_number,
+                                             int last_grade, int best_grade);
+
+/**
+ * courseHistoryUpdateGrades - records a change of the grades of the course in the semester
+ * @param history - the history to update
+ * @param course_id - the id of the course
+ * @param semester_number - the semester of the changed grades
+ * @param last_grade - the new last grade of the course in the semester
+ * @param best_grade - the new best grade of the course in the semester
+ * @return
+ * COURSE_HISTORY_NULL_ARGUMENT - if the history is NULL
+ * COURSE_HISTORY_COURSE_DOES_NOT_EXIST - if there are no grades of the course in the semester
+ * COURSE_HISTORY_OK - otherwise
+ */
+CourseHistoryResult courseHistoryUpdateGrades(CourseHistory history, int course_id, int semester_number,
+                                              int last_grade, int best_grade);
+
+/**
+ * courseHistoryContains - checks if there are grades of the given course in the history
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return true if there is at least one grade of the course, false otherwise (or if the history is NULL)
+ */
+bool courseHistoryContains(CourseHistory history, int course_id);
+
+/**
+ * courseHistoryGetLastSemester - returns the last semester (the one with the highest number) the course was taken in
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return the number of the last semester of the course. -1 if there are no grades of the course (or history is NULL)
+ */
+int courseHistoryGetLastSemester(CourseHistory history, int course_id);
+
+/**
+ * courseHistoryGetPreviousSemester - returns the last semester before the given one that the course was taken in
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @param semester_number - the semester to search before
+ * @return the number of the semester. -1 if the course was not taken before the given semester (or history is NULL)
+ */
+int courseHistoryGetPreviousSemester(CourseHistory history, int course_id, int semester_number);
+
+/**
+ * courseHistoryGetBestGrade - returns the best grade of the course over all the semesters
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @return the best grade of the course. -1 if there are no grades of the course (or history is NULL)
+ */
+int courseHistoryGetBestGrade(CourseHistory history, int course_id);
+
+/**
+ * courseHistoryGetLastGrade - returns the last grade of the course in the given semester
+ * @param history - the history to search in
+ * @param course_id - the id of the course
+ * @param semester_number - the semester
+ * @return the last grade of the course in the semester. -1 if there are no such grades (or history is NULL)
+ */
+int courseHistoryGetLastGrade(CourseHistory history, int course_id, int semester_number);
+
+/**
+ * courseHistoryForEachSemester - calls the given visitor for every semester of every course in the history (sorted by
+ * the course id, and then by the semester number), with the last grade of the course in the semester
+ * @param history - the history to go over
+ * @param visitor - the function to call for every semester of every course
+ * @param context - passed as is to the visitor
+ */
+void courseHistoryForEachSemester(CourseHistory history, CourseSemesterVisitor visitor, void* context);
+
+/**
+ * courseHistoryRemoveLastCourse - removes the course with the highest id, with all its semesters
+ * @param history - the history to remove the course from
+ * @return the id of the removed course. -1 if the history is empty (or NULL)
+ */
+int courseHistoryRemoveLastCourse(CourseHistory history);
+
+/**
+ * courseHistoryDestroy - deallocate all the memory of the history
+ * @param history - the history to destroy. if history is NULL nothing will be done
+ */
+void courseHistoryDestroy(CourseHistory history);
+
+#endif //EX3_COURSE_HISTORY_H
@@ -2,6 +2,17 @@
 #include <stdlib.h>
 #include "string.h"
 #include "assert.h"
+#include "ownership.h"
+#include "course_postings.h"
+#include "int_set.h"
+#include "student_directory.h"
+#include "friend_components.h"
+#include "grade_columns.h"
+#include "course_histograms.h"
+#include "gpa_ranking.h"
+#include "report_cache.h"
+
+#define REPORT_CACHE_BUDGET (1 << 20) // the bytes of the rendered reports that are kept for the next polls
 
 const char * available_requests[] = {
         "cancel_course",
@@ -10,10 +21,51 @@ const char * available_requests[] = {
 };
 const char* faculty_response = "your request was rejected";
 
+/** A student suggested as a friend, with the number of mutual friends he has with the logged student */
+typedef struct friend_suggestion_t {
+    Student student;
+    int id;
+    int mutual_friends;
+} FriendSuggestion;
+
+/**
+ * The memory used by a breadth-first search over the friends network. it is kept between searches (and grows only when
+ * there are more students), so a search allocates nothing.
+ * a student was visited by the current search if the mark of its slot in the students directory equals the search's
+ * epoch, so the marks never have to be cleared between searches.
+ */
+typedef struct network_search_t {
+    unsigned int* visit_marks; // the epoch of the last search that visited every slot
+    Student* queue; // the visited students, in the order they were visited
+    FriendSuggestion* suggestions; // heap of the best friend suggestions found so far
+    int capacity; // the number of slots visit_marks and queue have room for
+    unsigned int epoch; // the epoch of the last search
+} NetworkSearch;
+
 typedef struct course_manager_t
 {
 Set students;
+StudentDirectory directory; // the students of the set by their id (including the removed ones not reclaimed yet)
 Student logged_student;
+NamePool names; // the names of all the students
+CourseCatalog courses; // the courses of all the students' grades
+CoursePostings postings; // the students of every course, with their best grade in it
+bool lazy_removal; // whether removed students are only marked, and reclaimed later by courseManagerReclaim
+IntSet removed_students; // ids of lazily removed students, hidden from all the commands, not reclaimed yet
+IntSet reclaimed_students; // ids of removed students whose ids are being removed from the other students
+int reclaim_cursor; // the slot of the next student to remove reclaimed_students from, in the current pass
+NetworkSearch network_search; // memory for the searches over the friends network, reused between searches
+FriendComponents components; // the connected components of the friendships graph, by the students' slots
+bool components_dirty; // whether a friendship (or a student) was removed since the components were built
+FriendGraph friend_graph; // snapshot of the friendships graph, by the students' slots
+bool friend_graph_dirty; // whether a friendship (or a student) was added or removed since the snapshot was built
+GradeColumns grade_columns; // column-store mirror of the grades, NULL until an analytics command needs it
+CourseHistograms histograms; // the distribution of the effective grades of every course
+bool histograms_dirty; // whether the histograms could not be updated, and must be built again
+GpaRanking ranking; // the students ordered by their effective average
+bool ranking_dirty; // whether the ranking could not be updated, and must be built again
+int sequence; // the sequence number of the current command, that the versions of the grade sheets are tagged with
+ReportCache reports; // the last rendered reports of the students, by the versions of their grades
 } course_manager_t;
 
 /**
@@ -30,10 +82,164 @@ CourseManager courseManagerCreate() {
         free(course_manager);
         return NULL;
     }
+    course_manager->names = namePoolCreate();
+    if (course_manager->names == NULL) {
+        setDestroy(course_manager->students);
+        free(course_manager);
+        return NULL;
+    }
+    course_manager->courses = courseCatalogCreate();
+    if (course_manager->courses == NULL) {
+        namePoolDestroy(course_manager->names);
+        setDestroy(course_manager->students);
+        free(course_manager);
+        return NULL;
+    }
+    course_manager->postings = coursePostingsCreate();
+    if (course_manager->postings == NULL) {
+        courseCatalogDestroy(course_manager->courses);
+        namePoolDestroy(course_manager->names);
+        setDestroy(course_manager->students);
+        free(course_manager);
+        return NULL;
+    }
+    course_manager->removed_students = intSetCreate();
+    course_manager->reclaimed_students = intSetCreate();
+    course_manager->directory = studentDirectoryCreate();
+    course_manager->components = friendComponentsCreate();
+    course_manager->friend_graph = friendGraphCreate();
+    course_manager->histograms = courseHistogramsCreate();
+    course_manager->ranking = gpaRankingCreate();
+    course_manager->reports = reportCacheCreate(REPORT_CACHE_BUDGET);
+    if (course_manager->removed_students == NULL || course_manager->reclaimed_students == NULL ||
+        course_manager->directory == NULL || course_manager->components == NULL ||
+        course_manager->friend_graph == NULL || course_manager->histograms == NULL ||
+        course_manager->ranking == NULL || course_manager->reports == NULL) {
+        reportCacheDestroy(course_manager->reports);
+        gpaRankingDestroy(course_manager->ranking);
+        courseHistogramsDestroy(course_manager->histograms);
+        friendGraphDestroy(course_manager->friend_graph);
+        friendComponentsDestroy(course_manager->components);
+        studentDirectoryDestroy(course_manager->directory);
+        intSetDestroy(course_manager->removed_students);
+        intSetDestroy(course_manager->reclaimed_students);
+        coursePostingsDestroy(course_manager->postings);
+        courseCatalogDestroy(course_manager->courses);
+        namePoolDestroy(course_manager->names);
+        setDestroy(course_manager->students);
+        free(course_manager);
+        return NULL;
+    }
+    course_manager->lazy_removal = false;
+    course_manager->reclaim_cursor = 0;
+    course_manager->network_search.visit_marks = NULL;
+    course_manager->network_search.queue = NULL;
+    course_manager->network_search.suggestions = NULL;
+    course_manager->network_search.capacity = 0;
+    course_manager->network_search.epoch = 0;
+    course_manager->components_dirty = false;
+    course_manager->friend_graph_dirty = true;
+    course_manager->grade_columns = NULL;
+    course_manager->histograms_dirty = false;
+    course_manager->ranking_dirty = false;
+    course_manager->sequence = 0;
     course_manager->logged_student = NULL;
     return course_manager;
 }
 
+/** The data reclaimStudent passes to removeStudentPosting for every course of the reclaimed student */
+typedef struct student_postings_removal_t {
+    CoursePostings postings;
+    int student_id;
+} student_postings_removal_t;
+
+/**
+ * removeStudentPosting - inner CourseIdVisitor that removes the student from the postings list of the given course
+ * @param course_id - the id of the course
+ * @param context - pointer to the student_postings_removal_t of the removal
+ */
+static void removeStudentPosting(int course_id, void* context) {
+    student_postings_removal_t* removal = context;
+    coursePostingsRemove(removal->postings, course_id, removal->student_id);
+}
+
+/**
+ * removeGradeRow - inner GradeVisitor that removes the given grade from the grades mirror
+ * @param grade - the grade to remove
+ * @param context - the GradeColumns to remove the grade from
+ */
+static void removeGradeRow(Grade grade, void* context) {
+    gradeColumnsRemove(context, grade);
+}
+
+/**
+ * dropGradeColumns - inner function that destroys the grades mirror, after it could not be updated. it is built again
+ * by the next analytics command
+ * @param course_manager - the course manager to drop its mirror
+ */
+static void dropGradeColumns(CourseManager course_manager) {
+    gradeColumnsDestroy(course_manager->grade_columns);
+    course_manager->grade_columns = NULL;
+}
+
+/**
+ * removeEffectiveGrade - inner EffectiveGradeVisitor that removes the given grade from the histogram of its course
+ * @param course_id - the id of the course
+ * @param grade - the effective grade to remove
+ * @param context - the CourseHistograms to remove the grade from
+ */
+static void removeEffectiveGrade(int course_id, int grade, void* context) {
+    courseHistogramsRemove(context, course_id, grade);
+}
+
+/**
+ * reclaimStudent - inner function that removes the given student from the courses' postings and destroys it. its id
+ * must already be removed from the other students' friends and friend requests
+ * @param course_manager - the course manager that has the student
+ * @param student - the student to destroy
+ */
+static void reclaimStudent(CourseManager course_manager, Student student) {
+    student_postings_removal_t removal = {course_manager->postings, studentGetId(student)};
+    studentForEachCourse(student, removeStudentPosting, &removal);
+    studentDirectoryRemove(course_manager->directory, removal.student_id);
+    setRemove(course_manager->students, student);
+}
+
+/**
+ * isStudentRemoved - inner function to check if the student with the given id was lazily removed, and is not
+ * reclaimed yet
+ * @param course_manager - the course manager to check in
+ * @param id - the id of the student
+ * @return true if the student was removed (so it must be hidden), false otherwise
+ */
+static bool isStudentRemoved(CourseManager course_manager, int id) {
+    return intSetIsIn(course_manager->removed_students, id) || intSetIsIn(course_manager->reclaimed_students, id);
+}
+
+/**
+ * reclaimStudentNow - inner function that reclaims the lazily removed student with the given id immediately
+ * @param course_manager - the course manager that has the student
+ * @param id - the id of the removed student
+ */
+static void reclaimStudentNow(CourseManager course_manager, int id) {
+    Student student = studentDirectoryGet(course_manager->directory, id);
+    removeStudentFromFriendsSet(course_manager->students, student);
+    intSetRemove(course_manager->removed_students, id);
+    intSetRemove(course_manager->reclaimed_students, id);
+    reclaimStudent(course_manager, student);
+}
+
+/**
+ * findStudent - inner function that returns the student with the given id, unless it was removed
+ * @param course_manager - the course manager to search the student in
+ * @param id - the id of the student
+ * @return the student with the given id. NULL if there is no such student (or it was removed)
+ */
+static Student findStudent(CourseManager course_manager, int id) {
+    if (isStudentRemoved(course_manager, id)) return NULL;
+    return studentDirectoryGet(course_manager->directory, id);
+}
+
 /**
  * addStudent - adds new student to the system
  * @param course_manager - the course manager to add the student to
@@ -49,15 +255,34 @@ CourseManagerResult addStudent(CourseManager course_manager, int id, char* first
     if (firstName == NULL || lastName == NULL || course_manager == NULL || course_manager->students == NULL) {
         return COURSE_MANAGER_OUT_OF_MEMORY;
     }
+    if (isStudentRemoved(course_manager, id)) {
+        reclaimStudentNow(course_manager, id); // the old student with this id must leave the set first
+    }
     Student student = NULL;
-    StudentResult createResult = studentCreate(id, firstName, lastName, &student);
+    StudentResult createResult = studentCreateWithSharedData(id, firstName, lastName, course_manager->names,
+                                                           course_manager->courses, &student);
     if (createResult == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (createResult == STUDENT_INVALID_PARAMETER) {
         studentDestroy(student);
         return COURSE_MANAGER_INVALID_PARAMETERS;
     }
-    SetResult add_result = setAdd(course_manager->students, (SetElement)student);
-    studentDestroy(student);
+    SetResult add_result = setAddTake(course_manager->students, (SetElement)student);
+    if (add_result != SET_SUCCESS) {
+        studentDestroy(student); // the set did not take the student
+    } else if (studentDirectoryAdd(course_manager->directory, student) != STUDENT_DIRECTORY_OK) {
+        setRemove(course_manager->students, student);
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    } else {
+        course_manager->friend_graph_dirty = true;
+        int slot = studentDirectoryGetSlot(course_manager->directory, id);
+        if (!course_manager->components_dirty &&
+            friendComponentsAdd(course_manager->components, slot) != FRIEND_COMPONENTS_OK) {
+            course_manager->components_dirty = true; // the components will be built again when they are needed
+        }
+        if (!course_manager->ranking_dirty && gpaRankingInsert(course_manager->ranking, id, 0, 0) != GPA_RANKING_OK) {
+            course_manager->ranking_dirty = true; // the ranking will be built again when it is needed
+        }
+    }
     switch(add_result) {
         case SET_ITEM_ALREADY_EXISTS:
             return COURSE_MANAGER_STUDENT_ALREADY_EXISTS;
@@ -81,19 +306,114 @@ CourseManagerResult removeStudent(CourseManager  course_manager, int id) {
     if (course_manager == NULL || course_manager->students == NULL) {
         return COURSE_MANAGER_OUT_OF_MEMORY;
     }
-    Student student = getStudentFromSet(course_manager->students, id);
+    Student student = findStudent(course_manager, id);
     if (student == NULL) {
         return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
     }
-    removeStudentFromFriendsSet(course_manager->students, student);
     if (course_manager->logged_student != NULL && studentCompare(course_manager->logged_student, student) == 0) {
         logOutStudent(course_manager);
     }
-    SetResult removeResult = setRemove(course_manager->students, student);
-    if (removeResult == SET_ITEM_DOES_NOT_EXIST) return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
+    course_manager->components_dirty = true; // the student's component may be split
+    course_manager->friend_graph_dirty = true;
+    // a lazily removed student is only hidden. if it can not be marked - remove it immediately
+    bool hidden = course_manager->lazy_removal && intSetAdd(course_manager->removed_students, id) == INT_SET_OK;
+    if (hidden) {
+        // going over the whole history of the student would undo the constant time removal. the grades mirror and the
+        // histograms are built again (without the hidden student) when they are needed
+        dropGradeColumns(course_manager);
+        course_manager->histograms_dirty = true;
+    } else {
+        if (course_manager->grade_columns != NULL) {
+            studentForEachGrade(student, removeGradeRow, course_manager->grade_columns);
+        }
+        if (!course_manager->histograms_dirty) {
+            studentForEachEffectiveGrade(student, removeEffectiveGrade, course_manager->histograms);
+        }
+    }
+    int points_x2 = 0, grade_sum_x2 = 0;
+    studentGetEffectiveTotals(student, &points_x2, &grade_sum_x2);
+    gpaRankingRemove(course_manager->ranking, id, grade_sum_x2, points_x2);
+    reportCacheRemoveStudent(course_manager->reports, id); // a new student with this id starts from the first version
+    if (hidden) return COURSE_MANAGER_OK;
+    removeStudentFromFriendsSet(course_manager->students, student);
+    reclaimStudent(course_manager, student);
     return COURSE_MANAGER_OK;
 }
 
+/**
+ * courseManagerSetLazyRemoval - sets whether removeStudent removes students lazily. a lazily removed student is only
+ * marked as removed (and hidden from all the commands), and its memory is reclaimed later by courseManagerReclaim.
+ * lazy removal is off for a new course manager.
+ * @param course_manager - the course manager to set
+ * @param lazy_removal - true to remove students lazily, false to remove them immediately
+ */
+void courseManagerSetLazyRemoval(CourseManager course_manager, bool lazy_removal) {
+    if (course_manager == NULL) return;
+    course_manager->lazy_removal = lazy_removal;
+}
+
+/**
+ * courseManagerReclaim - does a bounded slice of the work of reclaiming the lazily removed students: removing their
+ * ids from the other students' friends and friend requests, and then destroying them.
+ * meant to be called between commands, until it returns true.
+ * every pass goes over the slots of the students directory once (in slices), removing the ids of the students that
+ * were removed when it started. students that are removed during a pass are left for the next one. the slots are
+ * walked from a cursor, so a slice costs its budget and never goes over the students set from its start.
+ * a removed student is then released over as many slices as its history needs (see studentRelease), and destroyed.
+ * @param course_manager - the course manager to reclaim its removed students
+ * @param budget - the work to do in this slice (must be positive): one unit for every slot (a student or a free slot)
+ * that is gone over, and one for every version, grade and course of a removed student that is released. the last step
+ * of a slice may go over the budget by the number of semesters of one version
+ * @return true if there are no removed students left to reclaim, false otherwise
+ */
+bool courseManagerReclaim(CourseManager course_manager, int budget) {
+    if (course_manager == NULL) return true;
+    if (intSetGetSize(course_manager->reclaimed_students) == 0) {
+        if (intSetGetSize(course_manager->removed_students) == 0) return true;
+        // start a new pass with the students that are removed so far
+        IntSet pass_students = course_manager->removed_students;
+        course_manager->removed_students = course_manager->reclaimed_students;
+        course_manager->reclaimed_students = pass_students;
+        course_manager->reclaim_cursor = 0;
+    }
+    // a student added during the pass into a slot before the cursor can not know the removed (hidden) students
+    int slot_count = studentDirectoryGetSlotCount(course_manager->directory);
+    for (; course_manager->reclaim_cursor < slot_count; course_manager->reclaim_cursor++) {
+        if (budget == 0) return false;
+        Student student = studentDirectoryGetBySlot(course_manager->directory, course_manager->reclaim_cursor);
+        if (student != NULL) {
+            INT_SET_FOREACH(removed_id, course_manager->reclaimed_students) {
+                studentForgetStudent(student, removed_id);
+            }
+        }
+        budget--;
+    }
+    // the removed ids are gone from all the students - the removed students can be released, and then destroyed
+    while (budget > 0 && intSetGetSize(course_manager->reclaimed_students) > 0) {
+        int removed_id = intSetGetElements(course_manager->reclaimed_students)[0];
+        Student student = studentDirectoryGet(course_manager->directory, removed_id);
+        student_postings_removal_t removal = {course_manager->postings, removed_id};
+        if (!studentRelease(student, &budget, removeStudentPosting, &removal)) return false;
+        intSetRemove(course_manager->reclaimed_students, removed_id);
+        reclaimStudent(course_manager, student); // has no courses left, so it is destroyed in constant time
+        budget--;
+    }
+    return intSetGetSize(course_manager->reclaimed_students) == 0 &&
+           intSetGetSize(course_manager->removed_students) == 0;
+}
+
+/**
+ * courseManagerBeginCommand - advances the sequence number of the commands. the grade changes of the command are
+ * recorded in the versions of the grade sheets with the new number, so reports can be printed as of any command.
+ * meant to be called before every command.
+ * @param course_manager - the course manager
+ * @return the sequence number of the new command (the first command is 1). -1 if course_manager is NULL
+ */
+int courseManagerBeginCommand(CourseManager course_manager) {
+    if (course_manager == NULL) return -1;
+    return ++course_manager->sequence;
+}
+
 /**
  * logInStudent - log in student with the given id
  * @param course_manager - the course manager that the student is logging in to
@@ -107,7 +427,7 @@ CourseManagerResult logInStudent(CourseManager course_manager, int id) {
         return COURSE_MANAGER_OUT_OF_MEMORY;
     }
     if (course_manager->logged_student != NULL) return COURSE_MANAGER_ALREADY_LOGGED_IN;
-    Student student = getStudentFromSet(course_manager->students, id);
+    Student student = findStudent(course_manager, id);
     if (student == NULL) {
         return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
     }
@@ -151,7 +471,7 @@ CourseManagerResult sendFriendRequest(CourseManager course_manager, int id) {
     if (course_manager->logged_student == NULL) {
         return COURSE_MANAGER_NOT_LOGGED_IN;
     }
-    Student friend = getStudentFromSet(course_manager->students, id);
+    Student friend = findStudent(course_manager, id);
     if (friend == NULL) {
         return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
     }
@@ -182,7 +502,7 @@ CourseManagerResult handleFriendRequest(CourseManager course_manager, int otherI
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
 
     Student logged_in = course_manager->logged_student;
-    Student friend = getStudentFromSet(course_manager->students, otherId);
+    Student friend = findStudent(course_manager, otherId);
     if (friend == NULL) return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
     if (isFriend(logged_in, friend)) return COURSE_MANAGER_ALREADY_FRIEND;
     if (isThereFriendRequest(logged_in, friend) == false) return COURSE_MANAGER_NOT_REQUESTED;
@@ -198,6 +518,12 @@ CourseManagerResult handleFriendRequest(CourseManager course_manager, int otherI
         }
         // remove the logged student's request from the friend's requests list if exist
         removeFriendRequest(logged_in, friend);
+        course_manager->friend_graph_dirty = true;
+        if (!course_manager->components_dirty) { // both students are members, so uniting can not fail
+            int logged_slot = studentDirectoryGetSlot(course_manager->directory, studentGetId(logged_in));
+            int friend_slot = studentDirectoryGetSlot(course_manager->directory, otherId);
+            friendComponentsUnite(course_manager->components, logged_slot, friend_slot);
+        }
     }
     // in any case (reject or accept) - remove the friend request from the logged student
     removeFriendRequest(friend, logged_in);
@@ -218,12 +544,71 @@ CourseManagerResult unFriend(CourseManager course_manager, int otherId) {
     if (course_manager == NULL || course_manager->students == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
 
-    Student friend = getStudentFromSet(course_manager->students, otherId);
+    Student friend = findStudent(course_manager, otherId);
     if (friend == NULL) return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
     Student logged_in = course_manager->logged_student;
     if (isFriend(logged_in, friend) == false || studentCompare(logged_in, friend) == 0) return COURSE_MANAGER_NOT_FRIEND;
     removeFriend(logged_in, friend);
     removeFriend(friend, logged_in); // remove both ways
+    course_manager->components_dirty = true; // their component may be split
+    course_manager->friend_graph_dirty = true;
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * updateCourseHistogram - inner function that moves an effective grade of the given course in its histogram, after a
+ * grade of the course was changed. if the histograms can not be updated, they are built again when they are needed
+ * @param course_manager - the course manager to update its histograms
+ * @param course_id - the id of the course of the changed grade
+ * @param old_grade - the effective grade the changed grade counted in before the change (-1 if there was none)
+ * @param new_grade - the effective grade the changed grade counts in after the change (-1 if there is none)
+ */
+static void updateCourseHistogram(CourseManager course_manager, int course_id, int old_grade, int new_grade) {
+    if (course_manager->histograms_dirty || old_grade == new_grade) return;
+    if (old_grade != -1) {
+        courseHistogramsRemove(course_manager->histograms, course_id, old_grade);
+    }
+    if (new_grade != -1 &&
+        courseHistogramsAdd(course_manager->histograms, course_id, new_grade) != COURSE_HISTOGRAMS_OK) {
+        course_manager->histograms_dirty = true;
+    }
+}
+
+/**
+ * updateStudentRanking - inner function that moves the given student in the ranking, after his grades were changed. if
+ * the ranking can not be updated, it is built again when it is needed
+ * @param course_manager - the course manager to update its ranking
+ * @param student - the student whose grades were changed
+ * @param old_points_x2 - the effective points of the student before the change (multiple by 2)
+ * @param old_grade_sum_x2 - the sum of the effective grades of the student before the change
+ */
+static void updateStudentRanking(CourseManager course_manager, Student student, int old_points_x2,
+                                 int old_grade_sum_x2) {
+    int points_x2 = 0, grade_sum_x2 = 0;
+    studentGetEffectiveTotals(student, &points_x2, &grade_sum_x2);
+    if (course_manager->ranking_dirty || (points_x2 == old_points_x2 && grade_sum_x2 == old_grade_sum_x2)) return;
+    int id = studentGetId(student);
+    gpaRankingRemove(course_manager->ranking, id, old_grade_sum_x2, old_points_x2);
+    if (gpaRankingInsert(course_manager->ranking, id, grade_sum_x2, points_x2) != GPA_RANKING_OK) {
+        course_manager->ranking_dirty = true;
+    }
+}
+
+/**
+ * recordStudentVersion - inner function that records the given semester of the given student as a new version of his
+ * grade sheet, tagged with the sequence number of the current command
+ * @param course_manager - the course manager of the current command
+ * @param student - the student whose grades were changed
+ * @param semester - the semester of the changed grades
+ * @return
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error (the change is kept, and the next version of the student
+ * records his whole sheet)
+ * COURSE_MANAGER_OK - otherwise
+ */
+static CourseManagerResult recordStudentVersion(CourseManager course_manager, Student student, int semester) {
+    if (studentRecordVersion(student, course_manager->sequence, semester) == STUDENT_OUT_OF_MEMORY) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
     return COURSE_MANAGER_OK;
 }
 
@@ -246,10 +631,44 @@ CourseManagerResult addGrade(CourseManager course_manager, int semester, int cou
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
     Student logged_in = course_manager->logged_student;
 
+    int old_effective_grade = studentGetEffectiveGrade(logged_in, course_id, semester);
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    studentGetEffectiveTotals(logged_in, &old_points_x2, &old_grade_sum_x2);
     StudentResult add_result = studentAddGrade(logged_in, semester, course_id, points, grade);
     if (add_result == STUDENT_OUT_OF_MEMORY || add_result == STUDENT_NULL_ARGUMENT) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (add_result == STUDENT_INVALID_PARAMETER) return COURSE_MANAGER_INVALID_PARAMETERS;
-    return COURSE_MANAGER_OK;
+    CoursePostingsResult postings_result = coursePostingsSet(course_manager->postings, course_id,
+                                                             studentGetId(logged_in),
+                                                             studentGetBestGradeInCourse(logged_in, course_id));
+    if (postings_result != COURSE_POSTINGS_OK) {
+        studentRemoveGrade(logged_in, semester, course_id); // the grade that was just added is the last one
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->grade_columns != NULL &&
+        gradeColumnsAppend(course_manager->grade_columns, studentGetId(logged_in),
+                           studentGetLastGradeObject(logged_in, semester, course_id)) != GRADE_COLUMNS_OK) {
+        dropGradeColumns(course_manager); // the command does not fail because of the optional mirror
+    }
+    updateCourseHistogram(course_manager, course_id, old_effective_grade,
+                          studentGetEffectiveGrade(logged_in, course_id, semester));
+    updateStudentRanking(course_manager, logged_in, old_points_x2, old_grade_sum_x2);
+    return recordStudentVersion(course_manager, logged_in, semester);
+}
+
+/**
+ * updateStudentPosting - inner function that updates the postings list of the given course after the grades of the
+ * given student in it were changed
+ * @param course_manager - the course manager that keeps the postings
+ * @param student - the student whose grades were changed
+ * @param course_id - the id of the course of the changed grades
+ */
+static void updateStudentPosting(CourseManager course_manager, Student student, int course_id) {
+    int best_grade = studentGetBestGradeInCourse(student, course_id);
+    if (best_grade == -1) { // the student has no grades in the course anymore
+        coursePostingsRemove(course_manager->postings, course_id, studentGetId(student));
+    } else { // the student is already in the postings list, so it can not fail
+        coursePostingsSet(course_manager->postings, course_id, studentGetId(student), best_grade);
+    }
 }
 
 /**
@@ -264,10 +683,21 @@ CourseManagerResult addGrade(CourseManager course_manager, int semester, int cou
 CourseManagerResult removeGrade(CourseManager course_manager, int semester, int course_id) {
     if (course_manager == NULL || course_manager->students == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (course_manager->grade_columns != NULL) { // before the grade is destroyed (nothing is done if it does not exist)
+        gradeColumnsRemove(course_manager->grade_columns,
+                           studentGetLastGradeObject(course_manager->logged_student, semester, course_id));
+    }
+    int old_effective_grade = studentGetEffectiveGrade(course_manager->logged_student, course_id, semester);
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    studentGetEffectiveTotals(course_manager->logged_student, &old_points_x2, &old_grade_sum_x2);
     StudentResult remove_result = studentRemoveGrade(course_manager->logged_student, semester, course_id);
     if (remove_result == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (remove_result == STUDENT_COURSE_DOES_NOT_EXIST) return COURSE_MANAGER_COURSE_DOES_NOT_EXIST;
-    return COURSE_MANAGER_OK;
+    updateStudentPosting(course_manager, course_manager->logged_student, course_id);
+    updateCourseHistogram(course_manager, course_id, old_effective_grade,
+                          studentGetEffectiveGrade(course_manager->logged_student, course_id, semester));
+    updateStudentRanking(course_manager, course_manager->logged_student, old_points_x2, old_grade_sum_x2);
+    return recordStudentVersion(course_manager, course_manager->logged_student, semester);
 }
 
 /**
@@ -284,14 +714,47 @@ CourseManagerResult removeGrade(CourseManager course_manager, int semester, int
 CourseManagerResult updateGrade(CourseManager course_manager, int course_id, int new_grade) {
     if (course_manager == NULL || course_manager->students == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    int semester = studentGetCourseLastSemester(course_manager->logged_student, course_id);
+    int old_effective_grade = studentGetEffectiveGrade(course_manager->logged_student, course_id, semester);
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    studentGetEffectiveTotals(course_manager->logged_student, &old_points_x2, &old_grade_sum_x2);
     StudentResult update_result = studentUpdateGrade(course_manager->logged_student, course_id, new_grade);
     if (update_result == STUDENT_COURSE_DOES_NOT_EXIST) return COURSE_MANAGER_COURSE_DOES_NOT_EXIST;
     if (update_result == STUDENT_INVALID_PARAMETER) return COURSE_MANAGER_INVALID_PARAMETERS;
-    return COURSE_MANAGER_OK;
+    updateStudentPosting(course_manager, course_manager->logged_student, course_id);
+    if (course_manager->grade_columns != NULL) {
+        gradeColumnsUpdate(course_manager->grade_columns,
+                           studentGetLastGradeObject(course_manager->logged_student, semester, course_id));
+    }
+    updateCourseHistogram(course_manager, course_id, old_effective_grade,
+                          studentGetEffectiveGrade(course_manager->logged_student, course_id, semester));
+    updateStudentRanking(course_manager, course_manager->logged_student, old_points_x2, old_grade_sum_x2);
+    return recordStudentVersion(course_manager, course_manager->logged_student, semester);
+}
+
+/**
+ * renderFullReport - inner ReportRenderer that prints the full report of the given student
+ * @param student - the student to print his report
+ * @param output_channel - the channel to print the report to
+ * @return false if there was a memory error, true otherwise
+ */
+static bool renderFullReport(void* student, FILE* output_channel) {
+    return studentPrintFullReport(student, output_channel) != STUDENT_OUT_OF_MEMORY;
+}
+
+/**
+ * renderCleanReport - inner ReportRenderer that prints the clean report of the given student
+ * @param student - the student to print his report
+ * @param output_channel - the channel to print the report to
+ * @return false if there was a memory error, true otherwise
+ */
+static bool renderCleanReport(void* student, FILE* output_channel) {
+    return studentPrintCleanReport(student, output_channel) != STUDENT_OUT_OF_MEMORY;
 }
 
 /**
- * printFullReport - prints full grades report for the logged student into the given output channel
+ * printFullReport - prints full grades report for the logged student into the given output channel. the report is
+ * rendered once for every version of the student's grades, and printed again from the reports cache
  * @param course_manager - the course manager that the student is logged to
  * @param output_channel - the channel to print the report to
  * @return
@@ -300,15 +763,19 @@ CourseManagerResult updateGrade(CourseManager course_manager, int course_id, int
 CourseManagerResult printFullReport(CourseManager course_manager, FILE* output_channel) {
     if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
-    StudentResult print_result = studentPrintFullReport(course_manager->logged_student, output_channel);
-    if (print_result == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
+    Student student = course_manager->logged_student;
+    ReportCacheResult print_result = reportCachePrint(course_manager->reports, studentGetId(student),
+                                                      REPORT_KIND_FULL, studentGetVersion(student),
+                                                      renderFullReport, student, output_channel);
+    if (print_result != REPORT_CACHE_OK) return COURSE_MANAGER_OUT_OF_MEMORY;
     return COURSE_MANAGER_OK;
 }
 
 /**
  * printCleanReport - prints grades report of the logged student containing the effective grades of all the student's
  * courses, sorted by course id (and also by semester number for sport courses with the same id).
- * the print will be to the given output channel.
+ * the print will be to the given output channel. the report is rendered once for every version of the student's
+ * grades, and printed again from the reports cache
  * @param course_manager - the course manager that the student is logged to
  * @param output_channel - the channel to print the report to
  * @return
@@ -317,11 +784,101 @@ CourseManagerResult printFullReport(CourseManager course_manager, FILE* output_c
 CourseManagerResult printCleanReport(CourseManager course_manager, FILE* output_channel) {
     if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
-    StudentResult print_result = studentPrintCleanReport(course_manager->logged_student, output_channel);
+    Student student = course_manager->logged_student;
+    ReportCacheResult print_result = reportCachePrint(course_manager->reports, studentGetId(student),
+                                                      REPORT_KIND_CLEAN, studentGetVersion(student),
+                                                      renderCleanReport, student, output_channel);
+    if (print_result != REPORT_CACHE_OK) return COURSE_MANAGER_OUT_OF_MEMORY;
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printFullReportAsOf - prints the full grades report of the logged student as his grade sheet was after the command
+ * with the given sequence number, from the recorded versions of the sheet
+ * @param course_manager - the course manager that the student is logged to
+ * @param sequence - the sequence number of the command (between 0, before the first command, and the current command)
+ * @param output_channel - the channel to print the report to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the sequence number is negative or after the current command
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printFullReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (sequence < 0 || sequence > course_manager->sequence) return COURSE_MANAGER_INVALID_PARAMETERS;
+    StudentResult print_result = studentPrintFullReportAsOf(course_manager->logged_student, sequence, output_channel);
     if (print_result == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
     return COURSE_MANAGER_OK;
 }
 
+/**
+ * printCleanReportAsOf - prints the clean grades report of the logged student as his grade sheet was after the
+ * command with the given sequence number, from the recorded versions of the sheet
+ * @param course_manager - the course manager that the student is logged to
+ * @param sequence - the sequence number of the command (between 0, before the first command, and the current command)
+ * @param output_channel - the channel to print the report to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the sequence number is negative or after the current command
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCleanReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (sequence < 0 || sequence > course_manager->sequence) return COURSE_MANAGER_INVALID_PARAMETERS;
+    StudentResult print_result = studentPrintCleanReportAsOf(course_manager->logged_student, sequence, output_channel);
+    if (print_result == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printProgression - prints the cumulative effective points and average of the logged student after every semester he
+ * has grades in
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the progression to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printProgression(CourseManager course_manager, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    StudentResult print_result = studentPrintProgression(course_manager->logged_student, output_channel);
+    if (print_result == STUDENT_OUT_OF_MEMORY) return COURSE_MANAGER_OUT_OF_MEMORY;
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printWhatIf - prints the clean sheet summary the logged student would have if he got the grades of the given
+ * scenario in a new semester. the scenario is evaluated against the effective totals of the student, so it takes
+ * O(changes), and the sheet of the student is not changed
+ * @param course_manager - the course manager that the student is logged to
+ * @param scenario - the hypothetical grades
+ * @param output_channel - the channel to print the summary to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if a change with invalid parameters was added to the scenario
+ */
+CourseManagerResult printWhatIf(CourseManager course_manager, WhatIf scenario, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    int points_x2 = 0, grade_sum_x2 = 0;
+    if (studentGetWhatIfTotals(course_manager->logged_student, scenario, &points_x2, &grade_sum_x2) != STUDENT_OK) {
+        return COURSE_MANAGER_INVALID_PARAMETERS;
+    }
+    mtmPrintCleanSummary(output_channel, points_x2, grade_sum_x2);
+    return COURSE_MANAGER_OK;
+}
+
 /**
  * printBestGrades - prints the best effective sheet grades of the logged student. the amount of grades printed is
  * given (must be positive number)
@@ -371,130 +928,696 @@ CourseManagerResult printWorstGrades(CourseManager course_manager, int amount, F
 }
 
 /**
- * insertGradeIntoArrayIfHigher - checks if the given grade if higher than at least one of the grades inside the array.
- * if it is - insert it to the array, sorted, and insert the student into the same index in the students array.
- * @param array - the array to insert the grade into
- * @param length - the length of both arrays
- * @param grade - the grade to insert
- */
-static void insertGradeIntoArrayIfHigher(int* grades, int student_best_grade, Student** students_array,
-                                         Student student, int length) {
-    assert(grades != NULL && students_array != NULL && student != NULL);
-    for (int i=length - 1; i >= 0; i--) {
-        if (*students_array[i] == NULL) {
-            grades[i] = student_best_grade;
-            *students_array[i] = student;
-            break;
-        } else if (student_best_grade > grades[i] ||
-                ((student_best_grade == grades[i]) && (studentCompare(student, *students_array[i]) == -1))) {
-            for (int j = 0; j < i; j++) {
-                grades[j] = grades[j + 1];
-                if (*students_array[j+1] != NULL) {
-                    *students_array[j] = *students_array[j+1];
-                }
-            }
-            grades[i] = student_best_grade;
-            *students_array[i] = student;
-            break;
+ * printReferenceSources - print the names of the logged student's friends who had the best grades in the course with
+ * the given course id. the amount of names printed is given (must be positive number).
+ * the course's leaderboard is already sorted from the best grade to the worst one, so it is visited in order until
+ * enough friends are found in it.
+ * @param course_manager  - the course manager that the student is logged to
+ * @param course_id - the id of the course to search reference sources for
+ * @param amount - the number of friends' names to print
+ * @param output_channel - the channel to print the names to
+ * @return
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the amount given is not valid
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ */
+CourseManagerResult printReferenceSources(CourseManager course_manager, int course_id,int amount,FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (amount < 1) return COURSE_MANAGER_INVALID_PARAMETERS;
+    int printed = 0;
+    COURSE_RANK_FOREACH(rank, course_manager->postings, course_id) {
+        if (printed == amount) break;
+        int student_id = courseRankGetPosting(rank)->student_id;
+        if (isFriendById(course_manager->logged_student, student_id) && !isStudentRemoved(course_manager, student_id)) {
+            studentPrintName(studentDirectoryGet(course_manager->directory, student_id), output_channel);
+            printed++;
         }
     }
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * networkSearchReserve - inner function that makes sure the network search has room for every slot of the students
+ * directory
+ * @return false if there was a memory error (the search memory is not changed), true otherwise
+ */
+static bool networkSearchReserve(NetworkSearch* search, int slot_count) {
+    if (slot_count <= search->capacity) return true;
+    int new_capacity = (search->capacity == 0) ? slot_count : search->capacity;
+    while (new_capacity < slot_count) {
+        new_capacity *= 2;
+    }
+    Student* new_queue = (Student*) realloc(search->queue, sizeof(Student) * new_capacity);
+    if (new_queue == NULL) return false;
+    search->queue = new_queue;
+    FriendSuggestion* new_suggestions = (FriendSuggestion*) realloc(search->suggestions,
+                                                                    sizeof(FriendSuggestion) * new_capacity);
+    if (new_suggestions == NULL) return false;
+    search->suggestions = new_suggestions;
+    unsigned int* new_marks = (unsigned int*) realloc(search->visit_marks, sizeof(unsigned int) * new_capacity);
+    if (new_marks == NULL) return false; // the bigger arrays are kept, they are still valid
+    for (int i = search->capacity; i < new_capacity; i++) {
+        new_marks[i] = 0; // never visited
+    }
+    search->visit_marks = new_marks;
+    search->capacity = new_capacity;
+    return true;
+}
+
+/** The state of a breadth-first search over the friends network, passed to visitFriend */
+typedef struct network_visit_t {
+    CourseManager course_manager;
+    int queue_size; // the number of students visited so far
+} network_visit_t;
+
+/**
+ * visitFriend - inner StudentIdVisitor that visits the friend with the given id, unless it was already visited by the
+ * current search (or it was removed)
+ * @param id - the id of the friend
+ * @param context - pointer to the network_visit_t of the search
+ */
+static void visitFriend(int id, void* context) {
+    network_visit_t* visit = context;
+    CourseManager course_manager = visit->course_manager;
+    NetworkSearch* search = &course_manager->network_search;
+    int slot = studentDirectoryGetSlot(course_manager->directory, id);
+    if (slot == -1 || search->visit_marks[slot] == search->epoch || isStudentRemoved(course_manager, id)) return;
+    search->visit_marks[slot] = search->epoch;
+    search->queue[visit->queue_size++] = studentDirectoryGet(course_manager->directory, id);
 }
 
 /**
- * courseManagerPrintFriendsArray - prints the names of the students in the given array, from last one to the first one.
- * stop printing if reaching NULL.
- * @param best_graded_friends - the array of students to print
- * @param length - the length of the array
- * @param output_channel - the output channel to print to
+ * searchNetwork - inner function that marks all the students who are at most depth friendships away from the given
+ * student (including himself) as visited by a new search. the visited students are left in the search's queue, in the
+ * order of their distance from the student (the student himself first)
+ * @param course_manager - the course manager of the students
+ * @param student - the student to start from
+ * @param depth - the maximal number of friendships between the student and the visited students
+ * @return the number of visited students. -1 if there was a memory error
  */
-static void courseManagerPrintFriendsArray(Student** best_graded_friends, int length, FILE* output_channel) {
-    assert(best_graded_friends != NULL && output_channel != NULL);
-    for (int i=length - 1; i >= 0; i--) {
-        if (*best_graded_friends[i] == NULL) {
-            break;
+static int searchNetwork(CourseManager course_manager, Student student, int depth) {
+    NetworkSearch* search = &course_manager->network_search;
+    if (!networkSearchReserve(search, studentDirectoryGetSlotCount(course_manager->directory))) return -1;
+    search->epoch++;
+    if (search->epoch == 0) { // the epochs wrapped around - clear the old marks, so they can not be taken as new
+        for (int i = 0; i < search->capacity; i++) {
+            search->visit_marks[i] = 0;
         }
-        studentPrintName(*best_graded_friends[i], output_channel);
+        search->epoch = 1;
     }
+    network_visit_t visit = {course_manager, 0};
+    visitFriend(studentGetId(student), &visit);
+    int level_start = 0;
+    for (int level = 0; level < depth && level_start < visit.queue_size; level++) {
+        int level_end = visit.queue_size;
+        for (int i = level_start; i < level_end; i++) {
+            studentForEachFriend(search->queue[i], visitFriend, &visit);
+        }
+        level_start = level_end;
+    }
+    return visit.queue_size;
 }
 
 /**
- * getFriendsWithBestGrades - inner function that searches the logged student's friends and returns an array in the
- * given length of the friends with the best grade in the course with the given id (sorted from best to least good, from
- * top to bottom)
- * @param course_manager - the course manager that the student is logged to
- * @param course_id - the id of the course to search friends grade
- * @param amount - the length of the array
- * @param friends_with_best_grades - pointer to the array of students to return the result in
+ * isVisitedByNetworkSearch - inner function to check if the student with the given id was visited by the last search
+ * over the friends network
+ */
+static bool isVisitedByNetworkSearch(CourseManager course_manager, int id) {
+    int slot = studentDirectoryGetSlot(course_manager->directory, id);
+    return slot != -1 && course_manager->network_search.visit_marks[slot] == course_manager->network_search.epoch;
+}
+
+/**
+ * printReferenceNetwork - print the names of the students in the logged student's friends network who had the best
+ * grades in the course with the given course id. the network has all the students that are at most depth friendships
+ * away from the logged student (not including himself), so depth 1 is the same as printReferenceSources.
+ * the network is marked by a breadth-first search, and then the course's leaderboard is visited in order until enough
+ * students of the network are found in it.
+ * @param course_manager  - the course manager that the student is logged to
+ * @param course_id - the id of the course to search reference sources for
+ * @param amount - the number of names to print (must be positive number)
+ * @param depth - the maximal number of friendships between the logged student and the printed students (must be
+ * positive number)
+ * @param output_channel - the channel to print the names to
  * @return
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the amount or the depth given is not valid
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
  * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
- * COURSE_OK - otherwise
- */
-static CourseManagerResult getFriendsWithBestGrades(CourseManager course_manager, int course_id, int length,
-                                                    Student** friends_with_best_grades) {
-    int current_friend_best_grade;
-    int* best_grades = (int*)malloc(sizeof(int) * length);
-    if (best_grades == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
-    for (int i = 0; i < length; i++) {
-        best_grades[i] = -1;
-    }
-    Set friends = studentGetStudentFriends(course_manager->logged_student);
-    if (friends == NULL) {
-        free(best_grades);
+ */
+CourseManagerResult printReferenceNetwork(CourseManager course_manager, int course_id, int amount, int depth,
+                                          FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
         return COURSE_MANAGER_OUT_OF_MEMORY;
     }
-    Student current_friend;
-    SET_FOREACH(int*, current_friend_id, friends) {
-        current_friend = getStudentFromSet(course_manager->students, *current_friend_id);
-        current_friend_best_grade = studentGetBestGradeInCourse(current_friend, course_id);
-        if (current_friend_best_grade != -1) { // -1 mean there is not grade for this student in this course
-            insertGradeIntoArrayIfHigher(best_grades, current_friend_best_grade, friends_with_best_grades, current_friend,
-                                         length);
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (amount < 1 || depth < 1) return COURSE_MANAGER_INVALID_PARAMETERS;
+    if (searchNetwork(course_manager, course_manager->logged_student, depth) == -1) return COURSE_MANAGER_OUT_OF_MEMORY;
+    int logged_id = studentGetId(course_manager->logged_student);
+    int printed = 0;
+    COURSE_RANK_FOREACH(rank, course_manager->postings, course_id) {
+        if (printed == amount) break;
+        int student_id = courseRankGetPosting(rank)->student_id;
+        if (student_id != logged_id && isVisitedByNetworkSearch(course_manager, student_id)) {
+            studentPrintName(studentDirectoryGet(course_manager->directory, student_id), output_channel);
+            printed++;
         }
     }
-    free(best_grades);
-    setDestroy(friends);
     return COURSE_MANAGER_OK;
 }
 
+/** The data printMutualFriends passes to printMutualFriend for every mutual friend */
+typedef struct mutual_friends_print_t {
+    CourseManager course_manager;
+    FILE* output_channel;
+} mutual_friends_print_t;
+
 /**
- * printReferenceSources - print the names of the logged student's friends who had the best grades in the course with
- * the given course id. the amount of names printed is given (must be positive number).
- * @param course_manager  - the course manager that the student is logged to
- * @param course_id - the id of the course to search reference sources for
- * @param amount - the number of friends' names to print
+ * printMutualFriend - inner StudentIdVisitor that prints the name of the mutual friend with the given id (unless he
+ * was removed)
+ * @param id - the id of the mutual friend
+ * @param context - pointer to the mutual_friends_print_t of the print
+ */
+static void printMutualFriend(int id, void* context) {
+    mutual_friends_print_t* print = context;
+    if (isStudentRemoved(print->course_manager, id)) return;
+    studentPrintName(studentDirectoryGet(print->course_manager->directory, id), print->output_channel);
+}
+
+/**
+ * printMutualFriends - print the names of the students who are friends of both the logged student and the student with
+ * the given id, sorted by their ids
+ * @param course_manager - the course manager that the student is logged to
+ * @param otherId - the id of the other student
  * @param output_channel - the channel to print the names to
  * @return
- * COURSE_MANAGER_INVALID_PARAMETERS - if the amount given is not valid
  * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_STUDENT_DOES_NOT_EXIST - if student with given id does not exist in the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the given id is the id of the logged student
  */
-CourseManagerResult printReferenceSources(CourseManager course_manager, int course_id,int amount,FILE* output_channel) {
+CourseManagerResult printMutualFriends(CourseManager course_manager, int otherId, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    Student other = findStudent(course_manager, otherId);
+    if (other == NULL) return COURSE_MANAGER_STUDENT_DOES_NOT_EXIST;
+    if (other == course_manager->logged_student) return COURSE_MANAGER_INVALID_PARAMETERS;
+    mutual_friends_print_t print = {course_manager, output_channel};
+    studentForEachMutualFriend(course_manager->logged_student, other, printMutualFriend, &print);
+    return COURSE_MANAGER_OK;
+}
+
+/** The data printFriendSuggestions passes to countMutualFriend for every mutual friend of a suggested student */
+typedef struct mutual_friends_count_t {
+    CourseManager course_manager;
+    int count;
+} mutual_friends_count_t;
+
+/**
+ * countMutualFriend - inner StudentIdVisitor that counts the mutual friend with the given id (unless he was removed)
+ * @param id - the id of the mutual friend
+ * @param context - pointer to the mutual_friends_count_t of the count
+ */
+static void countMutualFriend(int id, void* context) {
+    mutual_friends_count_t* count = context;
+    if (!isStudentRemoved(count->course_manager, id)) {
+        count->count++;
+    }
+}
+
+/**
+ * isWorseSuggestion - inner function to check if the first suggestion should be printed after the second one
+ */
+static bool isWorseSuggestion(FriendSuggestion* suggestion1, FriendSuggestion* suggestion2) {
+    return suggestion1->mutual_friends < suggestion2->mutual_friends ||
+           (suggestion1->mutual_friends == suggestion2->mutual_friends && suggestion1->id > suggestion2->id);
+}
+
+/**
+ * siftDownSuggestion - inner function that moves the suggestion at the given index down the heap (where the worst
+ * suggestion is at the root), until it is not worse than its children
+ */
+static void siftDownSuggestion(FriendSuggestion* heap, int size, int index) {
+    while (true) {
+        int worst = index, left = 2 * index + 1, right = 2 * index + 2;
+        if (left < size && isWorseSuggestion(&heap[left], &heap[worst])) worst = left;
+        if (right < size && isWorseSuggestion(&heap[right], &heap[worst])) worst = right;
+        if (worst == index) return;
+        FriendSuggestion temp = heap[index];
+        heap[index] = heap[worst];
+        heap[worst] = temp;
+        index = worst;
+    }
+}
+
+/**
+ * siftUpSuggestion - inner function that moves the suggestion at the given index up the heap (where the worst
+ * suggestion is at the root), until it is not worse than its parent
+ */
+static void siftUpSuggestion(FriendSuggestion* heap, int index) {
+    while (index > 0 && isWorseSuggestion(&heap[index], &heap[(index - 1) / 2])) {
+        FriendSuggestion temp = heap[index];
+        heap[index] = heap[(index - 1) / 2];
+        heap[(index - 1) / 2] = temp;
+        index = (index - 1) / 2;
+    }
+}
+
+/**
+ * printFriendSuggestions - print the names of the students who are not friends of the logged student, but have the
+ * most mutual friends with him, from the most mutual friends to the least (and by their ids for equal numbers).
+ * only students with at least one mutual friend are suggested, so less names than the given amount may be printed.
+ * @param course_manager - the course manager that the student is logged to
+ * @param amount - the maximal number of names to print (must be positive number)
+ * @param output_channel - the channel to print the names to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the amount given is not valid
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printFriendSuggestions(CourseManager course_manager, int amount, FILE* output_channel) {
     if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
         return COURSE_MANAGER_OUT_OF_MEMORY;
     }
     if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
     if (amount < 1) return COURSE_MANAGER_INVALID_PARAMETERS;
-    Student** best_students = malloc(sizeof(Student*) * amount);
-    if (best_students == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
-    for (int i = 0; i < amount; i++) { // initialize array of pointer to pointers
-        best_students[i] = malloc(sizeof(Student*));
-        if (best_students[i] == NULL) {
-            for (int j = 0; j < i; j++) {
-                free(best_students[j]);
+    // the students with mutual friends are exactly the ones two friendships away
+    int visited = searchNetwork(course_manager, course_manager->logged_student, 2);
+    if (visited == -1) return COURSE_MANAGER_OUT_OF_MEMORY;
+    NetworkSearch* search = &course_manager->network_search;
+    FriendSuggestion* heap = search->suggestions; // keeps the best amount suggestions, with the worst of them at the root
+    int heap_size = 0;
+    for (int i = 1; i < visited; i++) { // the first visited student is the logged student
+        Student candidate = search->queue[i];
+        int candidate_id = studentGetId(candidate);
+        if (isFriendById(course_manager->logged_student, candidate_id)) continue;
+        mutual_friends_count_t count = {course_manager, 0};
+        studentForEachMutualFriend(course_manager->logged_student, candidate, countMutualFriend, &count);
+        FriendSuggestion suggestion = {candidate, candidate_id, count.count};
+        if (heap_size < amount) {
+            heap[heap_size] = suggestion;
+            siftUpSuggestion(heap, heap_size++);
+        } else if (isWorseSuggestion(&heap[0], &suggestion)) {
+            heap[0] = suggestion;
+            siftDownSuggestion(heap, heap_size, 0);
+        }
+    }
+    // take out the worst suggestion to the end of the heap until it is empty, so it is sorted from the best one
+    for (int size = heap_size - 1; size > 0; size--) {
+        FriendSuggestion temp = heap[0];
+        heap[0] = heap[size];
+        heap[size] = temp;
+        siftDownSuggestion(heap, size, 0);
+    }
+    for (int i = 0; i < heap_size; i++) {
+        studentPrintName(heap[i].student, output_channel);
+    }
+    return COURSE_MANAGER_OK;
+}
+
+/** The data getFriendSlots passes to collectFriendSlot for every friend of a student */
+typedef struct friend_slots_t {
+    CourseManager course_manager;
+    int* slots; // where to write the slots of the friends. NULL to only count them
+    int count;
+} friend_slots_t;
+
+/**
+ * collectFriendSlot - inner StudentIdVisitor that collects the slot of the friend with the given id (unless the friend
+ * was removed)
+ * @param id - the id of the friend
+ * @param context - pointer to the friend_slots_t of the collection
+ */
+static void collectFriendSlot(int id, void* context) {
+    friend_slots_t* collection = context;
+    if (isStudentRemoved(collection->course_manager, id)) return;
+    if (collection->slots != NULL) {
+        collection->slots[collection->count] = studentDirectoryGetSlot(collection->course_manager->directory, id);
+    }
+    collection->count++;
+}
+
+/**
+ * getFriendSlots - inner FriendGraphNeighboursFunction that returns the slots of the friends of the student with the
+ * given slot
+ * @param slot - the slot of the student
+ * @param neighbours - array to write the slots of the friends to, or NULL to only count them
+ * @param context - the course manager
+ * @return the number of friends. -1 if no student has the slot (or he was removed)
+ */
+static int getFriendSlots(int slot, int* neighbours, void* context) {
+    CourseManager course_manager = context;
+    Student student = studentDirectoryGetBySlot(course_manager->directory, slot);
+    if (student == NULL || isStudentRemoved(course_manager, studentGetId(student))) return -1;
+    friend_slots_t collection = {course_manager, neighbours, 0};
+    studentForEachFriend(student, collectFriendSlot, &collection);
+    return collection.count;
+}
+
+/**
+ * courseManagerFreezeFriendGraph - returns a snapshot of the friendships graph, in compressed sparse row layout.
+ * the vertices of the graph are the slots of the students (that were not removed), so arrays indexed by the vertices
+ * stay as small as the number of students. the snapshot is built again only if a student or a friendship was added or
+ * removed since the last one was built.
+ * @param course_manager - the course manager to freeze its friendships graph
+ * @return the snapshot, owned by the course manager and valid until the next change of the students or friendships.
+ * NULL if there was a memory error (or course_manager is NULL)
+ */
+FriendGraph courseManagerFreezeFriendGraph(CourseManager course_manager) {
+    if (course_manager == NULL) return NULL;
+    if (course_manager->friend_graph_dirty) {
+        if (friendGraphBuild(course_manager->friend_graph, studentDirectoryGetSlotCount(course_manager->directory),
+                             getFriendSlots, course_manager) != FRIEND_GRAPH_OK) {
+            return NULL;
+        }
+        course_manager->friend_graph_dirty = false;
+    }
+    return course_manager->friend_graph;
+}
+
+/**
+ * buildFriendComponents - inner function that builds the components of the friendships graph again, from a snapshot
+ * of the graph
+ * @param course_manager - the course manager to build its components
+ * @return false if there was a memory error (the components stay dirty), true otherwise
+ */
+static bool buildFriendComponents(CourseManager course_manager) {
+    FriendGraph graph = courseManagerFreezeFriendGraph(course_manager);
+    if (graph == NULL) return false;
+    friendComponentsClear(course_manager->components);
+    int vertex_count = friendGraphGetVertexCount(graph);
+    for (int vertex = 0; vertex < vertex_count; vertex++) {
+        if (!friendGraphHasVertex(graph, vertex)) continue;
+        if (friendComponentsAdd(course_manager->components, vertex) != FRIEND_COMPONENTS_OK) return false;
+    }
+    for (int vertex = 0; vertex < vertex_count; vertex++) {
+        int degree = 0;
+        const int* neighbours = friendGraphGetNeighbours(graph, vertex, &degree);
+        for (int i = 0; i < degree; i++) {
+            if (neighbours[i] > vertex) { // every friendship is in the graph twice
+                friendComponentsUnite(course_manager->components, vertex, neighbours[i]);
             }
-            free(best_students);
-            return COURSE_MANAGER_OUT_OF_MEMORY;
         }
-        *best_students[i] = NULL;
     }
-    CourseManagerResult get_grades_result = getFriendsWithBestGrades(course_manager, course_id, amount, best_students);
-    if (get_grades_result == COURSE_MANAGER_OK) {
-        courseManagerPrintFriendsArray(best_students, amount, output_channel);
+    course_manager->components_dirty = false;
+    return true;
+}
+
+/**
+ * printNetworkStats - print statistics of the study groups (the connected components of the friendships graph): the
+ * number of groups, the size of the largest group and the size of the logged student's group.
+ * the components are kept up to date when friendships are added, and built again only after friendships (or students)
+ * were removed.
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the statistics to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printNetworkStats(CourseManager course_manager, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
     }
-    for (int i = 0; i < amount; i++) {
-        free(best_students[i]);
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (course_manager->components_dirty && !buildFriendComponents(course_manager)) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
     }
-    free(best_students);
-    return get_grades_result;
+    int logged_slot = studentDirectoryGetSlot(course_manager->directory, studentGetId(course_manager->logged_student));
+    fprintf(output_channel, "Study groups: %d\n", friendComponentsGetCount(course_manager->components));
+    fprintf(output_channel, "Largest study group: %d\n", friendComponentsGetLargestSize(course_manager->components));
+    fprintf(output_channel, "Your study group: %d\n", friendComponentsGetSize(course_manager->components, logged_slot));
+    return COURSE_MANAGER_OK;
+}
+
+/** The data buildGradeColumns passes to appendGradeRow for every grade of a student */
+typedef struct grade_columns_fill_t {
+    GradeColumns columns;
+    int student_id;
+    bool failed; // whether a grade could not be added
+} grade_columns_fill_t;
+
+/**
+ * appendGradeRow - inner GradeVisitor that adds the given grade to the mirror being built
+ * @param grade - the grade to add
+ * @param context - pointer to the grade_columns_fill_t of the build
+ */
+static void appendGradeRow(Grade grade, void* context) {
+    grade_columns_fill_t* fill = context;
+    if (!fill->failed && gradeColumnsAppend(fill->columns, fill->student_id, grade) != GRADE_COLUMNS_OK) {
+        fill->failed = true;
+    }
+}
+
+/**
+ * getGradeColumns - inner function that returns the grades mirror, and builds it from the grades of all the students
+ * (that were not removed) if there is none. once built, the mirror is kept up to date with every change of the grades
+ * @param course_manager - the course manager to get its mirror
+ * @return the mirror. NULL if there was a memory error
+ */
+static GradeColumns getGradeColumns(CourseManager course_manager) {
+    if (course_manager->grade_columns != NULL) return course_manager->grade_columns;
+    grade_columns_fill_t fill = {gradeColumnsCreate(), 0, false};
+    if (fill.columns == NULL) return NULL;
+    SET_FOREACH(Student, student, course_manager->students) {
+        fill.student_id = studentGetId(student);
+        if (isStudentRemoved(course_manager, fill.student_id)) continue;
+        studentForEachGrade(student, appendGradeRow, &fill);
+        if (fill.failed) {
+            gradeColumnsDestroy(fill.columns);
+            return NULL;
+        }
+    }
+    course_manager->grade_columns = fill.columns;
+    return fill.columns;
+}
+
+/**
+ * printCourseAverage - prints the number of grades of the course with the given id (of all the students, every
+ * attempt counts) and their average. scans the course column of the grades mirror
+ * @param course_manager - the course manager that the student is logged to
+ * @param course_id - the id of the course
+ * @param output_channel - the channel to print the average to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_COURSE_DOES_NOT_EXIST - if no student has grades in the course
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCourseAverage(CourseManager course_manager, int course_id, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    GradeColumns columns = getGradeColumns(course_manager);
+    if (columns == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
+    long long grade_sum = 0;
+    int count = gradeColumnsCountCourse(columns, course_id, &grade_sum);
+    if (count == 0) return COURSE_MANAGER_COURSE_DOES_NOT_EXIST;
+    fprintf(output_channel, "Course %d: %d grades, average %.2f\n", course_id, count, (double)grade_sum / count);
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printSemesterFailures - prints the number of grades in the given semester (of all the students) and how many of
+ * them are failed. scans the semester column of the grades mirror
+ * @param course_manager - the course manager that the student is logged to
+ * @param semester - the semester number
+ * @param output_channel - the channel to print the numbers to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the semester is not positive
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printSemesterFailures(CourseManager course_manager, int semester, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (semester <= 0) return COURSE_MANAGER_INVALID_PARAMETERS;
+    GradeColumns columns = getGradeColumns(course_manager);
+    if (columns == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
+    int failed = 0;
+    int count = gradeColumnsCountSemester(columns, semester, &failed);
+    fprintf(output_channel, "Semester %d: %d grades, %d failed\n", semester, count, failed);
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printGradeTotals - prints the number of grades of all the students, their total points, the points of the failed
+ * grades and the average of the grades weighted by their points (every attempt counts).
+ * reduces the columns of the grades mirror
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the totals to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printGradeTotals(CourseManager course_manager, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    GradeColumns columns = getGradeColumns(course_manager);
+    if (columns == NULL) return COURSE_MANAGER_OUT_OF_MEMORY;
+    long long points_x2 = 0, failed_points_x2 = 0, grade_points_x2 = 0;
+    int count = gradeColumnsGetTotals(columns, &points_x2, &failed_points_x2, &grade_points_x2);
+    fprintf(output_channel, "Grades: %d, points: %lld.%d, failed points: %lld.%d, average: %.2f\n", count,
+            points_x2 / 2, (int)(points_x2 % 2) * 5, failed_points_x2 / 2, (int)(failed_points_x2 % 2) * 5,
+            (points_x2 == 0) ? 0.0 : (double)grade_points_x2 / points_x2);
+    return COURSE_MANAGER_OK;
+}
+
+/** The data buildCourseHistograms passes to addEffectiveGrade for every effective grade of a student */
+typedef struct course_histograms_fill_t {
+    CourseHistograms histograms;
+    bool failed; // whether a grade could not be added
+} course_histograms_fill_t;
+
+/**
+ * addEffectiveGrade - inner EffectiveGradeVisitor that adds the given grade to the histogram of its course
+ * @param course_id - the id of the course
+ * @param grade - the effective grade to add
+ * @param context - pointer to the course_histograms_fill_t of the build
+ */
+static void addEffectiveGrade(int course_id, int grade, void* context) {
+    course_histograms_fill_t* fill = context;
+    if (!fill->failed && courseHistogramsAdd(fill->histograms, course_id, grade) != COURSE_HISTOGRAMS_OK) {
+        fill->failed = true;
+    }
+}
+
+/**
+ * buildCourseHistograms - inner function that builds the histograms again from the effective grades of all the
+ * students (that were not removed), after they could not be updated
+ * @param course_manager - the course manager to build its histograms
+ * @return false if there was a memory error (the histograms stay dirty), true otherwise
+ */
+static bool buildCourseHistograms(CourseManager course_manager) {
+    courseHistogramsClear(course_manager->histograms);
+    course_histograms_fill_t fill = {course_manager->histograms, false};
+    SET_FOREACH(Student, student, course_manager->students) {
+        if (isStudentRemoved(course_manager, studentGetId(student))) continue;
+        studentForEachEffectiveGrade(student, addEffectiveGrade, &fill);
+        if (fill.failed) return false;
+    }
+    course_manager->histograms_dirty = false;
+    return true;
+}
+
+/**
+ * printCourseStats - prints the distribution of the effective grades of the course with the given id, over all the
+ * students: the number of grades, their mean, median, 25th, 75th and 90th percentiles, and the fail rate.
+ * the histograms are kept up to date with every change of the grades, so no student is gone over
+ * @param course_manager - the course manager that the student is logged to
+ * @param course_id - the id of the course
+ * @param output_channel - the channel to print the statistics to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_COURSE_DOES_NOT_EXIST - if no student has grades in the course
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCourseStats(CourseManager course_manager, int course_id, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (course_manager->histograms_dirty && !buildCourseHistograms(course_manager)) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    CourseHistograms histograms = course_manager->histograms;
+    int count = courseHistogramsGetCount(histograms, course_id);
+    if (count == 0) return COURSE_MANAGER_COURSE_DOES_NOT_EXIST;
+    fprintf(output_channel, "Course %d: %d grades\n", course_id, count);
+    fprintf(output_channel, "Mean: %.2f\n", courseHistogramsGetMean(histograms, course_id));
+    fprintf(output_channel, "Median: %d\n", courseHistogramsGetPercentile(histograms, course_id, 50));
+    fprintf(output_channel, "25th percentile: %d\n", courseHistogramsGetPercentile(histograms, course_id, 25));
+    fprintf(output_channel, "75th percentile: %d\n", courseHistogramsGetPercentile(histograms, course_id, 75));
+    fprintf(output_channel, "90th percentile: %d\n", courseHistogramsGetPercentile(histograms, course_id, 90));
+    fprintf(output_channel, "Fail rate: %.2f%%\n",
+            100.0 * courseHistogramsGetFailedCount(histograms, course_id) / count);
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * buildRanking - inner function that builds the ranking again from the effective totals of all the students (that were
+ * not removed), after it could not be updated
+ * @param course_manager - the course manager to build its ranking
+ * @return false if there was a memory error (the ranking stays dirty), true otherwise
+ */
+static bool buildRanking(CourseManager course_manager) {
+    gpaRankingClear(course_manager->ranking);
+    SET_FOREACH(Student, student, course_manager->students) {
+        int id = studentGetId(student);
+        if (isStudentRemoved(course_manager, id)) continue;
+        int points_x2 = 0, grade_sum_x2 = 0;
+        studentGetEffectiveTotals(student, &points_x2, &grade_sum_x2);
+        if (gpaRankingInsert(course_manager->ranking, id, grade_sum_x2, points_x2) != GPA_RANKING_OK) return false;
+    }
+    course_manager->ranking_dirty = false;
+    return true;
+}
+
+/**
+ * getEffectiveAverage - inner function that returns the effective average of the given totals (0 without points)
+ */
+static double getEffectiveAverage(int grade_sum_x2, int points_x2) {
+    return (points_x2 == 0) ? 0.0 : (double)grade_sum_x2 / points_x2;
+}
+
+/**
+ * printRank - prints the rank of the logged student among all the students, by their effective averages (a higher
+ * average is ranked first, and students with the same average are ranked by their ids). students without effective
+ * points are ranked last. the ranking is kept up to date with every change of the grades, so it takes O(log N)
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the rank to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printRank(CourseManager course_manager, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (course_manager->ranking_dirty && !buildRanking(course_manager)) return COURSE_MANAGER_OUT_OF_MEMORY;
+    int points_x2 = 0, grade_sum_x2 = 0;
+    studentGetEffectiveTotals(course_manager->logged_student, &points_x2, &grade_sum_x2);
+    int rank = gpaRankingGetRank(course_manager->ranking, studentGetId(course_manager->logged_student), grade_sum_x2,
+                                 points_x2);
+    fprintf(output_channel, "Rank: %d of %d, average: %.2f\n", rank, gpaRankingGetSize(course_manager->ranking),
+            getEffectiveAverage(grade_sum_x2, points_x2));
+    return COURSE_MANAGER_OK;
+}
+
+/**
+ * printRankedStudent - inner GpaRankingVisitor that prints the rank, the id and the effective average of the student
+ * @param context - the channel to print the student to
+ */
+static void printRankedStudent(int rank, int id, int grade_sum_x2, int points_x2, void* context) {
+    fprintf(context, "%d. %d, average: %.2f\n", rank, id, getEffectiveAverage(grade_sum_x2, points_x2));
+}
+
+/**
+ * printTopStudents - prints the given amount of students with the best effective averages, from the best one (if
+ * there are less students - all of them are printed). takes O(log N + amount)
+ * @param course_manager - the course manager that the student is logged to
+ * @param amount - the number of students to print (must be positive)
+ * @param output_channel - the channel to print the students to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if amount is not positive
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printTopStudents(CourseManager course_manager, int amount, FILE* output_channel) {
+    if (course_manager == NULL || course_manager->students == NULL || output_channel == NULL) {
+        return COURSE_MANAGER_OUT_OF_MEMORY;
+    }
+    if (course_manager->logged_student == NULL) return COURSE_MANAGER_NOT_LOGGED_IN;
+    if (amount < 1) return COURSE_MANAGER_INVALID_PARAMETERS;
+    if (course_manager->ranking_dirty && !buildRanking(course_manager)) return COURSE_MANAGER_OUT_OF_MEMORY;
+    gpaRankingForEachTop(course_manager->ranking, amount, printRankedStudent, output_channel);
+    return COURSE_MANAGER_OK;
 }
 
 /**
@@ -535,6 +1658,22 @@ CourseManagerResult sendFacultyReqeust(CourseManager course_manager, int course_
  */
 void destroyCourseManager(CourseManager course_manager) {
     if (course_manager == NULL) return;
+    gradeColumnsDestroy(course_manager->grade_columns); // before the students, which own the grades of the mirror
     setDestroy(course_manager->students);
+    // after the students, which release their names and courses
+    namePoolDestroy(course_manager->names);
+    courseCatalogDestroy(course_manager->courses);
+    coursePostingsDestroy(course_manager->postings);
+    intSetDestroy(course_manager->removed_students);
+    intSetDestroy(course_manager->reclaimed_students);
+    studentDirectoryDestroy(course_manager->directory);
+    friendComponentsDestroy(course_manager->components);
+    friendGraphDestroy(course_manager->friend_graph);
+    courseHistogramsDestroy(course_manager->histograms);
+    gpaRankingDestroy(course_manager->ranking);
+    reportCacheDestroy(course_manager->reports);
+    free(course_manager->network_search.visit_marks);
+    free(course_manager->network_search.queue);
+    free(course_manager->network_search.suggestions);
     free(course_manager);
 }
\ No newline at end of file
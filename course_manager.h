@@ -5,6 +5,7 @@
 #include "set.h"
 #include "mtm_ex3.h"
 #include "student.h"
+#include "friend_graph.h"
 
 typedef struct course_manager_t *CourseManager;
 
@@ -54,6 +55,37 @@ CourseManagerResult addStudent(CourseManager  course_manager, int id, char* firs
  */
 CourseManagerResult removeStudent(CourseManager course_manager, int id);
 
+/**
+ * courseManagerSetLazyRemoval - sets whether removeStudent removes students lazily. a lazily removed student is only
+ * marked as removed (and hidden from all the commands), and its memory is reclaimed later by courseManagerReclaim.
+ * lazy removal is off for a new course manager.
+ * @param course_manager - the course manager to set
+ * @param lazy_removal - true to remove students lazily, false to remove them immediately
+ */
+void courseManagerSetLazyRemoval(CourseManager course_manager, bool lazy_removal);
+
+/**
+ * courseManagerReclaim - does a bounded slice of the work of reclaiming the lazily removed students: removing their
+ * ids from the other students' friends and friend requests, and then destroying them.
+ * meant to be called between commands, until it returns true.
+ * a removed student is released over as many slices as its history needs (see studentRelease), and then destroyed.
+ * @param course_manager - the course manager to reclaim its removed students
+ * @param budget - the work to do in this slice (must be positive): one unit for every slot (a student or a free slot)
+ * that is gone over, and one for every version, grade and course of a removed student that is released. the last step
+ * of a slice may go over the budget by the number of semesters of one version
+ * @return true if there are no removed students left to reclaim, false otherwise
+ */
+bool courseManagerReclaim(CourseManager course_manager, int budget);
+
+/**
+ * courseManagerBeginCommand - advances the sequence number of the commands. the grade changes of the command are
+ * recorded in the versions of the grade sheets with the new number, so reports can be printed as of any command.
+ * meant to be called before every command.
+ * @param course_manager - the course manager
+ * @return the sequence number of the new command (the first command is 1). -1 if course_manager is NULL
+ */
+int courseManagerBeginCommand(CourseManager course_manager);
+
 /**
  * logInStudent - log in student with the given id
  * @param course_manager - the course manager that the student is logging in to
@@ -154,7 +186,8 @@ CourseManagerResult removeGrade(CourseManager course_manager, int semester, int
 CourseManagerResult updateGrade(CourseManager course_manager, int course_id, int new_grade);
 
 /**
- * printFullReport - prints full grades report for the logged student into the given output channel
+ * printFullReport - prints full grades report for the logged student into the given output channel. the report is
+ * rendered once for every version of the student's grades, and printed again from the reports cache
  * @param course_manager - the course manager that the student is logged to
  * @param output_channel - the channel to print the report to
  * @return
@@ -165,7 +198,8 @@ CourseManagerResult printFullReport(CourseManager course_manager, FILE* output_c
 /**
  * printCleanReport - prints grades report of the logged student containing the effective grades of all the student's
  * courses, sorted by course id (and also by semester number for sport courses with the same id).
- * the print will be to the given output channel.
+ * the print will be to the given output channel. the report is rendered once for every version of the student's
+ * grades, and printed again from the reports cache
  * @param course_manager - the course manager that the student is logged to
  * @param output_channel - the channel to print the report to
  * @return
@@ -173,6 +207,56 @@ CourseManagerResult printFullReport(CourseManager course_manager, FILE* output_c
  */
 CourseManagerResult printCleanReport(CourseManager course_manager, FILE* output_channel);
 
+/**
+ * printFullReportAsOf - prints the full grades report of the logged student as his grade sheet was after the command
+ * with the given sequence number, from the recorded versions of the sheet
+ * @param course_manager - the course manager that the student is logged to
+ * @param sequence - the sequence number of the command (between 0, before the first command, and the current command)
+ * @param output_channel - the channel to print the report to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the sequence number is negative or after the current command
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printFullReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel);
+
+/**
+ * printCleanReportAsOf - prints the clean grades report of the logged student as his grade sheet was after the
+ * command with the given sequence number, from the recorded versions of the sheet
+ * @param course_manager - the course manager that the student is logged to
+ * @param sequence - the sequence number of the command (between 0, before the first command, and the current command)
+ * @param output_channel - the channel to print the report to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the sequence number is negative or after the current command
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCleanReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel);
+
+/**
+ * printProgression - prints the cumulative effective points and average of the logged student after every semester he
+ * has grades in
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the progression to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printProgression(CourseManager course_manager, FILE* output_channel);
+
+/**
+ * printWhatIf - prints the clean sheet summary the logged student would have if he got the grades of the given
+ * scenario in a new semester. the scenario is evaluated against the effective totals of the student, so it takes
+ * O(changes), and the sheet of the student is not changed
+ * @param course_manager - the course manager that the student is logged to
+ * @param scenario - the hypothetical grades
+ * @param output_channel - the channel to print the summary to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if a change with invalid parameters was added to the scenario
+ */
+CourseManagerResult printWhatIf(CourseManager course_manager, WhatIf scenario, FILE* output_channel);
+
 /**
  * printBestGrades - prints the best effective sheet grades of the logged student. the amount of grades printed is
  * given (must be positive number)
@@ -210,6 +294,147 @@ CourseManagerResult printWorstGrades(CourseManager course_manager, int amount, F
  */
 CourseManagerResult printReferenceSources(CourseManager course_manager, int course_id, int amount,FILE* output_channel);
 
+/**
+ * printReferenceNetwork - print the names of the students in the logged student's friends network who had the best
+ * grades in the course with the given course id. the network has all the students that are at most depth friendships
+ * away from the logged student (not including himself), so depth 1 is the same as printReferenceSources.
+ * @param course_manager  - the course manager that the student is logged to
+ * @param course_id - the id of the course to search reference sources for
+ * @param amount - the number of names to print (must be positive number)
+ * @param depth - the maximal number of friendships between the logged student and the printed students (must be
+ * positive number)
+ * @param output_channel - the channel to print the names to
+ * @return
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the amount or the depth given is not valid
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printReferenceNetwork(CourseManager course_manager, int course_id, int amount, int depth,
+                                          FILE* output_channel);
+
+/**
+ * printMutualFriends - print the names of the students who are friends of both the logged student and the student with
+ * the given id, sorted by their ids
+ * @param course_manager - the course manager that the student is logged to
+ * @param otherId - the id of the other student
+ * @param output_channel - the channel to print the names to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_STUDENT_DOES_NOT_EXIST - if student with given id does not exist in the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the given id is the id of the logged student
+ */
+CourseManagerResult printMutualFriends(CourseManager course_manager, int otherId, FILE* output_channel);
+
+/**
+ * printFriendSuggestions - print the names of the students who are not friends of the logged student, but have the
+ * most mutual friends with him, from the most mutual friends to the least (and by their ids for equal numbers).
+ * only students with at least one mutual friend are suggested, so less names than the given amount may be printed.
+ * @param course_manager - the course manager that the student is logged to
+ * @param amount - the maximal number of names to print (must be positive number)
+ * @param output_channel - the channel to print the names to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the amount given is not valid
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printFriendSuggestions(CourseManager course_manager, int amount, FILE* output_channel);
+
+/**
+ * courseManagerFreezeFriendGraph - returns a snapshot of the friendships graph, in compressed sparse row layout.
+ * the vertices of the graph are the slots of the students (that were not removed). the snapshot is built again only if
+ * a student or a friendship was added or removed since the last one was built.
+ * @param course_manager - the course manager to freeze its friendships graph
+ * @return the snapshot, owned by the course manager and valid until the next change of the students or friendships.
+ * NULL if there was a memory error (or course_manager is NULL)
+ */
+FriendGraph courseManagerFreezeFriendGraph(CourseManager course_manager);
+
+/**
+ * printNetworkStats - print statistics of the study groups (the connected components of the friendships graph): the
+ * number of groups, the size of the largest group and the size of the logged student's group.
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the statistics to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printNetworkStats(CourseManager course_manager, FILE* output_channel);
+
+/**
+ * printCourseAverage - prints the number of grades of the course with the given id (of all the students, every
+ * attempt counts) and their average
+ * @param course_manager - the course manager that the student is logged to
+ * @param course_id - the id of the course
+ * @param output_channel - the channel to print the average to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_COURSE_DOES_NOT_EXIST - if no student has grades in the course
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCourseAverage(CourseManager course_manager, int course_id, FILE* output_channel);
+
+/**
+ * printSemesterFailures - prints the number of grades in the given semester (of all the students) and how many of
+ * them are failed
+ * @param course_manager - the course manager that the student is logged to
+ * @param semester - the semester number
+ * @param output_channel - the channel to print the numbers to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if the semester is not positive
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printSemesterFailures(CourseManager course_manager, int semester, FILE* output_channel);
+
+/**
+ * printGradeTotals - prints the number of grades of all the students, their total points, the points of the failed
+ * grades and the average of the grades weighted by their points (every attempt counts)
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the totals to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printGradeTotals(CourseManager course_manager, FILE* output_channel);
+
+/**
+ * printCourseStats - prints the distribution of the effective grades of the course with the given id, over all the
+ * students: the number of grades, their mean, median, 25th, 75th and 90th percentiles, and the fail rate
+ * @param course_manager - the course manager that the student is logged to
+ * @param course_id - the id of the course
+ * @param output_channel - the channel to print the statistics to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_COURSE_DOES_NOT_EXIST - if no student has grades in the course
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printCourseStats(CourseManager course_manager, int course_id, FILE* output_channel);
+
+/**
+ * printRank - prints the rank of the logged student among all the students, by their effective averages (a higher
+ * average is ranked first, and students with the same average are ranked by their ids). students without effective
+ * points are ranked last
+ * @param course_manager - the course manager that the student is logged to
+ * @param output_channel - the channel to print the rank to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printRank(CourseManager course_manager, FILE* output_channel);
+
+/**
+ * printTopStudents - prints the given amount of students with the best effective averages, from the best one (if
+ * there are less students - all of them are printed)
+ * @param course_manager - the course manager that the student is logged to
+ * @param amount - the number of students to print (must be positive)
+ * @param output_channel - the channel to print the students to
+ * @return
+ * COURSE_MANAGER_NOT_LOGGED_IN - if no student is logged in to the system
+ * COURSE_MANAGER_INVALID_PARAMETERS - if amount is not positive
+ * COURSE_MANAGER_OUT_OF_MEMORY - if there was a memory error
+ */
+CourseManagerResult printTopStudents(CourseManager course_manager, int amount, FILE* output_channel);
+
 /**
  * sendFacultyReqeust - send the given request to the faculty from the logged student, regarding the course with the
  * given course id, and prints the answer to the given output channel.
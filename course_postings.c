@@ -0,0 +1,312 @@
+#include "course_postings.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include "typed_vector.h"
+
+#define COURSE_POSTING_KEY(posting) ((posting).student_id)
+
+SORTED_VECTOR_DEFINE(PostingVector, postingVector, CoursePosting, int, COURSE_POSTING_KEY, VECTOR_COMPARE_INTS)
+
+#define LEADERBOARD_MAX_LEVEL 16
+
+/** a node of the leaderboard skip list */
+typedef struct course_rank_t {
+    CoursePosting posting;
+    int level;
+    struct course_rank_t* next[]; // next[i] is the next node in the i-th level of the list
+} course_rank_t;
+
+/** the postings list of a single course */
+typedef struct course_postings_list_t {
+    int course_id;
+    PostingVector students;
+    CourseRank leaderboard; // the head of the skip list of the students, sorted from the best grade to the worst one
+    int leaderboard_level; // the number of levels in use
+} PostingsList;
+
+#define POSTINGS_LIST_KEY(list) ((list).course_id)
+
+SORTED_VECTOR_DEFINE(PostingsListVector, postingsListVector, PostingsList, int, POSTINGS_LIST_KEY, VECTOR_COMPARE_INTS)
+
+typedef struct course_postings_t {
+    PostingsListVector courses; // only courses with at least one student
+    unsigned int random_state; // for choosing the levels of new leaderboard nodes
+} course_postings_t;
+
+/**
+ * isRankedBefore - inner function to check if the first entry comes before the second one in a leaderboard
+ * @return true if the first entry has a better grade, or the same grade and a lower student id
+ */
+static bool isRankedBefore(CoursePosting posting1, CoursePosting posting2) {
+    if (posting1.best_grade != posting2.best_grade) return posting1.best_grade > posting2.best_grade;
+    return posting1.student_id < posting2.student_id;
+}
+
+/**
+ * courseRankCreate - inner function that allocates a leaderboard node with the given number of levels
+ * @return the new node (its next pointers are not initialized). NULL if the allocation failed
+ */
+static CourseRank courseRankCreate(CoursePosting posting, int level) {
+    CourseRank rank = (CourseRank) malloc(sizeof(*rank) + sizeof(CourseRank) * level);
+    if (rank == NULL) return NULL;
+    rank->posting = posting;
+    rank->level = level;
+    return rank;
+}
+
+/**
+ * coursePostingsRandomLevel - inner function that chooses the number of levels of a new leaderboard node, so that
+ * every level has about a quarter of the nodes of the level below it (xorshift random numbers)
+ */
+static int coursePostingsRandomLevel(CoursePostings postings) {
+    unsigned int random = postings->random_state;
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    postings->random_state = random;
+    int level = 1;
+    while (level < LEADERBOARD_MAX_LEVEL && (random & 3) == 0) {
+        level++;
+        random >>= 2;
+    }
+    return level;
+}
+
+/**
+ * leaderboardFindPredecessors - inner function that finds, in every level of the leaderboard, the last node that is
+ * ranked before the given entry
+ * @param list - the postings list of the course
+ * @param posting - the entry to search
+ * @param predecessors - array of LEADERBOARD_MAX_LEVEL nodes to save the result to
+ */
+static void leaderboardFindPredecessors(PostingsList* list, CoursePosting posting, CourseRank* predecessors) {
+    CourseRank current = list->leaderboard;
+    for (int i = LEADERBOARD_MAX_LEVEL - 1; i >= 0; i--) {
+        while (i < list->leaderboard_level && current->next[i] != NULL &&
+               isRankedBefore(current->next[i]->posting, posting)) {
+            current = current->next[i];
+        }
+        predecessors[i] = current;
+    }
+}
+
+/**
+ * leaderboardLink - inner function that links the given node into its place in the leaderboard
+ */
+static void leaderboardLink(PostingsList* list, CourseRank rank) {
+    CourseRank predecessors[LEADERBOARD_MAX_LEVEL];
+    leaderboardFindPredecessors(list, rank->posting, predecessors);
+    if (rank->level > list->leaderboard_level) {
+        list->leaderboard_level = rank->level;
+    }
+    for (int i = 0; i < rank->level; i++) {
+        rank->next[i] = predecessors[i]->next[i];
+        predecessors[i]->next[i] = rank;
+    }
+}
+
+/**
+ * leaderboardUnlink - inner function that unlinks the node of the given entry from the leaderboard
+ * @return the unlinked node (the entry must be in the leaderboard)
+ */
+static CourseRank leaderboardUnlink(PostingsList* list, CoursePosting posting) {
+    CourseRank predecessors[LEADERBOARD_MAX_LEVEL];
+    leaderboardFindPredecessors(list, posting, predecessors);
+    CourseRank rank = predecessors[0]->next[0];
+    for (int i = 0; i < rank->level; i++) {
+        predecessors[i]->next[i] = rank->next[i];
+    }
+    while (list->leaderboard_level > 1 && list->leaderboard->next[list->leaderboard_level - 1] == NULL) {
+        list->leaderboard_level--;
+    }
+    return rank;
+}
+
+/**
+ * postingsListDestroy - inner function that deallocates the postings list and the leaderboard of a course
+ */
+static void postingsListDestroy(PostingsList* list) {
+    CourseRank rank = list->leaderboard;
+    while (rank != NULL) {
+        CourseRank next = rank->next[0];
+        free(rank);
+        rank = next;
+    }
+    postingVectorDestroy(&list->students);
+}
+
+/**
+ * postingsListCreate - inner function that creates the postings list of a course, with its first student
+ * @return
+ * COURSE_POSTINGS_OUT_OF_MEMORY - if there was a memory error
+ * COURSE_POSTINGS_OK - otherwise
+ */
+static CoursePostingsResult postingsListCreate(CoursePostings postings, int course_id, CoursePosting posting,
+                                               PostingsList* list) {
+    list->course_id = course_id;
+    postingVectorInit(&list->students);
+    list->leaderboard_level = 1;
+    CoursePosting head_posting = {0, 0}; // not used
+    list->leaderboard = courseRankCreate(head_posting, LEADERBOARD_MAX_LEVEL);
+    if (list->leaderboard == NULL) return COURSE_POSTINGS_OUT_OF_MEMORY;
+    for (int i = 0; i < LEADERBOARD_MAX_LEVEL; i++) {
+        list->leaderboard->next[i] = NULL;
+    }
+    CourseRank rank = courseRankCreate(posting, coursePostingsRandomLevel(postings));
+    if (rank == NULL || postingVectorAppend(&list->students, posting) != VECTOR_OK) {
+        free(rank);
+        postingsListDestroy(list);
+        return COURSE_POSTINGS_OUT_OF_MEMORY;
+    }
+    leaderboardLink(list, rank);
+    return COURSE_POSTINGS_OK;
+}
+
+/**
+ * coursePostingsCreate - creates a new empty index
+ * @return
+ * NULL - if allocations failed.
+ * A new CoursePostings in case of success.
+ */
+CoursePostings coursePostingsCreate() {
+    CoursePostings postings = (CoursePostings) malloc(sizeof(*postings));
+    if (postings == NULL) return NULL;
+    postingsListVectorInit(&postings->courses);
+    postings->random_state = 2463534242u;
+    return postings;
+}
+
+/**
+ * coursePostingsSet - sets the best grade of the student in the course, adding the student to the course's postings
+ * list if he is not there yet
+ * @param postings - the index to update
+ * @param course_id - the id of the course
+ * @param student_id - the id of the student
+ * @param best_grade - the best grade of the student in the course
+ * @return
+ * COURSE_POSTINGS_NULL_ARGUMENT - if the index is NULL
+ * COURSE_POSTINGS_OUT_OF_MEMORY - if there was a memory error (the index is not changed). updating the grade of a
+ * student who is already in the postings list never fails
+ * COURSE_POSTINGS_OK - otherwise
+ */
+CoursePostingsResult coursePostingsSet(CoursePostings postings, int course_id, int student_id, int best_grade) {
+    if (postings == NULL) return COURSE_POSTINGS_NULL_ARGUMENT;
+    CoursePosting new_posting = {student_id, best_grade};
+    PostingsList* list = postingsListVectorFind(&postings->courses, course_id);
+    if (list == NULL) {
+        PostingsList new_list;
+        if (postingsListCreate(postings, course_id, new_posting, &new_list) != COURSE_POSTINGS_OK) {
+            return COURSE_POSTINGS_OUT_OF_MEMORY;
+        }
+        if (postingsListVectorInsert(&postings->courses, new_list) != VECTOR_OK) {
+            postingsListDestroy(&new_list);
+            return COURSE_POSTINGS_OUT_OF_MEMORY;
+        }
+        return COURSE_POSTINGS_OK;
+    }
+    CoursePosting* posting = postingVectorFind(&list->students, student_id);
+    if (posting != NULL) { // move the student's node to its new place, without reallocating it
+        CourseRank rank = leaderboardUnlink(list, *posting);
+        posting->best_grade = best_grade;
+        rank->posting = new_posting;
+        leaderboardLink(list, rank);
+        return COURSE_POSTINGS_OK;
+    }
+    CourseRank rank = courseRankCreate(new_posting, coursePostingsRandomLevel(postings));
+    if (rank == NULL) return COURSE_POSTINGS_OUT_OF_MEMORY;
+    if (postingVectorInsert(&list->students, new_posting) != VECTOR_OK) {
+        free(rank);
+        return COURSE_POSTINGS_OUT_OF_MEMORY;
+    }
+    leaderboardLink(list, rank);
+    return COURSE_POSTINGS_OK;
+}
+
+/**
+ * coursePostingsRemove - removes the student from the course's postings list
+ * @param postings - the index to update
+ * @param course_id - the id of the course
+ * @param student_id - the id of the student
+ * @return
+ * COURSE_POSTINGS_NULL_ARGUMENT - if the index is NULL
+ * COURSE_POSTINGS_ITEM_DOES_NOT_EXIST - if the student is not in the course's postings list
+ * COURSE_POSTINGS_OK - otherwise
+ */
+CoursePostingsResult coursePostingsRemove(CoursePostings postings, int course_id, int student_id) {
+    if (postings == NULL) return COURSE_POSTINGS_NULL_ARGUMENT;
+    PostingsList* list = postingsListVectorFind(&postings->courses, course_id);
+    CoursePosting* posting = (list == NULL) ? NULL : postingVectorFind(&list->students, student_id);
+    if (posting == NULL) return COURSE_POSTINGS_ITEM_DOES_NOT_EXIST;
+    free(leaderboardUnlink(list, *posting));
+    postingVectorRemove(&list->students, student_id);
+    if (postingVectorSize(&list->students) == 0) {
+        postingsListDestroy(list);
+        postingsListVectorRemove(&postings->courses, course_id);
+    }
+    return COURSE_POSTINGS_OK;
+}
+
+/**
+ * coursePostingsGet - returns the postings list of the course
+ * @param postings - the index to search in
+ * @param course_id - the id of the course
+ * @param size - pointer to save the number of entries in the list to (0 if the course has no students)
+ * @return the entries of the list sorted by the student id, owned by the index and valid only until it is changed.
+ * NULL if the course has no students (or one of the arguments is NULL)
+ */
+const CoursePosting* coursePostingsGet(CoursePostings postings, int course_id, int* size) {
+    if (size == NULL) return NULL;
+    *size = 0;
+    if (postings == NULL) return NULL;
+    PostingsList* list = postingsListVectorFind(&postings->courses, course_id);
+    if (list == NULL) return NULL;
+    *size = postingVectorSize(&list->students);
+    return postingVectorAt(&list->students, 0);
+}
+
+/**
+ * coursePostingsGetBest - returns the first position in the leaderboard of the course (the student with the best grade)
+ * @param postings - the index to search in
+ * @param course_id - the id of the course
+ * @return the first position, valid only until the index is changed. NULL if the course has no students (or the index
+ * is NULL)
+ */
+CourseRank coursePostingsGetBest(CoursePostings postings, int course_id) {
+    if (postings == NULL) return NULL;
+    PostingsList* list = postingsListVectorFind(&postings->courses, course_id);
+    if (list == NULL) return NULL;
+    return list->leaderboard->next[0];
+}
+
+/**
+ * courseRankNext - returns the next position in the leaderboard (the student with the next best grade)
+ * @param rank - the current position
+ * @return the next position. NULL if this is the last one (or the rank is NULL)
+ */
+CourseRank courseRankNext(CourseRank rank) {
+    if (rank == NULL) return NULL;
+    return rank->next[0];
+}
+
+/**
+ * courseRankGetPosting - returns the entry at the given position of the leaderboard
+ * @param rank - the position
+ * @return the student id and the best grade at the position. NULL if the rank is NULL
+ */
+const CoursePosting* courseRankGetPosting(CourseRank rank) {
+    if (rank == NULL) return NULL;
+    return &rank->posting;
+}
+
+/**
+ * coursePostingsDestroy - deallocate all the memory of the index
+ * @param postings - the index to destroy. if postings is NULL nothing will be done
+ */
+void coursePostingsDestroy(CoursePostings postings) {
+    if (postings == NULL) return;
+    for (int i = 0; i < postingsListVectorSize(&postings->courses); i++) {
+        postingsListDestroy(postingsListVectorAt(&postings->courses, i));
+    }
+    postingsListVectorDestroy(&postings->courses);
+    free(postings);
+}
@@ -0,0 +1,117 @@
+#ifndef EX3_COURSE_POSTINGS_H
+#define EX3_COURSE_POSTINGS_H
+
+/**
+ * Inverted index from a course to the students who have grades in it.
+ *
+ * For every course, it keeps a postings list of (student id, best grade of the student in the course), sorted by the
+ * student id, so it can be merged with other sorted lists of ids (like the friends of a student). it does not keep
+ * the grades themselves, so it must be told about every change of a student's best grade in a course.
+ *
+ * The same entries are also kept in a leaderboard of the course (a skip list), sorted from the best grade to the worst
+ * one (and by the student id for equal grades), so the best students of a course can be visited in order without
+ * sorting, and the visit can stop after the first few.
+ */
+typedef struct course_postings_t *CoursePostings;
+
+/** A position in the leaderboard of a course */
+typedef struct course_rank_t *CourseRank;
+
+/** A single entry of a postings list */
+typedef struct course_posting_t {
+    int student_id;
+    int best_grade;
+} CoursePosting;
+
+/** Type used for returning error codes from functions */
+typedef enum CoursePostingsResult_t {
+    COURSE_POSTINGS_OK,
+    COURSE_POSTINGS_NULL_ARGUMENT,
+    COURSE_POSTINGS_OUT_OF_MEMORY,
+    COURSE_POSTINGS_ITEM_DOES_NOT_EXIST
+} CoursePostingsResult;
+
+/**
+ * coursePostingsCreate - creates a new empty index
+ * @return
+ * NULL - if allocations failed.
+ * A new CoursePostings in case of success.
+ */
+CoursePostings coursePostingsCreate();
+
+/**
+ * coursePostingsSet - sets the best grade of the student in the course, adding the student to the course's postings
+ * list if he is not there yet
+ * @param postings - the index to update
+ * @param course_id - the id of the course
+ * @param student_id - the id of the student
+ * @param best_grade - the best grade of the student in the course
+ * @return
+ * COURSE_POSTINGS_NULL_ARGUMENT - if the index is NULL
+ * COURSE_POSTINGS_OUT_OF_MEMORY - if there was a memory error (the index is not changed). updating the grade of a
+ * student who is already in the postings list never fails
+ * COURSE_POSTINGS_OK - otherwise
+ */
+CoursePostingsResult coursePostingsSet(CoursePostings postings, int course_id, int student_id, int best_grade);
+
+/**
+ * coursePostingsRemove - removes the student from the course's postings list
+ * @param postings - the index to update
+ * @param course_id - the id of the course
+ * @param student_id - the id of the student
+ * @return
+ * COURSE_POSTINGS_NULL_ARGUMENT - if the index is NULL
+ * COURSE_POSTINGS_ITEM_DOES_NOT_EXIST - if the student is not in the course's postings list
+ * COURSE_POSTINGS_OK - otherwise
+ */
+CoursePostingsResult coursePostingsRemove(CoursePostings postings, int course_id, int student_id);
+
+/**
+ * coursePostingsGet - returns the postings list of the course
+ * @param postings - the index to search in
+ * @param course_id - the id of the course
+ * @param size - pointer to save the number of entries in the list to (0 if the course has no students)
+ * @return the entries of the list sorted by the student id, owned by the index and valid only until it is changed.
+ * NULL if the course has no students (or one of the arguments is NULL)
+ */
+const CoursePosting* coursePostingsGet(CoursePostings postings, int course_id, int* size);
+
+/**
+ * coursePostingsGetBest - returns the first position in the leaderboard of the course (the student with the best grade)
+ * @param postings - the index to search in
+ * @param course_id - the id of the course
+ * @return the first position, valid only until the index is changed. NULL if the course has no students (or the index
+ * is NULL)
+ */
+CourseRank coursePostingsGetBest(CoursePostings postings, int course_id);
+
+/**
+ * courseRankNext - returns the next position in the leaderboard (the student with the next best grade)
+ * @param rank - the current position
+ * @return the next position. NULL if this is the last one (or the rank is NULL)
+ */
+CourseRank courseRankNext(CourseRank rank);
+
+/**
+ * courseRankGetPosting - returns the entry at the given position of the leaderboard
+ * @param rank - the position
+ * @return the student id and the best grade at the position. NULL if the rank is NULL
+ */
+const CoursePosting* courseRankGetPosting(CourseRank rank);
+
+/**
+ * coursePostingsDestroy - deallocate all the memory of the index
+ * @param postings - the index to destroy. if postings is NULL nothing will be done
+ */
+void coursePostingsDestroy(CoursePostings postings);
+
+/**
+ * Macro for iterating over the leaderboard of a course, from the best grade to the worst one.
+ * the index must not be changed while iterating over it.
+ * declares a new CourseRank variable named iterator, that contains the current position in every iteration.
+ */
+#define COURSE_RANK_FOREACH(iterator, postings, course_id) \
+    for (CourseRank iterator = coursePostingsGetBest(postings, course_id); iterator != NULL; \
+         iterator = courseRankNext(iterator))
+
+#endif //EX3_COURSE_POSTINGS_H
@@ -0,0 +1,175 @@
+#include "friend_components.h"
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define FRIEND_COMPONENTS_INITIAL_CAPACITY 64
+#define NOT_A_MEMBER (-1)
+
+typedef struct friend_components_t {
+    int* parents; // the parent of every member in its component's tree (itself for a root), NOT_A_MEMBER otherwise
+    int* sizes; // the size of the component of every root
+    int capacity;
+    int count; // the number of components
+    int largest; // the size of the largest component
+} friend_components_t;
+
+/**
+ * findRoot - inner function that returns the root of the component of the given member. halves the path to the root
+ * on the way, so the next searches are shorter
+ */
+static int findRoot(FriendComponents components, int index) {
+    while (components->parents[index] != index) {
+        components->parents[index] = components->parents[components->parents[index]];
+        index = components->parents[index];
+    }
+    return index;
+}
+
+/**
+ * isMember - inner function to check if the given index is a member of the union-find
+ */
+static bool isMember(FriendComponents components, int index) {
+    return index >= 0 && index < components->capacity && components->parents[index] != NOT_A_MEMBER;
+}
+
+/**
+ * friendComponentsCreate - creates a new union-find without members
+ * @return
+ * NULL - if allocations failed.
+ * A new FriendComponents in case of success.
+ */
+FriendComponents friendComponentsCreate() {
+    FriendComponents components = (FriendComponents) malloc(sizeof(*components));
+    if (components == NULL) return NULL;
+    components->parents = NULL;
+    components->sizes = NULL;
+    components->capacity = 0;
+    components->count = 0;
+    components->largest = 0;
+    return components;
+}
+
+/**
+ * friendComponentsAdd - adds the given index as a member, in a new component of its own
+ * @param components - the union-find to add the member to
+ * @param index - the index of the new member (must not be negative)
+ * @return
+ * FRIEND_COMPONENTS_NULL_ARGUMENT - if components is NULL
+ * FRIEND_COMPONENTS_INVALID_PARAMETER - if the index is negative
+ * FRIEND_COMPONENTS_ALREADY_EXISTS - if the index is already a member
+ * FRIEND_COMPONENTS_OUT_OF_MEMORY - if there was a memory error (the union-find is not changed)
+ * FRIEND_COMPONENTS_OK - otherwise
+ */
+FriendComponentsResult friendComponentsAdd(FriendComponents components, int index) {
+    if (components == NULL) return FRIEND_COMPONENTS_NULL_ARGUMENT;
+    if (index < 0) return FRIEND_COMPONENTS_INVALID_PARAMETER;
+    if (isMember(components, index)) return FRIEND_COMPONENTS_ALREADY_EXISTS;
+    if (index >= components->capacity) {
+        int new_capacity = (components->capacity == 0) ? FRIEND_COMPONENTS_INITIAL_CAPACITY : components->capacity;
+        while (new_capacity <= index) {
+            new_capacity *= 2;
+        }
+        int* new_sizes = (int*) realloc(components->sizes, sizeof(int) * new_capacity);
+        if (new_sizes == NULL) return FRIEND_COMPONENTS_OUT_OF_MEMORY;
+        components->sizes = new_sizes;
+        int* new_parents = (int*) realloc(components->parents, sizeof(int) * new_capacity);
+        if (new_parents == NULL) return FRIEND_COMPONENTS_OUT_OF_MEMORY; // the bigger sizes array is still valid
+        for (int i = components->capacity; i < new_capacity; i++) {
+            new_parents[i] = NOT_A_MEMBER;
+        }
+        components->parents = new_parents;
+        components->capacity = new_capacity;
+    }
+    components->parents[index] = index;
+    components->sizes[index] = 1;
+    components->count++;
+    if (components->largest == 0) {
+        components->largest = 1;
+    }
+    return FRIEND_COMPONENTS_OK;
+}
+
+/**
+ * friendComponentsUnite - unites the components of the two given members (a friendship between them was added)
+ * @param components - the union-find to update
+ * @param index1 - the index of the first member
+ * @param index2 - the index of the second member
+ * @return
+ * FRIEND_COMPONENTS_NULL_ARGUMENT - if components is NULL
+ * FRIEND_COMPONENTS_DOES_NOT_EXIST - if one of the indexes is not a member
+ * FRIEND_COMPONENTS_OK - otherwise (also if they are already in the same component)
+ */
+FriendComponentsResult friendComponentsUnite(FriendComponents components, int index1, int index2) {
+    if (components == NULL) return FRIEND_COMPONENTS_NULL_ARGUMENT;
+    if (!isMember(components, index1) || !isMember(components, index2)) return FRIEND_COMPONENTS_DOES_NOT_EXIST;
+    int root1 = findRoot(components, index1), root2 = findRoot(components, index2);
+    if (root1 == root2) return FRIEND_COMPONENTS_OK;
+    if (components->sizes[root1] < components->sizes[root2]) { // hang the smaller tree under the bigger one
+        int temp = root1;
+        root1 = root2;
+        root2 = temp;
+    }
+    components->parents[root2] = root1;
+    components->sizes[root1] += components->sizes[root2];
+    components->count--;
+    if (components->sizes[root1] > components->largest) {
+        components->largest = components->sizes[root1];
+    }
+    return FRIEND_COMPONENTS_OK;
+}
+
+/**
+ * friendComponentsGetSize - returns the number of members in the component of the given member
+ * @param components - the union-find to search in
+ * @param index - the index of the member
+ * @return the size of the member's component. 0 if the index is not a member (or components is NULL)
+ */
+int friendComponentsGetSize(FriendComponents components, int index) {
+    if (components == NULL || !isMember(components, index)) return 0;
+    return components->sizes[findRoot(components, index)];
+}
+
+/**
+ * friendComponentsGetCount - returns the number of components
+ * @param components - the union-find
+ * @return the number of components. -1 if components is NULL
+ */
+int friendComponentsGetCount(FriendComponents components) {
+    if (components == NULL) return -1;
+    return components->count;
+}
+
+/**
+ * friendComponentsGetLargestSize - returns the number of members in the largest component
+ * @param components - the union-find
+ * @return the size of the largest component (0 if there are no members). -1 if components is NULL
+ */
+int friendComponentsGetLargestSize(FriendComponents components) {
+    if (components == NULL) return -1;
+    return components->largest;
+}
+
+/**
+ * friendComponentsClear - removes all the members, so the components can be built again. the memory is kept for the
+ * next members
+ * @param components - the union-find to clear. if components is NULL nothing will be done
+ */
+void friendComponentsClear(FriendComponents components) {
+    if (components == NULL) return;
+    for (int i = 0; i < components->capacity; i++) {
+        components->parents[i] = NOT_A_MEMBER;
+    }
+    components->count = 0;
+    components->largest = 0;
+}
+
+/**
+ * friendComponentsDestroy - deallocate all the memory of the union-find
+ * @param components - the union-find to destroy. if components is NULL nothing will be done
+ */
+void friendComponentsDestroy(FriendComponents components) {
+    if (components == NULL) return;
+    free(components->parents);
+    free(components->sizes);
+    free(components);
+}
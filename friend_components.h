@@ -0,0 +1,91 @@
+#ifndef EX3_FRIEND_COMPONENTS_H
+#define EX3_FRIEND_COMPONENTS_H
+
+/**
+ * Union-find (disjoint sets) of students, for the connected components of the friendships graph.
+ *
+ * The students are given by dense indexes (like their slots in a StudentDirectory), and an index is a member only
+ * after it is added. friendships can only be added (by uniting their components) - removing a friendship may split a
+ * component, so the components must then be cleared and built again.
+ */
+typedef struct friend_components_t *FriendComponents;
+
+/** Type used for returning error codes from functions */
+typedef enum FriendComponentsResult_t {
+    FRIEND_COMPONENTS_OK,
+    FRIEND_COMPONENTS_NULL_ARGUMENT,
+    FRIEND_COMPONENTS_OUT_OF_MEMORY,
+    FRIEND_COMPONENTS_INVALID_PARAMETER,
+    FRIEND_COMPONENTS_ALREADY_EXISTS,
+    FRIEND_COMPONENTS_DOES_NOT_EXIST
+} FriendComponentsResult;
+
+/**
+ * friendComponentsCreate - creates a new union-find without members
+ * @return
+ * NULL - if allocations failed.
+ * A new FriendComponents in case of success.
+ */
+FriendComponents friendComponentsCreate();
+
+/**
+ * friendComponentsAdd - adds the given index as a member, in a new component of its own
+ * @param components - the union-find to add the member to
+ * @param index - the index of the new member (must not be negative)
+ * @return
+ * FRIEND_COMPONENTS_NULL_ARGUMENT - if components is NULL
+ * FRIEND_COMPONENTS_INVALID_PARAMETER - if the index is negative
+ * FRIEND_COMPONENTS_ALREADY_EXISTS - if the index is already a member
+ * FRIEND_COMPONENTS_OUT_OF_MEMORY - if there was a memory error (the union-find is not changed)
+ * FRIEND_COMPONENTS_OK - otherwise
+ */
+FriendComponentsResult friendComponentsAdd(FriendComponents components, int index);
+
+/**
+ * friendComponentsUnite - unites the components of the two given members (a friendship between them was added)
+ * @param components - the union-find to update
+ * @param index1 - the index of the first member
+ * @param index2 - the index of the second member
+ * @return
+ * FRIEND_COMPONENTS_NULL_ARGUMENT - if components is NULL
+ * FRIEND_COMPONENTS_DOES_NOT_EXIST - if one of the indexes is not a member
+ * FRIEND_COMPONENTS_OK - otherwise (also if they are already in the same component)
+ */
+FriendComponentsResult friendComponentsUnite(FriendComponents components, int index1, int index2);
+
+/**
+ * friendComponentsGetSize - returns the number of members in the component of the given member
+ * @param components - the union-find to search in
+ * @param index - the index of the member
+ * @return the size of the member's component. 0 if the index is not a member (or components is NULL)
+ */
+int friendComponentsGetSize(FriendComponents components, int index);
+
+/**
+ * friendComponentsGetCount - returns the number of components
+ * @param components - the union-find
+ * @return the number of components. -1 if components is NULL
+ */
+int friendComponentsGetCount(FriendComponents components);
+
+/**
+ * friendComponentsGetLargestSize - returns the number of members in the largest component
+ * @param components - the union-find
+ * @return the size of the largest component (0 if there are no members). -1 if components is NULL
+ */
+int friendComponentsGetLargestSize(FriendComponents components);
+
+/**
+ * friendComponentsClear - removes all the members, so the components can be built again. the memory is kept for the
+ * next members
+ * @param components - the union-find to clear. if components is NULL nothing will be done
+ */
+void friendComponentsClear(FriendComponents components);
+
+/**
+ * friendComponentsDestroy - deallocate all the memory of the union-find
+ * @param components - the union-find to destroy. if components is NULL nothing will be done
+ */
+void friendComponentsDestroy(FriendComponents components);
+
+#endif //EX3_FRIEND_COMPONENTS_H
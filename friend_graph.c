@@ -0,0 +1,163 @@
+#include "friend_graph.h"
+#include <stdlib.h>
+
+typedef struct friend_graph_t {
+    int* offsets; // the neighbours of vertex v are neighbours[offsets[v]] to neighbours[offsets[v + 1] - 1]
+    int* neighbours;
+    bool* vertices; // whether every vertex index is in the graph
+    int vertex_count;
+    int vertex_capacity; // the number of vertices offsets and vertices have room for (they have one extra place)
+    int edge_capacity;
+} friend_graph_t;
+
+/**
+ * friendGraphClear - inner function that leaves the graph without vertices (the memory is kept)
+ */
+static void friendGraphClear(FriendGraph graph) {
+    graph->vertex_count = 0;
+    if (graph->offsets != NULL) {
+        graph->offsets[0] = 0;
+    }
+}
+
+/**
+ * friendGraphReserve - inner function that makes sure the graph has room for the given numbers of vertices and edges
+ * @return false if there was a memory error (the reallocated arrays are still valid), true otherwise
+ */
+static bool friendGraphReserve(FriendGraph graph, int vertex_count, int edge_count) {
+    if (graph->offsets == NULL || vertex_count > graph->vertex_capacity) {
+        int* new_offsets = (int*) realloc(graph->offsets, sizeof(int) * (vertex_count + 1));
+        if (new_offsets == NULL) return false;
+        graph->offsets = new_offsets;
+        bool* new_vertices = (bool*) realloc(graph->vertices, sizeof(bool) * (vertex_count + 1));
+        if (new_vertices == NULL) return false;
+        graph->vertices = new_vertices;
+        graph->vertex_capacity = vertex_count;
+    }
+    if (edge_count > graph->edge_capacity) {
+        int* new_neighbours = (int*) realloc(graph->neighbours, sizeof(int) * edge_count);
+        if (new_neighbours == NULL) return false;
+        graph->neighbours = new_neighbours;
+        graph->edge_capacity = edge_count;
+    }
+    return true;
+}
+
+/**
+ * friendGraphCreate - creates a new empty graph
+ * @return
+ * NULL - if allocations failed.
+ * A new FriendGraph in case of success.
+ */
+FriendGraph friendGraphCreate() {
+    FriendGraph graph = (FriendGraph) malloc(sizeof(*graph));
+    if (graph == NULL) return NULL;
+    graph->offsets = NULL;
+    graph->neighbours = NULL;
+    graph->vertices = NULL;
+    graph->vertex_count = 0;
+    graph->vertex_capacity = 0;
+    graph->edge_capacity = 0;
+    return graph;
+}
+
+/**
+ * friendGraphBuild - builds the graph again with the given vertices. the neighbours function is called twice for every
+ * vertex - first to count its neighbours, and then to write them. the memory of the previous graph is reused.
+ * @param graph - the graph to build
+ * @param vertex_count - the vertices of the graph are lower than it (must not be negative)
+ * @param neighbours - the function that returns the neighbours of every vertex
+ * @param context - passed as is to the neighbours function
+ * @return
+ * FRIEND_GRAPH_NULL_ARGUMENT - if the graph or the neighbours function is NULL
+ * FRIEND_GRAPH_INVALID_PARAMETER - if vertex_count is negative
+ * FRIEND_GRAPH_OUT_OF_MEMORY - if there was a memory error (the graph is left empty)
+ * FRIEND_GRAPH_OK - otherwise
+ */
+FriendGraphResult friendGraphBuild(FriendGraph graph, int vertex_count, FriendGraphNeighboursFunction neighbours,
+                                   void* context) {
+    if (graph == NULL || neighbours == NULL) return FRIEND_GRAPH_NULL_ARGUMENT;
+    if (vertex_count < 0) return FRIEND_GRAPH_INVALID_PARAMETER;
+    friendGraphClear(graph);
+    if (!friendGraphReserve(graph, vertex_count, 0)) return FRIEND_GRAPH_OUT_OF_MEMORY;
+    // count the neighbours of every vertex, and turn the counts into offsets
+    int edge_count = 0;
+    for (int vertex = 0; vertex < vertex_count; vertex++) {
+        int degree = neighbours(vertex, NULL, context);
+        graph->vertices[vertex] = (degree != -1);
+        graph->offsets[vertex] = edge_count;
+        edge_count += (degree == -1) ? 0 : degree;
+    }
+    graph->offsets[vertex_count] = edge_count;
+    if (!friendGraphReserve(graph, vertex_count, edge_count)) {
+        friendGraphClear(graph);
+        return FRIEND_GRAPH_OUT_OF_MEMORY;
+    }
+    for (int vertex = 0; vertex < vertex_count; vertex++) {
+        if (graph->offsets[vertex + 1] > graph->offsets[vertex]) {
+            neighbours(vertex, graph->neighbours + graph->offsets[vertex], context);
+        }
+    }
+    graph->vertex_count = vertex_count;
+    return FRIEND_GRAPH_OK;
+}
+
+/**
+ * friendGraphGetVertexCount - returns the number of vertex indexes in the graph (the vertices are lower than it)
+ * @param graph - the graph
+ * @return the number of vertex indexes. -1 if the graph is NULL
+ */
+int friendGraphGetVertexCount(FriendGraph graph) {
+    if (graph == NULL) return -1;
+    return graph->vertex_count;
+}
+
+/**
+ * friendGraphGetEdgeCount - returns the number of neighbours of all the vertices together (every friendship is
+ * counted twice, once for each of its sides)
+ * @param graph - the graph
+ * @return the number of neighbours. -1 if the graph is NULL
+ */
+int friendGraphGetEdgeCount(FriendGraph graph) {
+    if (graph == NULL) return -1;
+    return (graph->vertex_count == 0) ? 0 : graph->offsets[graph->vertex_count];
+}
+
+/**
+ * friendGraphHasVertex - checks if the given vertex is in the graph
+ * @param graph - the graph
+ * @param vertex - the vertex to check
+ * @return true if the vertex is in the graph, false otherwise (or if the graph is NULL)
+ */
+bool friendGraphHasVertex(FriendGraph graph, int vertex) {
+    if (graph == NULL || vertex < 0 || vertex >= graph->vertex_count) return false;
+    return graph->vertices[vertex];
+}
+
+/**
+ * friendGraphGetNeighbours - returns the neighbours of the given vertex
+ * @param graph - the graph
+ * @param vertex - the vertex to get its neighbours
+ * @param degree - pointer to save the number of neighbours to (0 if the vertex is not in the graph)
+ * @return the neighbours, owned by the graph and valid until it is built again. NULL if there are none (or one of the
+ * arguments is NULL)
+ */
+const int* friendGraphGetNeighbours(FriendGraph graph, int vertex, int* degree) {
+    if (degree == NULL) return NULL;
+    *degree = 0;
+    if (!friendGraphHasVertex(graph, vertex)) return NULL;
+    *degree = graph->offsets[vertex + 1] - graph->offsets[vertex];
+    return (*degree == 0) ? NULL : graph->neighbours + graph->offsets[vertex];
+}
+
+/**
+ * friendGraphDestroy - deallocate all the memory of the graph
+ * @param graph - the graph to destroy. if graph is NULL nothing will be done
+ */
+void friendGraphDestroy(FriendGraph graph) {
+    if (graph == NULL) return;
+    free(graph->offsets);
+    free(graph->neighbours);
+    free(graph->vertices);
+    free(graph);
+}
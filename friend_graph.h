@@ -0,0 +1,95 @@
+#ifndef EX3_FRIEND_GRAPH_H
+#define EX3_FRIEND_GRAPH_H
+
+#include <stdbool.h>
+
+/**
+ * A frozen snapshot of the friendships graph, in compressed sparse row layout.
+ *
+ * The vertices are dense indexes (like the students' slots in a StudentDirectory). the neighbours of all the vertices
+ * are kept in one contiguous array, where the neighbours of vertex v are at [offsets[v], offsets[v + 1]), so going
+ * over the graph does not chase pointers. the snapshot does not change with the friendships - it must be built again.
+ */
+typedef struct friend_graph_t *FriendGraph;
+
+/**
+ * Type of the function friendGraphBuild calls to get the neighbours of every vertex.
+ * @param vertex - the vertex to get its neighbours
+ * @param neighbours - array to write the neighbours to, or NULL to only count them
+ * @param context - the context given to friendGraphBuild
+ * @return the number of neighbours of the vertex (the same number in both calls). -1 if the vertex is not in the graph
+ */
+typedef int (*FriendGraphNeighboursFunction)(int vertex, int* neighbours, void* context);
+
+/** Type used for returning error codes from functions */
+typedef enum FriendGraphResult_t {
+    FRIEND_GRAPH_OK,
+    FRIEND_GRAPH_NULL_ARGUMENT,
+    FRIEND_GRAPH_OUT_OF_MEMORY,
+    FRIEND_GRAPH_INVALID_PARAMETER
+} FriendGraphResult;
+
+/**
+ * friendGraphCreate - creates a new empty graph
+ * @return
+ * NULL - if allocations failed.
+ * A new FriendGraph in case of success.
+ */
+FriendGraph friendGraphCreate();
+
+/**
+ * friendGraphBuild - builds the graph again with the given vertices. the neighbours function is called twice for every
+ * vertex - first to count its neighbours, and then to write them. the memory of the previous graph is reused.
+ * @param graph - the graph to build
+ * @param vertex_count - the vertices of the graph are lower than it (must not be negative)
+ * @param neighbours - the function that returns the neighbours of every vertex
+ * @param context - passed as is to the neighbours function
+ * @return
+ * FRIEND_GRAPH_NULL_ARGUMENT - if the graph or the neighbours function is NULL
+ * FRIEND_GRAPH_INVALID_PARAMETER - if vertex_count is negative
+ * FRIEND_GRAPH_OUT_OF_MEMORY - if there was a memory error (the graph is left empty)
+ * FRIEND_GRAPH_OK - otherwise
+ */
+FriendGraphResult friendGraphBuild(FriendGraph graph, int vertex_count, FriendGraphNeighboursFunction neighbours,
+                                   void* context);
+
+/**
+ * friendGraphGetVertexCount - returns the number of vertex indexes in the graph (the vertices are lower than it)
+ * @param graph - the graph
+ * @return the number of vertex indexes. -1 if the graph is NULL
+ */
+int friendGraphGetVertexCount(FriendGraph graph);
+
+/**
+ * friendGraphGetEdgeCount - returns the number of neighbours of all the vertices together (every friendship is
+ * counted twice, once for each of its sides)
+ * @param graph - the graph
+ * @return the number of neighbours. -1 if the graph is NULL
+ */
+int friendGraphGetEdgeCount(FriendGraph graph);
+
+/**
+ * friendGraphHasVertex - checks if the given vertex is in the graph
+ * @param graph - the graph
+ * @param vertex - the vertex to check
+ * @return true if the vertex is in the graph, false otherwise (or if the graph is NULL)
+ */
+bool friendGraphHasVertex(FriendGraph graph, int vertex);
+
+/**
+ * friendGraphGetNeighbours - returns the neighbours of the given vertex
+ * @param graph - the graph
+ * @param vertex - the vertex to get its neighbours
+ * @param degree - pointer to save the number of neighbours to (0 if the vertex is not in the graph)
+ * @return the neighbours, owned by the graph and valid until it is built again. NULL if there are none (or one of the
+ * arguments is NULL)
+ */
+const int* friendGraphGetNeighbours(FriendGraph graph, int vertex, int* degree);
+
+/**
+ * friendGraphDestroy - deallocate all the memory of the graph
+ * @param graph - the graph to destroy. if graph is NULL nothing will be done
+ */
+void friendGraphDestroy(FriendGraph graph);
+
+#endif //EX3_FRIEND_GRAPH_H
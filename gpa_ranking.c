@@ -0,0 +1,339 @@
+#include "gpa_ranking.h"
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define GPA_RANKING_INITIAL_CAPACITY 64
+#define GPA_RANKING_MAX_HEIGHT 64 // an AVL tree of less than 2^31 nodes is less than 46 levels high
+#define NO_NODE (-1)
+
+typedef struct ranking_node_t {
+    int id;
+    int grade_sum_x2;
+    int points_x2;
+    int left; // NO_NODE if there is none. the free nodes are chained by it
+    int right; // NO_NODE if there is none
+    int height;
+    int size; // the number of nodes in the subtree of the node (including it)
+} ranking_node_t;
+
+typedef struct gpa_ranking_t {
+    ranking_node_t* nodes;
+    int capacity;
+    int used_count; // the number of nodes that were given so far (the nodes from it on were never used)
+    int free_nodes; // the first removed node, ready for reuse (NO_NODE if there is none)
+    int root;
+} gpa_ranking_t;
+
+/**
+ * compareRanks - inner function that compares the ranks of two students by their totals
+ * @return negative number if the first student is ranked before the second, positive number if he is ranked after,
+ * 0 if they have the same id and average
+ */
+static int compareRanks(int id1, int grade_sum_x2_1, int points_x2_1, int id2, int grade_sum_x2_2, int points_x2_2) {
+    if ((points_x2_1 == 0) != (points_x2_2 == 0)) return (points_x2_1 == 0) ? 1 : -1;
+    if (points_x2_1 != 0) { // compare the averages without dividing
+        long long average1 = (long long)grade_sum_x2_1 * points_x2_2;
+        long long average2 = (long long)grade_sum_x2_2 * points_x2_1;
+        if (average1 != average2) return (average1 > average2) ? -1 : 1;
+    }
+    return (id1 > id2) - (id1 < id2);
+}
+
+/**
+ * compareToNode - inner function that compares the rank of the given student to the rank of the student of the node
+ */
+static int compareToNode(GpaRanking ranking, int node, int id, int grade_sum_x2, int points_x2) {
+    ranking_node_t* other = &ranking->nodes[node];
+    return compareRanks(id, grade_sum_x2, points_x2, other->id, other->grade_sum_x2, other->points_x2);
+}
+
+static int nodeHeight(GpaRanking ranking, int node) {
+    return (node == NO_NODE) ? 0 : ranking->nodes[node].height;
+}
+
+static int nodeSize(GpaRanking ranking, int node) {
+    return (node == NO_NODE) ? 0 : ranking->nodes[node].size;
+}
+
+/**
+ * updateNode - inner function that calculates the height and the size of the node again, from its children
+ */
+static void updateNode(GpaRanking ranking, int node) {
+    ranking_node_t* current = &ranking->nodes[node];
+    int left_height = nodeHeight(ranking, current->left), right_height = nodeHeight(ranking, current->right);
+    current->height = 1 + ((left_height > right_height) ? left_height : right_height);
+    current->size = 1 + nodeSize(ranking, current->left) + nodeSize(ranking, current->right);
+}
+
+/**
+ * rotateRight - inner function that lifts the left child of the node above it
+ * @return the new root of the subtree
+ */
+static int rotateRight(GpaRanking ranking, int node) {
+    int left = ranking->nodes[node].left;
+    ranking->nodes[node].left = ranking->nodes[left].right;
+    ranking->nodes[left].right = node;
+    updateNode(ranking, node);
+    updateNode(ranking, left);
+    return left;
+}
+
+/**
+ * rotateLeft - inner function that lifts the right child of the node above it
+ * @return the new root of the subtree
+ */
+static int rotateLeft(GpaRanking ranking, int node) {
+    int right = ranking->nodes[node].right;
+    ranking->nodes[node].right = ranking->nodes[right].left;
+    ranking->nodes[right].left = node;
+    updateNode(ranking, node);
+    updateNode(ranking, right);
+    return right;
+}
+
+/**
+ * balanceNode - inner function that updates the node after one of its subtrees was changed, and rotates it if the
+ * heights of its subtrees differ by more than 1
+ * @return the new root of the subtree
+ */
+static int balanceNode(GpaRanking ranking, int node) {
+    updateNode(ranking, node);
+    ranking_node_t* current = &ranking->nodes[node];
+    int balance = nodeHeight(ranking, current->left) - nodeHeight(ranking, current->right);
+    if (balance > 1) {
+        int left = current->left;
+        if (nodeHeight(ranking, ranking->nodes[left].left) < nodeHeight(ranking, ranking->nodes[left].right)) {
+            current->left = rotateLeft(ranking, left);
+        }
+        return rotateRight(ranking, node);
+    }
+    if (balance < -1) {
+        int right = current->right;
+        if (nodeHeight(ranking, ranking->nodes[right].right) < nodeHeight(ranking, ranking->nodes[right].left)) {
+            current->right = rotateRight(ranking, right);
+        }
+        return rotateLeft(ranking, node);
+    }
+    return node;
+}
+
+/**
+ * insertNode - inner function that inserts the given node to the subtree of the given root
+ * @return the new root of the subtree
+ */
+static int insertNode(GpaRanking ranking, int root, int node) {
+    if (root == NO_NODE) return node;
+    ranking_node_t* new_node = &ranking->nodes[node];
+    if (compareToNode(ranking, root, new_node->id, new_node->grade_sum_x2, new_node->points_x2) < 0) {
+        ranking->nodes[root].left = insertNode(ranking, ranking->nodes[root].left, node);
+    } else {
+        ranking->nodes[root].right = insertNode(ranking, ranking->nodes[root].right, node);
+    }
+    return balanceNode(ranking, root);
+}
+
+/**
+ * removeFirstNode - inner function that takes the first node out of the subtree of the given root
+ * @param first - pointer to save the node that was taken out to
+ * @return the new root of the subtree
+ */
+static int removeFirstNode(GpaRanking ranking, int root, int* first) {
+    if (ranking->nodes[root].left == NO_NODE) {
+        *first = root;
+        return ranking->nodes[root].right;
+    }
+    ranking->nodes[root].left = removeFirstNode(ranking, ranking->nodes[root].left, first);
+    return balanceNode(ranking, root);
+}
+
+/**
+ * removeNode - inner function that takes the node of the given student out of the subtree of the given root
+ * @param removed - pointer to save the node that was taken out to (it is not changed if the student was not found)
+ * @return the new root of the subtree
+ */
+static int removeNode(GpaRanking ranking, int root, int id, int grade_sum_x2, int points_x2, int* removed) {
+    if (root == NO_NODE) return NO_NODE;
+    int compare_result = compareToNode(ranking, root, id, grade_sum_x2, points_x2);
+    if (compare_result < 0) {
+        ranking->nodes[root].left = removeNode(ranking, ranking->nodes[root].left, id, grade_sum_x2, points_x2,
+                                               removed);
+    } else if (compare_result > 0) {
+        ranking->nodes[root].right = removeNode(ranking, ranking->nodes[root].right, id, grade_sum_x2, points_x2,
+                                                removed);
+    } else {
+        *removed = root;
+        int left = ranking->nodes[root].left, right = ranking->nodes[root].right;
+        if (left == NO_NODE) return right;
+        if (right == NO_NODE) return left;
+        // the next node takes the place of the removed one
+        int next = NO_NODE;
+        right = removeFirstNode(ranking, right, &next);
+        ranking->nodes[next].left = left;
+        ranking->nodes[next].right = right;
+        return balanceNode(ranking, next);
+    }
+    return balanceNode(ranking, root);
+}
+
+/**
+ * gpaRankingCreate - creates a new ranking without students
+ * @return
+ * NULL - if allocations failed.
+ * A new GpaRanking in case of success.
+ */
+GpaRanking gpaRankingCreate() {
+    GpaRanking ranking = (GpaRanking) malloc(sizeof(*ranking));
+    if (ranking == NULL) return NULL;
+    ranking->nodes = NULL;
+    ranking->capacity = 0;
+    ranking->used_count = 0;
+    ranking->free_nodes = NO_NODE;
+    ranking->root = NO_NODE;
+    return ranking;
+}
+
+/**
+ * gpaRankingInsert - inserts the student with the given id and totals to the ranking
+ * @param ranking - the ranking to insert the student to
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the student's effective grades, each multiplied by its points multiplied by 2
+ * @param points_x2 - the student's effective points multiplied by 2 (must not be negative)
+ * @return
+ * GPA_RANKING_NULL_ARGUMENT - if ranking is NULL
+ * GPA_RANKING_INVALID_PARAMETER - if one of the totals is negative
+ * GPA_RANKING_ALREADY_EXISTS - if the student is already in the ranking with the same average
+ * GPA_RANKING_OUT_OF_MEMORY - if there was a memory error (the ranking is not changed)
+ * GPA_RANKING_OK - otherwise
+ */
+GpaRankingResult gpaRankingInsert(GpaRanking ranking, int id, int grade_sum_x2, int points_x2) {
+    if (ranking == NULL) return GPA_RANKING_NULL_ARGUMENT;
+    if (grade_sum_x2 < 0 || points_x2 < 0) return GPA_RANKING_INVALID_PARAMETER;
+    if (gpaRankingGetRank(ranking, id, grade_sum_x2, points_x2) != -1) return GPA_RANKING_ALREADY_EXISTS;
+    int node = ranking->free_nodes;
+    if (node != NO_NODE) {
+        ranking->free_nodes = ranking->nodes[node].left;
+    } else {
+        if (ranking->used_count == ranking->capacity) {
+            int new_capacity = (ranking->capacity == 0) ? GPA_RANKING_INITIAL_CAPACITY : ranking->capacity * 2;
+            ranking_node_t* new_nodes = (ranking_node_t*) realloc(ranking->nodes, sizeof(*new_nodes) * new_capacity);
+            if (new_nodes == NULL) return GPA_RANKING_OUT_OF_MEMORY;
+            ranking->nodes = new_nodes;
+            ranking->capacity = new_capacity;
+        }
+        node = ranking->used_count++;
+    }
+    ranking_node_t* new_node = &ranking->nodes[node];
+    new_node->id = id;
+    new_node->grade_sum_x2 = grade_sum_x2;
+    new_node->points_x2 = points_x2;
+    new_node->left = NO_NODE;
+    new_node->right = NO_NODE;
+    new_node->height = 1;
+    new_node->size = 1;
+    ranking->root = insertNode(ranking, ranking->root, node);
+    return GPA_RANKING_OK;
+}
+
+/**
+ * gpaRankingRemove - removes the student with the given id, that was inserted with the given totals
+ * @param ranking - the ranking to remove the student from
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the grades the student was inserted with
+ * @param points_x2 - the points the student was inserted with
+ * @return
+ * GPA_RANKING_NULL_ARGUMENT - if ranking is NULL
+ * GPA_RANKING_DOES_NOT_EXIST - if the student is not in the ranking with the average of these totals
+ * GPA_RANKING_OK - otherwise
+ */
+GpaRankingResult gpaRankingRemove(GpaRanking ranking, int id, int grade_sum_x2, int points_x2) {
+    if (ranking == NULL) return GPA_RANKING_NULL_ARGUMENT;
+    int removed = NO_NODE;
+    ranking->root = removeNode(ranking, ranking->root, id, grade_sum_x2, points_x2, &removed);
+    if (removed == NO_NODE) return GPA_RANKING_DOES_NOT_EXIST;
+    ranking->nodes[removed].left = ranking->free_nodes;
+    ranking->free_nodes = removed;
+    return GPA_RANKING_OK;
+}
+
+/**
+ * gpaRankingGetRank - returns the rank of the student with the given id, that was inserted with the given totals
+ * @param ranking - the ranking to search in
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the grades the student was inserted with
+ * @param points_x2 - the points the student was inserted with
+ * @return the rank of the student (starting from 1). -1 if he is not in the ranking with the average of these totals
+ * (or ranking is NULL)
+ */
+int gpaRankingGetRank(GpaRanking ranking, int id, int grade_sum_x2, int points_x2) {
+    if (ranking == NULL) return -1;
+    int ranked_before = 0, node = ranking->root;
+    while (node != NO_NODE) {
+        int compare_result = compareToNode(ranking, node, id, grade_sum_x2, points_x2);
+        if (compare_result < 0) {
+            node = ranking->nodes[node].left;
+        } else {
+            ranked_before += nodeSize(ranking, ranking->nodes[node].left);
+            if (compare_result == 0) return ranked_before + 1;
+            ranked_before++; // the student of the node
+            node = ranking->nodes[node].right;
+        }
+    }
+    return -1;
+}
+
+/**
+ * gpaRankingGetSize - returns the number of students in the ranking
+ * @param ranking - the ranking
+ * @return the number of students. -1 if ranking is NULL
+ */
+int gpaRankingGetSize(GpaRanking ranking) {
+    if (ranking == NULL) return -1;
+    return nodeSize(ranking, ranking->root);
+}
+
+/**
+ * gpaRankingForEachTop - calls the given visitor for the best students of the ranking, from the best one
+ * @param ranking - the ranking to go over
+ * @param amount - the number of students to go over (if there are less students - all of them are gone over)
+ * @param visitor - the function to call for every student
+ * @param context - passed as is to the visitor
+ * @return the number of students that were gone over. -1 if ranking or visitor is NULL
+ */
+int gpaRankingForEachTop(GpaRanking ranking, int amount, GpaRankingVisitor visitor, void* context) {
+    if (ranking == NULL || visitor == NULL) return -1;
+    int path[GPA_RANKING_MAX_HEIGHT]; // the nodes whose left subtree is being gone over
+    int path_length = 0, visited = 0, node = ranking->root;
+    while (visited < amount && (node != NO_NODE || path_length > 0)) {
+        if (node != NO_NODE) {
+            path[path_length++] = node;
+            node = ranking->nodes[node].left;
+            continue;
+        }
+        ranking_node_t* current = &ranking->nodes[path[--path_length]];
+        visitor(++visited, current->id, current->grade_sum_x2, current->points_x2, context);
+        node = current->right;
+    }
+    return visited;
+}
+
+/**
+ * gpaRankingClear - removes all the students, so the ranking can be built again. the memory is kept for the next
+ * students
+ * @param ranking - the ranking to clear. if ranking is NULL nothing will be done
+ */
+void gpaRankingClear(GpaRanking ranking) {
+    if (ranking == NULL) return;
+    ranking->used_count = 0;
+    ranking->free_nodes = NO_NODE;
+    ranking->root = NO_NODE;
+}
+
+/**
+ * gpaRankingDestroy - deallocate all the memory of the ranking
+ * @param ranking - the ranking to destroy. if ranking is NULL nothing will be done
+ */
+void gpaRankingDestroy(GpaRanking ranking) {
+    if (ranking == NULL) return;
+    free(ranking->nodes);
+    free(ranking);
+}
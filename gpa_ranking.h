@@ -0,0 +1,114 @@
+#ifndef EX3_GPA_RANKING_H
+#define EX3_GPA_RANKING_H
+
+/**
+ * The ranking of the students by their effective average (the average of their clean sheet, weighted by the points).
+ *
+ * An order-statistic tree: a balanced (AVL) search tree, where every node also keeps the number of nodes under it, so
+ * the rank of a student is found in O(log N), and the best n students are gone over in O(log N + n). a student with a
+ * higher average is ranked before, and students with the same average are ranked by their ids. students without
+ * effective points are ranked after all the others. the nodes are kept in one array, and removed nodes are reused.
+ *
+ * The tree does not keep the averages of the students by their ids - a student is found by the totals he was inserted
+ * with, so the totals must be removed (with the old values) before they are changed.
+ */
+typedef struct gpa_ranking_t *GpaRanking;
+
+/**
+ * Type of the function gpaRankingForEachTop calls for every ranked student.
+ * @param rank - the rank of the student (starting from 1)
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the student's effective grades, each multiplied by its points multiplied by 2
+ * @param points_x2 - the student's effective points multiplied by 2
+ * @param context - the context given to gpaRankingForEachTop
+ */
+typedef void (*GpaRankingVisitor)(int rank, int id, int grade_sum_x2, int points_x2, void* context);
+
+/** Type used for returning error codes from functions */
+typedef enum GpaRankingResult_t {
+    GPA_RANKING_OK,
+    GPA_RANKING_NULL_ARGUMENT,
+    GPA_RANKING_OUT_OF_MEMORY,
+    GPA_RANKING_INVALID_PARAMETER,
+    GPA_RANKING_ALREADY_EXISTS,
+    GPA_RANKING_DOES_NOT_EXIST
+} GpaRankingResult;
+
+/**
+ * gpaRankingCreate - creates a new ranking without students
+ * @return
+ * NULL - if allocations failed.
+ * A new GpaRanking in case of success.
+ */
+GpaRanking gpaRankingCreate();
+
+/**
+ * gpaRankingInsert - inserts the student with the given id and totals to the ranking
+ * @param ranking - the ranking to insert the student to
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the student's effective grades, each multiplied by its points multiplied by 2
+ * @param points_x2 - the student's effective points multiplied by 2 (must not be negative)
+ * @return
+ * GPA_RANKING_NULL_ARGUMENT - if ranking is NULL
+ * GPA_RANKING_INVALID_PARAMETER - if one of the totals is negative
+ * GPA_RANKING_ALREADY_EXISTS - if the student is already in the ranking with the same average
+ * GPA_RANKING_OUT_OF_MEMORY - if there was a memory error (the ranking is not changed)
+ * GPA_RANKING_OK - otherwise
+ */
+GpaRankingResult gpaRankingInsert(GpaRanking ranking, int id, int grade_sum_x2, int points_x2);
+
+/**
+ * gpaRankingRemove - removes the student with the given id, that was inserted with the given totals
+ * @param ranking - the ranking to remove the student from
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the grades the student was inserted with
+ * @param points_x2 - the points the student was inserted with
+ * @return
+ * GPA_RANKING_NULL_ARGUMENT - if ranking is NULL
+ * GPA_RANKING_DOES_NOT_EXIST - if the student is not in the ranking with the average of these totals
+ * GPA_RANKING_OK - otherwise
+ */
+GpaRankingResult gpaRankingRemove(GpaRanking ranking, int id, int grade_sum_x2, int points_x2);
+
+/**
+ * gpaRankingGetRank - returns the rank of the student with the given id, that was inserted with the given totals
+ * @param ranking - the ranking to search in
+ * @param id - the id of the student
+ * @param grade_sum_x2 - the sum of the grades the student was inserted with
+ * @param points_x2 - the points the student was inserted with
+ * @return the rank of the student (starting from 1). -1 if he is not in the ranking with the average of these totals
+ * (or ranking is NULL)
+ */
+int gpaRankingGetRank(GpaRanking ranking, int id, int grade_sum_x2, int points_x2);
+
+/**
+ * gpaRankingGetSize - returns the number of students in the ranking
+ * @param ranking - the ranking
+ * @return the number of students. -1 if ranking is NULL
+ */
+int gpaRankingGetSize(GpaRanking ranking);
+
+/**
+ * gpaRankingForEachTop - calls the given visitor for the best students of the ranking, from the best one
+ * @param ranking - the ranking to go over
+ * @param amount - the number of students to go over (if there are less students - all of them are gone over)
+ * @param visitor - the function to call for every student
+ * @param context - passed as is to the visitor
+ * @return the number of students that were gone over. -1 if ranking or visitor is NULL
+ */
+int gpaRankingForEachTop(GpaRanking ranking, int amount, GpaRankingVisitor visitor, void* context);
+
+/**
+ * gpaRankingClear - removes all the students, so the ranking can be built again. the memory is kept for the next
+ * students
+ * @param ranking - the ranking to clear. if ranking is NULL nothing will be done
+ */
+void gpaRankingClear(GpaRanking ranking);
+
+/**
+ * gpaRankingDestroy - deallocate all the memory of the ranking
+ * @param ranking - the ranking to destroy. if ranking is NULL nothing will be done
+ */
+void gpaRankingDestroy(GpaRanking ranking);
+
+#endif //EX3_GPA_RANKING_H
@@ -1,13 +1,13 @@
 #include "grade.h"
 #include <string.h>
 #include <stdlib.h>
+#include "ownership.h"
 
 typedef struct grade_t {
-    int course_id;
-    int course_points_integer;
-    int course_points_partial;
+    Course course; // the shared metadata of the course (id and points)
     int grade_number;
     int semester_number;
+    int column_row; // the row of the grade in a GradeColumns mirror, -1 if it is not in one
 } grade_t;
 
 /**
@@ -41,7 +41,25 @@ static bool parsePoints(char* points, int* number, int* partial) {
 }
 
 /**
- * gradeCreate - creates new grade
+ * gradeParsePointsX2 - parses the given points of a course into the points multiple by 2
+ * @param points - the points. must be in the format of: X or X.0 or X.5
+ * while X is not empty and contains only digits
+ * @param points_x2 - pointer to save the points multiple by 2 to
+ * @return
+ * false - if one of the parameters is NULL or points is not in valid format
+ * true - otherwise
+ */
+bool gradeParsePointsX2(char* points, int* points_x2) {
+    if (points == NULL || points_x2 == NULL) return false;
+    int course_points_integer, course_points_partial;
+    if (parsePoints(points, &course_points_integer, &course_points_partial) == false) return false;
+    // if the partial part is not 0, it must be 0.5
+    *points_x2 = course_points_integer * 2 + ((course_points_partial != 0) ? 1 : 0);
+    return true;
+}
+
+/**
+ * gradeCreate - creates new grade. the course entry of the grade is not shared with other grades.
  * @param course_id - the id of the course the grade is attached to. must be positive number lower than 1000000.
  * @param points - the number of points that the course worth. must be in the format of:
  * X or X.0 or X.5
@@ -57,20 +75,45 @@ static bool parsePoints(char* points, int* number, int* partial) {
  * GRADE_OK - otherwise
  */
 GradeResult gradeCreate(int course_id, char* points, int grade_number, int semester_number, Grade *grade) {
+    return gradeCreateWithCatalog(course_id, points, grade_number, semester_number, NULL, grade);
+}
+
+/**
+ * gradeCreateWithCatalog - creates new grade, that references the entry of its course in the given catalog
+ * @param course_id - the id of the course the grade is attached to. must be positive number lower than 1000000.
+ * @param points - the number of points that the course worth. must be in the format of:
+ * X or X.0 or X.5
+ * while X is not empty and contains only digits
+ * @param grade_number - the grade points to add. must be integer between 0 and 100.
+ * @param semester_number - the semester the grade is attached to. must be positive number.
+ * @param courses - the catalog of the courses. if NULL, the course entry is not shared with other grades
+ * @param grade - pointer to the grade that will be created
+ * @return
+ * GRADE_NULL_ARGUMENT - if points is NULL
+ * GRADE_OUT_OF_MEMORY - if there was a memory error
+ * GRADE_INVALID_PARAMETER - if one of the parameters in not valid (course_id is negative or higher than 1000000,
+ * points is not in the valid format, or grade_number is not integer between 0 and 100)
+ * GRADE_OK - otherwise
+ */
+GradeResult gradeCreateWithCatalog(int course_id, char* points, int grade_number, int semester_number,
+                                   CourseCatalog courses, Grade *grade) {
     if (points == NULL) return GRADE_NULL_ARGUMENT;
     if (course_id >= 1000000 || course_id <= 0) return GRADE_INVALID_PARAMETER;
-    int course_points_integer, course_points_partial;
-    if (parsePoints(points, &course_points_integer, &course_points_partial) == false) return GRADE_INVALID_PARAMETER;
+    int points_x2;
+    if (gradeParsePointsX2(points, &points_x2) == false) return GRADE_INVALID_PARAMETER;
     if (grade_number < 0 || grade_number > 100) return GRADE_INVALID_PARAMETER;
     if (semester_number < 0) return GRADE_INVALID_PARAMETER;
 
     Grade new_grade = (Grade) malloc(sizeof(*new_grade));
     if (new_grade == NULL) return GRADE_OUT_OF_MEMORY;
-    new_grade->course_id = course_id;
-    new_grade->course_points_integer = course_points_integer;
-    new_grade->course_points_partial = course_points_partial;
+    new_grade->course = courseCatalogGet(courses, course_id, points_x2);
+    if (new_grade->course == NULL) {
+        free(new_grade);
+        return GRADE_OUT_OF_MEMORY;
+    }
     new_grade->grade_number = grade_number;
     new_grade->semester_number = semester_number;
+    new_grade->column_row = -1;
     *grade = new_grade;
     return GRADE_OK;
 }
@@ -96,9 +139,9 @@ int gradeCompare(Grade grade1, Grade grade2) {
         if (grade1->semester_number < grade2->semester_number) {
             return 1;
         } else if (grade1->semester_number == grade2->semester_number) {
-            if (grade1->course_id < grade2->course_id) {
+            if (courseGetId(grade1->course) < courseGetId(grade2->course)) {
                 return 1;
-            } else if (grade1->course_id == grade2->course_id) {
+            } else if (courseGetId(grade1->course) == courseGetId(grade2->course)) {
                 return 0;
             }
         }
@@ -115,7 +158,7 @@ int gradeCompare(Grade grade1, Grade grade2) {
  */
 bool isGradeIsForCourse(Grade grade, int course_id) {
     if (grade == NULL) return false;
-    return ((grade)->course_id == course_id);
+    return (courseGetId(grade->course) == course_id);
 }
 
 /**
@@ -135,7 +178,7 @@ int getGradeNumber(Grade grade) {
  */
 int getCourseId(Grade grade) {
     if (grade == NULL) return -1;
-    return grade->course_id;
+    return courseGetId(grade->course);
 }
 
 /**
@@ -155,11 +198,27 @@ int getSemester(Grade grade) {
  */
 int getCoursePointsX2(Grade grade) {
     if (grade == NULL) return -1;
-    int points_x2 = (grade->course_points_integer)*2;
-    if (grade->course_points_partial != 0) {
-        points_x2 += 1; // if the partial part is not 0, it must be 0.5
-    }
-    return points_x2;
+    return courseGetPointsX2(grade->course);
+}
+
+/**
+ * gradeGetColumnRow - return the row of the grade in the GradeColumns mirror it is in
+ * @param grade - the grade to get its row
+ * @return the row of the grade. -1 if it is not in a mirror (or the given Grade is NULL)
+ */
+int gradeGetColumnRow(Grade grade) {
+    if (grade == NULL) return -1;
+    return grade->column_row;
+}
+
+/**
+ * gradeSetColumnRow - sets the row of the grade in the GradeColumns mirror it is in. only the mirror sets it
+ * @param grade - the grade to set its row. if grade is NULL nothing will be done
+ * @param row - the new row of the grade, -1 if it left the mirror
+ */
+void gradeSetColumnRow(Grade grade, int row) {
+    if (grade == NULL) return;
+    grade->column_row = row;
 }
 
 /**
@@ -188,14 +247,14 @@ GradeResult gradeUpdateGradeNumber(Grade grade, int new_grade) {
  */
 ListElement gradeCopy(ListElement grade) {
     if (grade == NULL) return NULL;
+    if (isElementAdopted(grade)) return grade;
 
     Grade new_grade = (Grade) malloc(sizeof(*new_grade));
     if (new_grade == NULL) return NULL;
-    new_grade->course_id = ((Grade)grade)->course_id;
-    new_grade->course_points_integer = ((Grade)grade)->course_points_integer;
-    new_grade->course_points_partial = ((Grade)grade)->course_points_partial;
+    new_grade->course = courseRetain(((Grade)grade)->course);
     new_grade->grade_number = ((Grade)grade)->grade_number;
     new_grade->semester_number = ((Grade)grade)->semester_number;
+    new_grade->column_row = -1; // the copy is not in the mirror of the original
     return new_grade;
 }
 
@@ -206,7 +265,8 @@ ListElement gradeCopy(ListElement grade) {
  */
 void gradePrintInfo(Grade grade, FILE* output_channel) {
     if (grade == NULL || output_channel == NULL) return;
-    mtmPrintGradeInfo(output_channel, grade->course_id, getCoursePointsX2(grade), grade->grade_number);
+    mtmPrintGradeInfo(output_channel, courseGetId(grade->course), courseGetPointsX2(grade->course),
+                      grade->grade_number);
 }
 
 /**
@@ -215,5 +275,7 @@ void gradePrintInfo(Grade grade, FILE* output_channel) {
  * if grade is NULL nothing will be done
  */
 void gradeDestroy(ListElement grade) {
+    if (grade == NULL) return;
+    courseRelease(((Grade)grade)->course);
     free((Grade)grade);
 }
\ No newline at end of file
@@ -4,9 +4,13 @@
 #include "list.h"
 #include "set.h"
 #include "mtm_ex3.h"
+#include "course_catalog.h"
 
 typedef struct grade_t *Grade;
 
+/** Type of function that is called on every grade of a semester or a student */
+typedef void (*GradeVisitor)(Grade grade, void* context);
+
 /** Type used for returning error codes from functions */
 typedef enum GradeResult_t {
     GRADE_OK,
@@ -16,7 +20,18 @@ typedef enum GradeResult_t {
 } GradeResult;
 
 /**
- * gradeCreate - creates new grade
+ * gradeParsePointsX2 - parses the given points of a course into the points multiple by 2
+ * @param points - the points. must be in the format of: X or X.0 or X.5
+ * while X is not empty and contains only digits
+ * @param points_x2 - pointer to save the points multiple by 2 to
+ * @return
+ * false - if one of the parameters is NULL or points is not in valid format
+ * true - otherwise
+ */
+bool gradeParsePointsX2(char* points, int* points_x2);
+
+/**
+ * gradeCreate - creates new grade. the course entry of the grade is not shared with other grades.
  * @param course_id - the id of the course the grade is attached to. must be positive number lower than 1000000.
  * @param points - the number of points that the course worth. must be in the format of:
  * X or X.0 or X.5
@@ -33,6 +48,26 @@ typedef enum GradeResult_t {
  */
 GradeResult gradeCreate(int course_id, char* points, int grade_number,int semester_number, Grade *grade);
 
+/**
+ * gradeCreateWithCatalog - creates new grade, that references the entry of its course in the given catalog
+ * @param course_id - the id of the course the grade is attached to. must be positive number lower than 1000000.
+ * @param points - the number of points that the course worth. must be in the format of:
+ * X or X.0 or X.5
+ * while X is not empty and contains only digits
+ * @param grade_number - the grade points to add. must be integer between 0 and 100.
+ * @param semester_number - the semester the grade is attached to. must be positive number.
+ * @param courses - the catalog of the courses. if NULL, the course entry is not shared with other grades
+ * @param grade - pointer to the grade that will be created
+ * @return
+ * GRADE_NULL_ARGUMENT - if points is NULL
+ * GRADE_OUT_OF_MEMORY - if there was a memory error
+ * GRADE_INVALID_PARAMETER - if one of the parameters in not valid (course_id is negative or higher than 1000000,
+ * points is not in the valid format, or grade_number is not integer between 0 and 100)
+ * GRADE_OK - otherwise
+ */
+GradeResult gradeCreateWithCatalog(int course_id, char* points, int grade_number, int semester_number,
+                                   CourseCatalog courses, Grade *grade);
+
 /**
  * gradeCopy: Creates a copy of target grade.
  *
@@ -94,6 +129,20 @@ int getSemester(Grade grade);
  */
 int getCoursePointsX2(Grade grade);
 
+/**
+ * gradeGetColumnRow - return the row of the grade in the GradeColumns mirror it is in
+ * @param grade - the grade to get its row
+ * @return the row of the grade. -1 if it is not in a mirror (or the given Grade is NULL)
+ */
+int gradeGetColumnRow(Grade grade);
+
+/**
+ * gradeSetColumnRow - sets the row of the grade in the GradeColumns mirror it is in. only the mirror sets it
+ * @param grade - the grade to set its row. if grade is NULL nothing will be done
+ * @param row - the new row of the grade, -1 if it left the mirror
+ */
+void gradeSetColumnRow(Grade grade, int row);
+
 /**
  * gradeUpdateGradeNumber - updates the grade number in given grade to new grade.
  * @param grade - the grade to update it's grade number
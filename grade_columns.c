@@ -0,0 +1,235 @@
+#include "grade_columns.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include "grade_kernels.h"
+
+#define GRADE_COLUMNS_INITIAL_CAPACITY 64
+
+typedef struct grade_columns_t {
+    int* student_ids;
+    int* semesters;
+    int* course_ids;
+    int* points_x2;
+    int* grades;
+    Grade* owners; // the grade of every row, to update its row when the row moves
+    int size;
+    int capacity;
+} grade_columns_t;
+
+/**
+ * gradeColumnsReserve - inner function that makes sure there is room for one more row
+ * @return false if there was a memory error (the columns that were already grown stay valid), true otherwise
+ */
+static bool gradeColumnsReserve(GradeColumns columns) {
+    if (columns->size < columns->capacity) return true;
+    int new_capacity = (columns->capacity == 0) ? GRADE_COLUMNS_INITIAL_CAPACITY : columns->capacity * 2;
+    int** int_columns[] = {&columns->student_ids, &columns->semesters, &columns->course_ids, &columns->points_x2,
+                           &columns->grades};
+    for (int i = 0; i < (int)(sizeof(int_columns) / sizeof(*int_columns)); i++) {
+        int* new_column = (int*) realloc(*int_columns[i], sizeof(int) * new_capacity);
+        if (new_column == NULL) return false;
+        *int_columns[i] = new_column;
+    }
+    Grade* new_owners = (Grade*) realloc(columns->owners, sizeof(Grade) * new_capacity);
+    if (new_owners == NULL) return false;
+    columns->owners = new_owners;
+    columns->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * findRow - inner function that returns the row of the given grade in the mirror, or -1 if it is not in it
+ */
+static int findRow(GradeColumns columns, Grade grade) {
+    int row = gradeGetColumnRow(grade);
+    if (row < 0 || row >= columns->size || columns->owners[row] != grade) return -1;
+    return row;
+}
+
+/**
+ * gradeColumnsCreate - creates a new empty mirror
+ * @return
+ * NULL - if allocations failed.
+ * A new GradeColumns in case of success.
+ */
+GradeColumns gradeColumnsCreate() {
+    GradeColumns columns = (GradeColumns) malloc(sizeof(*columns));
+    if (columns == NULL) return NULL;
+    columns->student_ids = NULL;
+    columns->semesters = NULL;
+    columns->course_ids = NULL;
+    columns->points_x2 = NULL;
+    columns->grades = NULL;
+    columns->owners = NULL;
+    columns->size = 0;
+    columns->capacity = 0;
+    return columns;
+}
+
+/**
+ * gradeColumnsAppend - adds a row for the given grade
+ * @param columns - the mirror to add the grade to
+ * @param student_id - the id of the student the grade belongs to
+ * @param grade - the grade to add. it must stay alive until it is removed from the mirror (or the mirror is destroyed)
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_ALREADY_EXISTS - if the grade is already in a mirror
+ * GRADE_COLUMNS_OUT_OF_MEMORY - if there was a memory error (the mirror is not changed)
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsAppend(GradeColumns columns, int student_id, Grade grade) {
+    if (columns == NULL || grade == NULL) return GRADE_COLUMNS_NULL_ARGUMENT;
+    if (gradeGetColumnRow(grade) != -1) return GRADE_COLUMNS_GRADE_ALREADY_EXISTS;
+    if (!gradeColumnsReserve(columns)) return GRADE_COLUMNS_OUT_OF_MEMORY;
+    int row = columns->size++;
+    columns->student_ids[row] = student_id;
+    columns->semesters[row] = getSemester(grade);
+    columns->course_ids[row] = getCourseId(grade);
+    columns->points_x2[row] = getCoursePointsX2(grade);
+    columns->grades[row] = getGradeNumber(grade);
+    columns->owners[row] = grade;
+    gradeSetColumnRow(grade, row);
+    return GRADE_COLUMNS_OK;
+}
+
+/**
+ * gradeColumnsRemove - removes the row of the given grade (must be called before the grade is destroyed)
+ * @param columns - the mirror to remove the grade from
+ * @param grade - the grade to remove
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_DOES_NOT_EXIST - if the grade is not in this mirror
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsRemove(GradeColumns columns, Grade grade) {
+    if (columns == NULL || grade == NULL) return GRADE_COLUMNS_NULL_ARGUMENT;
+    int row = findRow(columns, grade);
+    if (row == -1) return GRADE_COLUMNS_GRADE_DOES_NOT_EXIST;
+    int last = --columns->size;
+    if (row != last) { // move the last row into the removed one
+        columns->student_ids[row] = columns->student_ids[last];
+        columns->semesters[row] = columns->semesters[last];
+        columns->course_ids[row] = columns->course_ids[last];
+        columns->points_x2[row] = columns->points_x2[last];
+        columns->grades[row] = columns->grades[last];
+        columns->owners[row] = columns->owners[last];
+        gradeSetColumnRow(columns->owners[row], row);
+    }
+    gradeSetColumnRow(grade, -1);
+    return GRADE_COLUMNS_OK;
+}
+
+/**
+ * gradeColumnsUpdate - copies the grade number of the given grade to its row again, after it was updated
+ * @param columns - the mirror to update
+ * @param grade - the updated grade
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_DOES_NOT_EXIST - if the grade is not in this mirror
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsUpdate(GradeColumns columns, Grade grade) {
+    if (columns == NULL || grade == NULL) return GRADE_COLUMNS_NULL_ARGUMENT;
+    int row = findRow(columns, grade);
+    if (row == -1) return GRADE_COLUMNS_GRADE_DOES_NOT_EXIST;
+    columns->grades[row] = getGradeNumber(grade);
+    return GRADE_COLUMNS_OK;
+}
+
+/**
+ * gradeColumnsGetSize - returns the number of rows (grades) in the mirror
+ * @param columns - the mirror
+ * @return the number of rows. -1 if columns is NULL
+ */
+int gradeColumnsGetSize(GradeColumns columns) {
+    if (columns == NULL) return -1;
+    return columns->size;
+}
+
+/**
+ * gradeColumnsCountCourse - scans the course column for the grades of the course with the given id
+ * @param columns - the mirror to scan
+ * @param course_id - the id of the course
+ * @param grade_sum - pointer to save the sum of the course's grade numbers to (may be NULL)
+ * @return the number of grades of the course. -1 if columns is NULL
+ */
+int gradeColumnsCountCourse(GradeColumns columns, int course_id, long long* grade_sum) {
+    if (columns == NULL) return -1;
+    int count = 0;
+    long long sum = 0;
+    for (int row = 0; row < columns->size; row++) {
+        if (columns->course_ids[row] == course_id) {
+            count++;
+            sum += columns->grades[row];
+        }
+    }
+    if (grade_sum != NULL) {
+        *grade_sum = sum;
+    }
+    return count;
+}
+
+/**
+ * gradeColumnsCountSemester - scans the semester column for the grades of the given semester
+ * @param columns - the mirror to scan
+ * @param semester - the semester number
+ * @param failed - pointer to save the number of the semester's failed grades (lower than 55) to (may be NULL)
+ * @return the number of grades of the semester. -1 if columns is NULL
+ */
+int gradeColumnsCountSemester(GradeColumns columns, int semester, int* failed) {
+    if (columns == NULL) return -1;
+    int count = 0, failed_count = 0;
+    for (int row = 0; row < columns->size; row++) {
+        if (columns->semesters[row] == semester) {
+            count++;
+            failed_count += (columns->grades[row] < FAILED_GRADE_LIMIT);
+        }
+    }
+    if (failed != NULL) {
+        *failed = failed_count;
+    }
+    return count;
+}
+
+/**
+ * gradeColumnsGetTotals - reduces the points and grade columns of all the rows: the total points, the points of the
+ * failed grades and the grades multiple by their points. uses the SIMD reductions of grade_kernels.h
+ * @param columns - the mirror to reduce
+ * @param points_x2 - pointer to save the total points (multiple by 2) to (may be NULL)
+ * @param failed_points_x2 - pointer to save the points of the failed grades (multiple by 2) to (may be NULL)
+ * @param grade_points_x2 - pointer to save the sum of the grades multiple by their points (and by 2) to (may be NULL)
+ * @return the number of rows. -1 if columns is NULL
+ */
+int gradeColumnsGetTotals(GradeColumns columns, long long* points_x2, long long* failed_points_x2,
+                          long long* grade_points_x2) {
+    if (columns == NULL) return -1;
+    if (points_x2 != NULL) {
+        *points_x2 = gradeKernelsSumPointsX2(columns->points_x2, columns->size);
+    }
+    if (failed_points_x2 != NULL) {
+        *failed_points_x2 = gradeKernelsSumFailedPointsX2(columns->points_x2, columns->grades, columns->size);
+    }
+    if (grade_points_x2 != NULL) {
+        *grade_points_x2 = gradeKernelsSumGradePointsX2(columns->points_x2, columns->grades, columns->size);
+    }
+    return columns->size;
+}
+
+/**
+ * gradeColumnsDestroy - deallocate all the memory of the mirror. the grades are not destroyed, but they leave the
+ * mirror, so they must still be alive
+ * @param columns - the mirror to destroy. if columns is NULL nothing will be done
+ */
+void gradeColumnsDestroy(GradeColumns columns) {
+    if (columns == NULL) return;
+    for (int row = 0; row < columns->size; row++) {
+        gradeSetColumnRow(columns->owners[row], -1);
+    }
+    free(columns->student_ids);
+    free(columns->semesters);
+    free(columns->course_ids);
+    free(columns->points_x2);
+    free(columns->grades);
+    free(columns->owners);
+    free(columns);
+}
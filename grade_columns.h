@@ -0,0 +1,113 @@
+#ifndef EX3_GRADE_COLUMNS_H
+#define EX3_GRADE_COLUMNS_H
+
+#include "grade.h"
+
+/**
+ * A column-store mirror of grades, for analytics that scan all the grades of the system.
+ *
+ * Every grade is a row, kept in parallel arrays (the id of the grade's student, its semester, its course id, the
+ * course points multiple by 2 and the grade number), so a scan reads only the columns it needs, contiguously.
+ * the grades stay owned by their students - the mirror only copies their data, and keeps the row of every grade in the
+ * grade itself, so a grade is removed or updated without searching. a removed row is filled by the last row, so the
+ * rows are not in any particular order.
+ */
+typedef struct grade_columns_t *GradeColumns;
+
+/** Type used for returning error codes from functions */
+typedef enum GradeColumnsResult_t {
+    GRADE_COLUMNS_OK,
+    GRADE_COLUMNS_NULL_ARGUMENT,
+    GRADE_COLUMNS_OUT_OF_MEMORY,
+    GRADE_COLUMNS_GRADE_ALREADY_EXISTS,
+    GRADE_COLUMNS_GRADE_DOES_NOT_EXIST
+} GradeColumnsResult;
+
+/**
+ * gradeColumnsCreate - creates a new empty mirror
+ * @return
+ * NULL - if allocations failed.
+ * A new GradeColumns in case of success.
+ */
+GradeColumns gradeColumnsCreate();
+
+/**
+ * gradeColumnsAppend - adds a row for the given grade
+ * @param columns - the mirror to add the grade to
+ * @param student_id - the id of the student the grade belongs to
+ * @param grade - the grade to add. it must stay alive until it is removed from the mirror (or the mirror is destroyed)
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_ALREADY_EXISTS - if the grade is already in a mirror
+ * GRADE_COLUMNS_OUT_OF_MEMORY - if there was a memory error (the mirror is not changed)
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsAppend(GradeColumns columns, int student_id, Grade grade);
+
+/**
+ * gradeColumnsRemove - removes the row of the given grade (must be called before the grade is destroyed)
+ * @param columns - the mirror to remove the grade from
+ * @param grade - the grade to remove
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_DOES_NOT_EXIST - if the grade is not in this mirror
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsRemove(GradeColumns columns, Grade grade);
+
+/**
+ * gradeColumnsUpdate - copies the grade number of the given grade to its row again, after it was updated
+ * @param columns - the mirror to update
+ * @param grade - the updated grade
+ * @return
+ * GRADE_COLUMNS_NULL_ARGUMENT - if columns or grade is NULL
+ * GRADE_COLUMNS_GRADE_DOES_NOT_EXIST - if the grade is not in this mirror
+ * GRADE_COLUMNS_OK - otherwise
+ */
+GradeColumnsResult gradeColumnsUpdate(GradeColumns columns, Grade grade);
+
+/**
+ * gradeColumnsGetSize - returns the number of rows (grades) in the mirror
+ * @param columns - the mirror
+ * @return the number of rows. -1 if columns is NULL
+ */
+int gradeColumnsGetSize(GradeColumns columns);
+
+/**
+ * gradeColumnsCountCourse - scans the course column for the grades of the course with the given id
+ * @param columns - the mirror to scan
+ * @param course_id - the id of the course
+ * @param grade_sum - pointer to save the sum of the course's grade numbers to (may be NULL)
+ * @return the number of grades of the course. -1 if columns is NULL
+ */
+int gradeColumnsCountCourse(GradeColumns columns, int course_id, long long* grade_sum);
+
+/**
+ * gradeColumnsCountSemester - scans the semester column for the grades of the given semester
+ * @param columns - the mirror to scan
+ * @param semester - the semester number
+ * @param failed - pointer to save the number of the semester's failed grades (lower than 55) to (may be NULL)
+ * @return the number of grades of the semester. -1 if columns is NULL
+ */
+int gradeColumnsCountSemester(GradeColumns columns, int semester, int* failed);
+
+/**
+ * gradeColumnsGetTotals - reduces the points and grade columns of all the rows: the total points, the points of the
+ * failed grades and the grades multiple by their points. uses the SIMD reductions of grade_kernels.h
+ * @param columns - the mirror to reduce
+ * @param points_x2 - pointer to save the total points (multiple by 2) to (may be NULL)
+ * @param failed_points_x2 - pointer to save the points of the failed grades (multiple by 2) to (may be NULL)
+ * @param grade_points_x2 - pointer to save the sum of the grades multiple by their points (and by 2) to (may be NULL)
+ * @return the number of rows. -1 if columns is NULL
+ */
+int gradeColumnsGetTotals(GradeColumns columns, long long* points_x2, long long* failed_points_x2,
+                          long long* grade_points_x2);
+
+/**
+ * gradeColumnsDestroy - deallocate all the memory of the mirror. the grades are not destroyed, but they leave the
+ * mirror, so they must still be alive
+ * @param columns - the mirror to destroy. if columns is NULL nothing will be done
+ */
+void gradeColumnsDestroy(GradeColumns columns);
+
+#endif //EX3_GRADE_COLUMNS_H
@@ -0,0 +1,236 @@
+#include "grade_kernels.h"
+#include <stddef.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRADE_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+/** The 3 reductions of one version */
+typedef struct grade_kernels_t {
+    long long (*sum_points)(const int* points_x2, int count);
+    long long (*sum_failed_points)(const int* points_x2, const int* grades, int count);
+    long long (*sum_grade_points)(const int* points_x2, const int* grades, int count);
+} GradeKernels;
+
+static long long sumPointsScalar(const int* points_x2, int count) {
+    long long sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += points_x2[i];
+    }
+    return sum;
+}
+
+static long long sumFailedPointsScalar(const int* points_x2, const int* grades, int count) {
+    long long sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += (grades[i] < FAILED_GRADE_LIMIT) ? points_x2[i] : 0;
+    }
+    return sum;
+}
+
+static long long sumGradePointsScalar(const int* points_x2, const int* grades, int count) {
+    long long sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += (long long)points_x2[i] * grades[i];
+    }
+    return sum;
+}
+
+static const GradeKernels scalar_kernels = {sumPointsScalar, sumFailedPointsScalar, sumGradePointsScalar};
+
+#ifdef GRADE_KERNELS_X86
+/*
+ * the SIMD versions widen the 32 bit values to 64 bit lanes before adding them (the values are not negative, so they
+ * are widened with zeros), and multiply the even and the odd 32 bit lanes separately into 64 bit products.
+ * the rest of the pairs, that do not fill a whole vector, are reduced by the scalar version.
+ */
+
+__attribute__((target("sse2")))
+static long long sumLanesSse2(__m128i sums) {
+    long long lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, sums);
+    return lanes[0] + lanes[1];
+}
+
+__attribute__((target("sse2")))
+static __m128i addWidenedSse2(__m128i sums, __m128i values) {
+    __m128i zero = _mm_setzero_si128();
+    sums = _mm_add_epi64(sums, _mm_unpacklo_epi32(values, zero));
+    return _mm_add_epi64(sums, _mm_unpackhi_epi32(values, zero));
+}
+
+__attribute__((target("sse2")))
+static long long sumPointsSse2(const int* points_x2, int count) {
+    __m128i sums = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        sums = addWidenedSse2(sums, _mm_loadu_si128((const __m128i*)(points_x2 + i)));
+    }
+    return sumLanesSse2(sums) + sumPointsScalar(points_x2 + i, count - i);
+}
+
+__attribute__((target("sse2")))
+static long long sumFailedPointsSse2(const int* points_x2, const int* grades, int count) {
+    __m128i sums = _mm_setzero_si128(), limit = _mm_set1_epi32(FAILED_GRADE_LIMIT);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i failed = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*)(grades + i)), limit);
+        sums = addWidenedSse2(sums, _mm_and_si128(failed, _mm_loadu_si128((const __m128i*)(points_x2 + i))));
+    }
+    return sumLanesSse2(sums) + sumFailedPointsScalar(points_x2 + i, grades + i, count - i);
+}
+
+__attribute__((target("sse2")))
+static long long sumGradePointsSse2(const int* points_x2, const int* grades, int count) {
+    __m128i sums = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i points = _mm_loadu_si128((const __m128i*)(points_x2 + i));
+        __m128i grade = _mm_loadu_si128((const __m128i*)(grades + i));
+        sums = _mm_add_epi64(sums, _mm_mul_epu32(points, grade));
+        sums = _mm_add_epi64(sums, _mm_mul_epu32(_mm_srli_epi64(points, 32), _mm_srli_epi64(grade, 32)));
+    }
+    return sumLanesSse2(sums) + sumGradePointsScalar(points_x2 + i, grades + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static long long sumLanesAvx2(__m256i sums) {
+    long long lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, sums);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+__attribute__((target("avx2")))
+static __m256i addWidenedAvx2(__m256i sums, __m256i values) {
+    __m256i zero = _mm256_setzero_si256();
+    sums = _mm256_add_epi64(sums, _mm256_unpacklo_epi32(values, zero));
+    return _mm256_add_epi64(sums, _mm256_unpackhi_epi32(values, zero));
+}
+
+__attribute__((target("avx2")))
+static long long sumPointsAvx2(const int* points_x2, int count) {
+    __m256i sums = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        sums = addWidenedAvx2(sums, _mm256_loadu_si256((const __m256i*)(points_x2 + i)));
+    }
+    return sumLanesAvx2(sums) + sumPointsScalar(points_x2 + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static long long sumFailedPointsAvx2(const int* points_x2, const int* grades, int count) {
+    __m256i sums = _mm256_setzero_si256(), limit = _mm256_set1_epi32(FAILED_GRADE_LIMIT);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i failed = _mm256_cmpgt_epi32(limit, _mm256_loadu_si256((const __m256i*)(grades + i)));
+        sums = addWidenedAvx2(sums, _mm256_and_si256(failed, _mm256_loadu_si256((const __m256i*)(points_x2 + i))));
+    }
+    return sumLanesAvx2(sums) + sumFailedPointsScalar(points_x2 + i, grades + i, count - i);
+}
+
+__attribute__((target("avx2")))
+static long long sumGradePointsAvx2(const int* points_x2, const int* grades, int count) {
+    __m256i sums = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i points = _mm256_loadu_si256((const __m256i*)(points_x2 + i));
+        __m256i grade = _mm256_loadu_si256((const __m256i*)(grades + i));
+        sums = _mm256_add_epi64(sums, _mm256_mul_epu32(points, grade));
+        sums = _mm256_add_epi64(sums, _mm256_mul_epu32(_mm256_srli_epi64(points, 32), _mm256_srli_epi64(grade, 32)));
+    }
+    return sumLanesAvx2(sums) + sumGradePointsScalar(points_x2 + i, grades + i, count - i);
+}
+
+static const GradeKernels sse2_kernels = {sumPointsSse2, sumFailedPointsSse2, sumGradePointsSse2};
+static const GradeKernels avx2_kernels = {sumPointsAvx2, sumFailedPointsAvx2, sumGradePointsAvx2};
+#endif
+
+static const GradeKernels* kernels = NULL; // the version in use, chosen by the first call
+static GradeKernelsLevel kernels_level = GRADE_KERNELS_SCALAR;
+
+/**
+ * getSupportedLevel - inner function that returns the best version of the reductions the CPU supports
+ */
+static GradeKernelsLevel getSupportedLevel() {
+#ifdef GRADE_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return GRADE_KERNELS_AVX2;
+    if (__builtin_cpu_supports("sse2")) return GRADE_KERNELS_SSE2;
+#endif
+    return GRADE_KERNELS_SCALAR;
+}
+
+/**
+ * getKernels - inner function that returns the reductions in use, and chooses the best version on the first call
+ */
+static const GradeKernels* getKernels() {
+    if (kernels == NULL) {
+        gradeKernelsSetLevel(GRADE_KERNELS_AVX2);
+    }
+    return kernels;
+}
+
+/**
+ * gradeKernelsGetLevel - returns the version of the reductions that is used
+ * @return the level of the reductions in use
+ */
+GradeKernelsLevel gradeKernelsGetLevel() {
+    getKernels();
+    return kernels_level;
+}
+
+/**
+ * gradeKernelsSetLevel - sets the version of the reductions to use (for comparing the versions). if the CPU does not
+ * support the given version, the best version it supports is used
+ * @param level - the version to use
+ * @return the level of the reductions that is used from now on
+ */
+GradeKernelsLevel gradeKernelsSetLevel(GradeKernelsLevel level) {
+    GradeKernelsLevel supported = getSupportedLevel();
+    kernels_level = (level < supported) ? level : supported;
+    kernels = &scalar_kernels;
+#ifdef GRADE_KERNELS_X86
+    if (kernels_level == GRADE_KERNELS_SSE2) {
+        kernels = &sse2_kernels;
+    } else if (kernels_level == GRADE_KERNELS_AVX2) {
+        kernels = &avx2_kernels;
+    }
+#endif
+    return kernels_level;
+}
+
+/**
+ * gradeKernelsSumPointsX2 - sums the given points
+ * @param points_x2 - the course points multiple by 2
+ * @param count - the number of points
+ * @return the sum of the points (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumPointsX2(const int* points_x2, int count) {
+    if (points_x2 == NULL || count <= 0) return 0;
+    return getKernels()->sum_points(points_x2, count);
+}
+
+/**
+ * gradeKernelsSumFailedPointsX2 - sums the points of the failed grades (lower than 55)
+ * @param points_x2 - the course points multiple by 2
+ * @param grades - the grade of every points
+ * @param count - the number of pairs
+ * @return the sum of the points of the failed grades (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumFailedPointsX2(const int* points_x2, const int* grades, int count) {
+    if (points_x2 == NULL || grades == NULL || count <= 0) return 0;
+    return getKernels()->sum_failed_points(points_x2, grades, count);
+}
+
+/**
+ * gradeKernelsSumGradePointsX2 - sums the grades multiple by their points
+ * @param points_x2 - the course points multiple by 2
+ * @param grades - the grade of every points
+ * @param count - the number of pairs
+ * @return the sum of the grades multiple by their points (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumGradePointsX2(const int* points_x2, const int* grades, int count) {
+    if (points_x2 == NULL || grades == NULL || count <= 0) return 0;
+    return getKernels()->sum_grade_points(points_x2, grades, count);
+}
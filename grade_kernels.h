@@ -0,0 +1,64 @@
+#ifndef EX3_GRADE_KERNELS_H
+#define EX3_GRADE_KERNELS_H
+
+/**
+ * Reductions over contiguous (points x2, grade) pairs, like the columns of a GradeColumns mirror: the sum of the
+ * points, the sum of the points of the failed grades, and the sum of the grades multiple by their points.
+ *
+ * Every reduction has a scalar version, and on x86 also SSE2 and AVX2 versions. the best version the CPU supports is
+ * chosen at runtime, the first time a reduction is called. all the versions give the same results.
+ * the points and the grades must not be negative (the grades are at most 100). the sums are 64 bit, so they do not
+ * overflow.
+ */
+
+/** A grade lower than this is a failed grade */
+#define FAILED_GRADE_LIMIT 55
+
+/** The versions of the reductions, from the slowest */
+typedef enum GradeKernelsLevel_t {
+    GRADE_KERNELS_SCALAR,
+    GRADE_KERNELS_SSE2,
+    GRADE_KERNELS_AVX2
+} GradeKernelsLevel;
+
+/**
+ * gradeKernelsGetLevel - returns the version of the reductions that is used
+ * @return the level of the reductions in use
+ */
+GradeKernelsLevel gradeKernelsGetLevel();
+
+/**
+ * gradeKernelsSetLevel - sets the version of the reductions to use (for comparing the versions). if the CPU does not
+ * support the given version, the best version it supports is used
+ * @param level - the version to use
+ * @return the level of the reductions that is used from now on
+ */
+GradeKernelsLevel gradeKernelsSetLevel(GradeKernelsLevel level);
+
+/**
+ * gradeKernelsSumPointsX2 - sums the given points
+ * @param points_x2 - the course points multiple by 2
+ * @param count - the number of points
+ * @return the sum of the points (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumPointsX2(const int* points_x2, int count);
+
+/**
+ * gradeKernelsSumFailedPointsX2 - sums the points of the failed grades (lower than 55)
+ * @param points_x2 - the course points multiple by 2
+ * @param grades - the grade of every points
+ * @param count - the number of pairs
+ * @return the sum of the points of the failed grades (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumFailedPointsX2(const int* points_x2, const int* grades, int count);
+
+/**
+ * gradeKernelsSumGradePointsX2 - sums the grades multiple by their points
+ * @param points_x2 - the course points multiple by 2
+ * @param grades - the grade of every points
+ * @param count - the number of pairs
+ * @return the sum of the grades multiple by their points (multiple by 2). 0 if count is not positive
+ */
+long long gradeKernelsSumGradePointsX2(const int* points_x2, const int* grades, int count);
+
+#endif //EX3_GRADE_KERNELS_H
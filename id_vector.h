@@ -0,0 +1,14 @@
+#ifndef EX3_ID_VECTOR_H
+#define EX3_ID_VECTOR_H
+
+#include "typed_vector.h"
+
+/**
+ * The type-specialized container (see typed_vector.h) of the students' ids. it is kept apart from typed_containers.h,
+ * so the int set does not depend on the semester and grade types.
+ */
+
+/** IdVector - sorted set of students' ids */
+SORTED_VECTOR_DEFINE(IdVector, idVector, int, int, VECTOR_ELEMENT_AS_KEY, VECTOR_COMPARE_INTS)
+
+#endif //EX3_ID_VECTOR_H
@@ -0,0 +1,170 @@
+#include "int_set.h"
+#include <stdlib.h>
+#include "id_vector.h"
+
+typedef struct int_set_t {
+    IdVector numbers; // sorted ascending
+} int_set_t;
+
+/**
+ * intSetCreate - creates a new empty set. no memory is allocated for the elements until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new IntSet in case of success.
+ */
+IntSet intSetCreate() {
+    IntSet set = (IntSet) malloc(sizeof(*set));
+    if (set == NULL) return NULL;
+    idVectorInit(&set->numbers);
+    return set;
+}
+
+/**
+ * intSetCopy - creates a copy of the given set
+ * @param set - the set to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * An IntSet with the same numbers as the given set otherwise.
+ */
+IntSet intSetCopy(IntSet set) {
+    if (set == NULL) return NULL;
+    IntSet new_set = intSetCreate();
+    if (new_set == NULL) return NULL;
+    if (idVectorCopy(&new_set->numbers, &set->numbers) == VECTOR_OUT_OF_MEMORY) {
+        intSetDestroy(new_set);
+        return NULL;
+    }
+    return new_set;
+}
+
+/**
+ * intSetGetSize - returns the number of numbers in the set
+ * @param set - the set to get its size
+ * @return the number of numbers in the set. -1 if the set is NULL
+ */
+int intSetGetSize(IntSet set) {
+    if (set == NULL) return -1;
+    return idVectorSize(&set->numbers);
+}
+
+/**
+ * intSetIsIn - checks if the given number is in the set (binary search)
+ * @param set - the set to search in
+ * @param number - the number to search
+ * @return true if the number is in the set, false otherwise (or if the set is NULL)
+ */
+bool intSetIsIn(IntSet set, int number) {
+    if (set == NULL) return false;
+    return (idVectorFind(&set->numbers, number) != NULL);
+}
+
+/**
+ * intSetAdd - adds the given number to the set
+ * @param set - the set to add the number to
+ * @param number - the number to add
+ * @return
+ * INT_SET_NULL_ARGUMENT - if the set is NULL
+ * INT_SET_OUT_OF_MEMORY - if there was a memory error
+ * INT_SET_ITEM_ALREADY_EXISTS - if the number is already in the set
+ * INT_SET_OK - otherwise
+ */
+IntSetResult intSetAdd(IntSet set, int number) {
+    if (set == NULL) return INT_SET_NULL_ARGUMENT;
+    switch (idVectorInsert(&set->numbers, number)) {
+        case VECTOR_OUT_OF_MEMORY: return INT_SET_OUT_OF_MEMORY;
+        case VECTOR_ITEM_ALREADY_EXISTS: return INT_SET_ITEM_ALREADY_EXISTS;
+        default: return INT_SET_OK;
+    }
+}
+
+/**
+ * intSetRemove - removes the given number from the set
+ * @param set - the set to remove the number from
+ * @param number - the number to remove
+ * @return
+ * INT_SET_NULL_ARGUMENT - if the set is NULL
+ * INT_SET_ITEM_DOES_NOT_EXIST - if the number is not in the set
+ * INT_SET_OK - otherwise
+ */
+IntSetResult intSetRemove(IntSet set, int number) {
+    if (set == NULL) return INT_SET_NULL_ARGUMENT;
+    if (idVectorRemove(&set->numbers, number) == VECTOR_ITEM_DOES_NOT_EXIST) return INT_SET_ITEM_DOES_NOT_EXIST;
+    return INT_SET_OK;
+}
+
+/**
+ * intSetGetElements - returns the numbers of the set as a sorted array (ascending) of intSetGetSize numbers.
+ * the array is owned by the set and is valid only until the set is changed or destroyed.
+ * @param set - the set to get its numbers
+ * @return the sorted array of the set's numbers. NULL if the set is NULL or empty
+ */
+const int* intSetGetElements(IntSet set) {
+    if (set == NULL || idVectorSize(&set->numbers) == 0) return NULL;
+    return idVectorAt(&set->numbers, 0);
+}
+
+/**
+ * gallopLowerBound - inner function that returns the index of the first number that is not lower than the given one,
+ * in the sorted array, starting the search from the given index. the distance from the start is doubled until the
+ * number is passed, and then it is binary searched, so near numbers are found in few steps.
+ * @return the index of the first number not lower than the given one. size if there is no such number
+ */
+static int gallopLowerBound(const int* numbers, int size, int start, int number) {
+    int low = start, step = 1;
+    while (low + step < size && numbers[low + step] < number) {
+        low += step;
+        step *= 2;
+    }
+    int high = (low + step < size) ? low + step : size; // numbers[high] is not lower than number (if it exists)
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (numbers[middle] < number) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * intSetForEachCommon - calls the given visitor for every number that is in both sets, in ascending order.
+ * goes over the smaller set, and gallops (exponential search) over the bigger one, so a small set is intersected with
+ * a big one in O(small * log(big / small)).
+ * @param set1 - the first set
+ * @param set2 - the second set
+ * @param visitor - the function to call for every common number. it must not change the sets
+ * @param context - passed to the visitor as is
+ * @return the number of common numbers. 0 if one of the sets (or the visitor) is NULL
+ */
+int intSetForEachCommon(IntSet set1, IntSet set2, IntSetVisitor visitor, void* context) {
+    if (set1 == NULL || set2 == NULL || visitor == NULL) return 0;
+    if (intSetGetSize(set1) > intSetGetSize(set2)) {
+        IntSet temp = set1;
+        set1 = set2;
+        set2 = temp;
+    }
+    const int* small = intSetGetElements(set1);
+    const int* big = intSetGetElements(set2);
+    int small_size = intSetGetSize(set1), big_size = intSetGetSize(set2);
+    int common = 0;
+    for (int i = 0, position = 0; i < small_size && position < big_size; i++) {
+        position = gallopLowerBound(big, big_size, position, small[i]);
+        if (position < big_size && big[position] == small[i]) {
+            visitor(small[i], context);
+            common++;
+            position++;
+        }
+    }
+    return common;
+}
+
+/**
+ * intSetDestroy - deallocate all the memory of the set
+ * @param set - the set to destroy. if set is NULL nothing will be done
+ */
+void intSetDestroy(IntSet set) {
+    if (set == NULL) return;
+    idVectorDestroy(&set->numbers);
+    free(set);
+}
@@ -0,0 +1,115 @@
+#ifndef EX3_INT_SET_H
+#define EX3_INT_SET_H
+
+#include <stdbool.h>
+
+/**
+ * Set of ints, kept as a sorted array of the ints themselves (no allocation and no function pointer per element).
+ * used for the students' friends and friend requests ids.
+ */
+typedef struct int_set_t *IntSet;
+
+/** Type of the function called by intSetForEachCommon for every common number */
+typedef void (*IntSetVisitor)(int number, void* context);
+
+/** Type used for returning error codes from functions */
+typedef enum IntSetResult_t {
+    INT_SET_OK,
+    INT_SET_NULL_ARGUMENT,
+    INT_SET_OUT_OF_MEMORY,
+    INT_SET_ITEM_ALREADY_EXISTS,
+    INT_SET_ITEM_DOES_NOT_EXIST
+} IntSetResult;
+
+/**
+ * intSetCreate - creates a new empty set. no memory is allocated for the elements until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new IntSet in case of success.
+ */
+IntSet intSetCreate();
+
+/**
+ * intSetCopy - creates a copy of the given set
+ * @param set - the set to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * An IntSet with the same numbers as the given set otherwise.
+ */
+IntSet intSetCopy(IntSet set);
+
+/**
+ * intSetGetSize - returns the number of numbers in the set
+ * @param set - the set to get its size
+ * @return the number of numbers in the set. -1 if the set is NULL
+ */
+int intSetGetSize(IntSet set);
+
+/**
+ * intSetIsIn - checks if the given number is in the set (binary search)
+ * @param set - the set to search in
+ * @param number - the number to search
+ * @return true if the number is in the set, false otherwise (or if the set is NULL)
+ */
+bool intSetIsIn(IntSet set, int number);
+
+/**
+ * intSetAdd - adds the given number to the set
+ * @param set - the set to add the number to
+ * @param number - the number to add
+ * @return
+ * INT_SET_NULL_ARGUMENT - if the set is NULL
+ * INT_SET_OUT_OF_MEMORY - if there was a memory error
+ * INT_SET_ITEM_ALREADY_EXISTS - if the number is already in the set
+ * INT_SET_OK - otherwise
+ */
+IntSetResult intSetAdd(IntSet set, int number);
+
+/**
+ * intSetRemove - removes the given number from the set
+ * @param set - the set to remove the number from
+ * @param number - the number to remove
+ * @return
+ * INT_SET_NULL_ARGUMENT - if the set is NULL
+ * INT_SET_ITEM_DOES_NOT_EXIST - if the number is not in the set
+ * INT_SET_OK - otherwise
+ */
+IntSetResult intSetRemove(IntSet set, int number);
+
+/**
+ * intSetGetElements - returns the numbers of the set as a sorted array (ascending) of intSetGetSize numbers.
+ * the array is owned by the set and is valid only until the set is changed or destroyed.
+ * @param set - the set to get its numbers
+ * @return the sorted array of the set's numbers. NULL if the set is NULL or empty
+ */
+const int* intSetGetElements(IntSet set);
+
+/**
+ * intSetForEachCommon - calls the given visitor for every number that is in both sets, in ascending order.
+ * goes over the smaller set, and gallops (exponential search) over the bigger one, so a small set is intersected with
+ * a big one in O(small * log(big / small)).
+ * @param set1 - the first set
+ * @param set2 - the second set
+ * @param visitor - the function to call for every common number. it must not change the sets
+ * @param context - passed to the visitor as is
+ * @return the number of common numbers. 0 if one of the sets (or the visitor) is NULL
+ */
+int intSetForEachCommon(IntSet set1, IntSet set2, IntSetVisitor visitor, void* context);
+
+/**
+ * intSetDestroy - deallocate all the memory of the set
+ * @param set - the set to destroy. if set is NULL nothing will be done
+ */
+void intSetDestroy(IntSet set);
+
+/**
+ * Macro for iterating over the numbers of a set, in ascending order.
+ * the set must not be changed while iterating over it.
+ * declares a new int variable named iterator, that contains the current number in every iteration.
+ */
+#define INT_SET_FOREACH(iterator, set) \
+    for (int iterator##_index = 0, iterator = 0; \
+         iterator##_index < intSetGetSize(set) && ((iterator = intSetGetElements(set)[iterator##_index]), true); \
+         iterator##_index++)
+
+#endif //EX3_INT_SET_H
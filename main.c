@@ -15,6 +15,8 @@
 #define FILE_READ_MODE "r"
 #define FILE_WRITE_MODE "w"
 #define COMMENT_PREFIX '#'
+#define RECLAIM_SLICE 64 // the number of students the removed students are reclaimed from between commands
+#define AS_OF_FLAG "--as-of"
 
 /**
  * This type defines all possible results for a parser function
@@ -525,6 +527,67 @@ static bool handleStudentUnfriendCommand(CourseManager manager, List command_par
     return true;
 }
 
+/**
+ * a handler for the "student mutual_friends" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <other_id>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleStudentMutualFriendsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int other_id = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printMutualFriends(manager, other_id, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST) {
+        printError(MTM_STUDENT_DOES_NOT_EXIST);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    }
+    return true;
+}
+
+/**
+ * a handler for the "student suggest_friends" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <amount>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleStudentSuggestFriendsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int amount = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printFriendSuggestions(manager, amount, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
 /**
  * execute a command that starts with 'student'
  *
@@ -557,6 +620,10 @@ static bool handleStudentCommand(CourseManager manager, List command_parts, file
         return handleStudentHandleRequestCommand(manager, command_parts, output_stream);
     } else if(!strcmp(subcommand, "unfriend")) {
         return handleStudentUnfriendCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "mutual_friends")) {
+        return handleStudentMutualFriendsCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "suggest_friends")) {
+        return handleStudentSuggestFriendsCommand(manager, command_parts, output_stream);
     } else {    // invalid subcommand, it is assumed that we don't get here
         assert(false);
     }
@@ -691,7 +758,8 @@ static bool handleGradeSheetCommand(CourseManager manager, List command_parts, f
 /**
  * a handler for the "report full" command
  * it is assumed that the list's iterator points to the subcommand part (2nd word)
- * we also assume that there are no parameters
+ * we also assume that there are no parameters, or 2 parameters: --as-of <seq>
+ * (to print the report as the grade sheet was after the command with this sequence number)
  *
  * @param manager - the course manager
  * @param command_parts - the command as a list of strings
@@ -703,11 +771,31 @@ static bool handleGradeSheetCommand(CourseManager manager, List command_parts, f
  */
 static bool handleReportFullCommand(CourseManager manager, List command_parts, file output_stream) {
     assert(manager != NULL && command_parts != NULL && output_stream != NULL);
-    assert(listGetSize(command_parts) == 2);    // command + subcommand
+    // command + subcommand (+ 2 parameters)
+    assert(listGetSize(command_parts) == 2 || listGetSize(command_parts) == 4);
+
+    if(listGetSize(command_parts) == 2) {
+        CourseManagerResult res = printFullReport(manager, output_stream);
+        if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+            printError(MTM_NOT_LOGGED_IN);
+        }
+        return true;
+    }
+    char* flag = listGetNext(command_parts);
+    if(strcmp(flag, AS_OF_FLAG)) {
+        printError(MTM_INVALID_PARAMETERS);
+        return true;
+    }
+    int sequence = stringToInt(listGetNext(command_parts));
 
-    CourseManagerResult res = printFullReport(manager, output_stream);
+    CourseManagerResult res = printFullReportAsOf(manager, sequence, output_stream);
     if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
         printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
     }
     return true;
 }
@@ -715,7 +803,8 @@ static bool handleReportFullCommand(CourseManager manager, List command_parts, f
 /**
  * a handler for the "report clean" command
  * it is assumed that the list's iterator points to the subcommand part (2nd word)
- * we also assume that there are no parameters
+ * we also assume that there are no parameters, or 2 parameters: --as-of <seq>
+ * (to print the report as the grade sheet was after the command with this sequence number)
  *
  * @param manager - the course manager
  * @param command_parts - the command as a list of strings
@@ -727,11 +816,31 @@ static bool handleReportFullCommand(CourseManager manager, List command_parts, f
  */
 static bool handleReportCleanCommand(CourseManager manager, List command_parts, file output_stream) {
     assert(manager != NULL && command_parts != NULL && output_stream != NULL);
-    assert(listGetSize(command_parts) == 2);    // command + subcommand
+    // command + subcommand (+ 2 parameters)
+    assert(listGetSize(command_parts) == 2 || listGetSize(command_parts) == 4);
 
-    CourseManagerResult res = printCleanReport(manager, output_stream);
+    if(listGetSize(command_parts) == 2) {
+        CourseManagerResult res = printCleanReport(manager, output_stream);
+        if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+            printError(MTM_NOT_LOGGED_IN);
+        }
+        return true;
+    }
+    char* flag = listGetNext(command_parts);
+    if(strcmp(flag, AS_OF_FLAG)) {
+        printError(MTM_INVALID_PARAMETERS);
+        return true;
+    }
+    int sequence = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printCleanReportAsOf(manager, sequence, output_stream);
     if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
         printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
     }
     return true;
 }
@@ -821,6 +930,316 @@ static bool handleReportReferenceCommand(CourseManager manager, List command_par
     return true;
 }
 
+/**
+ * a handler for the "report reference_network" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there are 3 parameters: <course_id> <amount> <depth>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportReferenceNetworkCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 5);    // command + subcommand + 3 parameters
+
+    int course_id = stringToInt(listGetNext(command_parts));
+    int amount = stringToInt(listGetNext(command_parts));
+    int depth = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printReferenceNetwork(manager, course_id, amount, depth, output_stream);
+    if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report network_stats" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there are no parameters
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportNetworkStatsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 2);    // command + subcommand
+
+    CourseManagerResult res = printNetworkStats(manager, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report course_average" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <course_id>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportCourseAverageCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int course_id = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printCourseAverage(manager, course_id, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_COURSE_DOES_NOT_EXIST) {
+        printError(MTM_COURSE_DOES_NOT_EXIST);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report semester_failures" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <semester>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportSemesterFailuresCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int semester = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printSemesterFailures(manager, semester, output_stream);
+    if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report course_stats" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <course_id>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportCourseStatsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int course_id = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printCourseStats(manager, course_id, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_COURSE_DOES_NOT_EXIST) {
+        printError(MTM_COURSE_DOES_NOT_EXIST);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report progression" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there are no parameters
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportProgressionCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 2);    // command + subcommand
+
+    CourseManagerResult res = printProgression(manager, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report rank" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there are no parameters
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportRankCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 2);    // command + subcommand
+
+    CourseManagerResult res = printRank(manager, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report top_students" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there is 1 parameter: <amount>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportTopStudentsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 3);    // command + subcommand + 1 parameter
+
+    int amount = stringToInt(listGetNext(command_parts));
+
+    CourseManagerResult res = printTopStudents(manager, amount, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report what_if" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that the parameters are one or more triples of: <course_id> <points> <grade>
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportWhatIfCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    // command + subcommand + 3 parameters for every hypothetical grade
+    assert(listGetSize(command_parts) > 2 && (listGetSize(command_parts) - 2) % 3 == 0);
+
+    WhatIf scenario = whatIfCreate();
+    if(scenario == NULL) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    for(char* part = listGetNext(command_parts); part != NULL; part = listGetNext(command_parts)) {
+        int course_id = stringToInt(part);
+        char* points = listGetNext(command_parts);
+        int grade = stringToInt(listGetNext(command_parts));
+        // an invalid change is kept in the scenario, and reported after checking that a student is logged in
+        if(whatIfAddChange(scenario, course_id, points, grade) == WHAT_IF_OUT_OF_MEMORY) {
+            whatIfDestroy(scenario);
+            printError(MTM_OUT_OF_MEMORY);
+            return false;
+        }
+    }
+
+    CourseManagerResult res = printWhatIf(manager, scenario, output_stream);
+    whatIfDestroy(scenario);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_INVALID_PARAMETERS) {
+        printError(MTM_INVALID_PARAMETERS);
+    }
+    return true;
+}
+
+/**
+ * a handler for the "report grade_totals" command
+ * it is assumed that the list's iterator points to the subcommand part (2nd word)
+ * we also assume that there are no parameters
+ *
+ * @param manager - the course manager
+ * @param command_parts - the command as a list of strings
+ * @param output_stream - the stream where the output goes
+ *
+ * @return
+ * true - if no memory errors occured
+ * false - if a memory error occured
+ */
+static bool handleReportGradeTotalsCommand(CourseManager manager, List command_parts, file output_stream) {
+    assert(manager != NULL && command_parts != NULL && output_stream != NULL);
+    assert(listGetSize(command_parts) == 2);    // command + subcommand
+
+    CourseManagerResult res = printGradeTotals(manager, output_stream);
+    if(res == COURSE_MANAGER_NOT_LOGGED_IN) {
+        printError(MTM_NOT_LOGGED_IN);
+    } else if(res == COURSE_MANAGER_OUT_OF_MEMORY) {
+        printError(MTM_OUT_OF_MEMORY);
+        return false;
+    }
+    return true;
+}
+
 /**
  * a handler for the "report faculty_request" command
  * it is assumed that the list's iterator points to the subcommand part (2nd word)
@@ -880,8 +1299,28 @@ static bool handleReportCommand(CourseManager manager, List command_parts, file
         return handleReportWorstCommand(manager, command_parts, output_stream);
     } else if(!strcmp(subcommand, "reference")) {
         return handleReportReferenceCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "reference_network")) {
+        return handleReportReferenceNetworkCommand(manager, command_parts, output_stream);
     } else if(!strcmp(subcommand, "faculty_request")) {
         return handleReportFacultyRequestCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "network_stats")) {
+        return handleReportNetworkStatsCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "course_average")) {
+        return handleReportCourseAverageCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "semester_failures")) {
+        return handleReportSemesterFailuresCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "grade_totals")) {
+        return handleReportGradeTotalsCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "course_stats")) {
+        return handleReportCourseStatsCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "rank")) {
+        return handleReportRankCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "top_students")) {
+        return handleReportTopStudentsCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "progression")) {
+        return handleReportProgressionCommand(manager, command_parts, output_stream);
+    } else if(!strcmp(subcommand, "what_if")) {
+        return handleReportWhatIfCommand(manager, command_parts, output_stream);
     } else {    // invalid subcommand, it is assumed that we don't get here
         assert(false);
     }
@@ -906,6 +1345,7 @@ static bool handleCommand(CourseManager manager, List command_parts, file output
     char* first_word = listGetFirst(command_parts);
     if(first_word[0] == COMMENT_PREFIX) return true;     // if the line is a comment then do nothing
     // if it got here then the line is a potential command
+    courseManagerBeginCommand(manager);     // the grade changes of the command are tagged with its sequence number
     if(!strcmp(first_word, "student")) {
         return handleStudentCommand(manager, command_parts, output_stream);
     } else if(!strcmp(first_word, "grade_sheet")) {
@@ -932,6 +1372,8 @@ static void executeCommands(file input_stream, file output_stream) {
         printError(MTM_OUT_OF_MEMORY);
         return;
     }
+    // removing a student only hides it, and the work of removing it is spread between the next commands
+    courseManagerSetLazyRemoval(manager, true);
 
     char buffer[MAX_LEN + 1] = "";
     while(fgets(buffer, MAX_LEN, input_stream) != NULL) {   // iterate over the lines of the input stream
@@ -948,6 +1390,7 @@ static void executeCommands(file input_stream, file output_stream) {
                 destroyCourseManager(manager);
                 return;
             }
+            courseManagerReclaim(manager, RECLAIM_SLICE);
         }
     }
     destroyCourseManager(manager);
@@ -0,0 +1,191 @@
+#include "name_pool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define NAME_POOL_INITIAL_BUCKETS 64
+
+typedef struct name_t {
+    NamePool pool; // NULL if the name is not (or no longer) in a pool
+    struct name_t* next; // the next name in the same bucket of the pool
+    uint32_t hash;
+    int references;
+    char string[]; // allocated together with the name
+} name_t;
+
+typedef struct name_pool_t {
+    Name* buckets;
+    int buckets_count; // always a power of 2
+    int size;
+} name_pool_t;
+
+/**
+ * hashString - FNV-1a hash of the given string
+ */
+static uint32_t hashString(const char* string) {
+    uint32_t hash = 2166136261u;
+    for (; *string != '\0'; string++) {
+        hash = (hash ^ (unsigned char)*string) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * nameCreate - allocates a new name with a single holder, which is not in any pool
+ * @return NULL if the allocation failed, the new name otherwise
+ */
+static Name nameCreate(const char* string, uint32_t hash) {
+    size_t length = strlen(string);
+    Name name = (Name) malloc(sizeof(*name) + length + 1);
+    if (name == NULL) return NULL;
+    name->pool = NULL;
+    name->next = NULL;
+    name->hash = hash;
+    name->references = 1;
+    memcpy(name->string, string, length + 1);
+    return name;
+}
+
+/**
+ * namePoolGrow - doubles the number of buckets of the pool, and moves the names to their new buckets
+ * @return false if there was a memory error (the pool is not changed), true otherwise
+ */
+static bool namePoolGrow(NamePool pool) {
+    int new_buckets_count = pool->buckets_count * 2;
+    Name* new_buckets = (Name*) calloc(new_buckets_count, sizeof(*new_buckets));
+    if (new_buckets == NULL) return false;
+    for (int i = 0; i < pool->buckets_count; i++) {
+        Name name = pool->buckets[i];
+        while (name != NULL) {
+            Name next = name->next;
+            int index = name->hash & (new_buckets_count - 1);
+            name->next = new_buckets[index];
+            new_buckets[index] = name;
+            name = next;
+        }
+    }
+    free(pool->buckets);
+    pool->buckets = new_buckets;
+    pool->buckets_count = new_buckets_count;
+    return true;
+}
+
+/**
+ * namePoolCreate - creates a new empty name pool
+ * @return
+ * NULL - if allocations failed.
+ * A new NamePool in case of success.
+ */
+NamePool namePoolCreate() {
+    NamePool pool = (NamePool) malloc(sizeof(*pool));
+    if (pool == NULL) return NULL;
+    pool->buckets = (Name*) calloc(NAME_POOL_INITIAL_BUCKETS, sizeof(*pool->buckets));
+    if (pool->buckets == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pool->buckets_count = NAME_POOL_INITIAL_BUCKETS;
+    pool->size = 0;
+    return pool;
+}
+
+/**
+ * namePoolIntern - returns a handle to the given string in the pool, adding it to the pool if it is not there yet.
+ * the returned handle must be released with nameRelease.
+ * @param pool - the pool to intern the string in. if NULL, a new name that is not shared with anyone is created
+ * @param string - the string to intern. the data is copied from the pointer
+ * @return
+ * NULL - if string is NULL or a memory allocation failed.
+ * The handle of the interned name otherwise.
+ */
+Name namePoolIntern(NamePool pool, const char* string) {
+    if (string == NULL) return NULL;
+    uint32_t hash = hashString(string);
+    if (pool == NULL) return nameCreate(string, hash);
+
+    for (Name name = pool->buckets[hash & (pool->buckets_count - 1)]; name != NULL; name = name->next) {
+        if (name->hash == hash && strcmp(name->string, string) == 0) {
+            return nameRetain(name);
+        }
+    }
+    // keep the average bucket length under 1. if growing fails, the pool just gets a bit slower
+    if (pool->size >= pool->buckets_count) {
+        namePoolGrow(pool);
+    }
+    Name name = nameCreate(string, hash);
+    if (name == NULL) return NULL;
+    int index = hash & (pool->buckets_count - 1);
+    name->pool = pool;
+    name->next = pool->buckets[index];
+    pool->buckets[index] = name;
+    pool->size++;
+    return name;
+}
+
+/**
+ * namePoolGetSize - returns the number of distinct names in the pool
+ * @param pool - the pool to get its size
+ * @return the number of distinct names in the pool. -1 if the pool is NULL
+ */
+int namePoolGetSize(NamePool pool) {
+    if (pool == NULL) return -1;
+    return pool->size;
+}
+
+/**
+ * namePoolDestroy - deallocate the pool. names that are still held are detached from the pool, and are deallocated
+ * when their last handle is released.
+ * @param pool - the pool to destroy. if pool is NULL nothing will be done
+ */
+void namePoolDestroy(NamePool pool) {
+    if (pool == NULL) return;
+    for (int i = 0; i < pool->buckets_count; i++) {
+        for (Name name = pool->buckets[i]; name != NULL; name = name->next) {
+            name->pool = NULL;
+        }
+    }
+    free(pool->buckets);
+    free(pool);
+}
+
+/**
+ * nameRetain - adds a holder to the given name
+ * @param name - the name to retain
+ * @return the given name (NULL if name is NULL)
+ */
+Name nameRetain(Name name) {
+    if (name == NULL) return NULL;
+    name->references++;
+    return name;
+}
+
+/**
+ * nameRelease - removes a holder from the given name. the name is deallocated when its last holder releases it
+ * @param name - the name to release. if name is NULL nothing will be done
+ */
+void nameRelease(Name name) {
+    if (name == NULL) return;
+    name->references--;
+    if (name->references > 0) return;
+    NamePool pool = name->pool;
+    if (pool != NULL) {
+        Name* link = &pool->buckets[name->hash & (pool->buckets_count - 1)];
+        while (*link != name) {
+            link = &(*link)->next;
+        }
+        *link = name->next;
+        pool->size--;
+    }
+    free(name);
+}
+
+/**
+ * nameGetString - returns the string of the given name. the string is owned by the name
+ * @param name - the name to get its string
+ * @return the string of the name. NULL if name is NULL
+ */
+const char* nameGetString(Name name) {
+    if (name == NULL) return NULL;
+    return name->string;
+}
@@ -0,0 +1,67 @@
+#ifndef EX3_NAME_POOL_H
+#define EX3_NAME_POOL_H
+
+/**
+ * Pool of interned, immutable and reference counted names (strings).
+ *
+ * Every distinct string is stored once in the pool, and every holder of it keeps a Name handle to the shared copy.
+ * two names interned in the same pool are equal if and only if their handles are equal.
+ * a name is removed from the pool (and deallocated) when its last handle is released.
+ */
+typedef struct name_pool_t *NamePool;
+typedef struct name_t *Name;
+
+/**
+ * namePoolCreate - creates a new empty name pool
+ * @return
+ * NULL - if allocations failed.
+ * A new NamePool in case of success.
+ */
+NamePool namePoolCreate();
+
+/**
+ * namePoolIntern - returns a handle to the given string in the pool, adding it to the pool if it is not there yet.
+ * the returned handle must be released with nameRelease.
+ * @param pool - the pool to intern the string in. if NULL, a new name that is not shared with anyone is created
+ * @param string - the string to intern. the data is copied from the pointer
+ * @return
+ * NULL - if string is NULL or a memory allocation failed.
+ * The handle of the interned name otherwise.
+ */
+Name namePoolIntern(NamePool pool, const char* string);
+
+/**
+ * namePoolGetSize - returns the number of distinct names in the pool
+ * @param pool - the pool to get its size
+ * @return the number of distinct names in the pool. -1 if the pool is NULL
+ */
+int namePoolGetSize(NamePool pool);
+
+/**
+ * namePoolDestroy - deallocate the pool. names that are still held are detached from the pool, and are deallocated
+ * when their last handle is released.
+ * @param pool - the pool to destroy. if pool is NULL nothing will be done
+ */
+void namePoolDestroy(NamePool pool);
+
+/**
+ * nameRetain - adds a holder to the given name
+ * @param name - the name to retain
+ * @return the given name (NULL if name is NULL)
+ */
+Name nameRetain(Name name);
+
+/**
+ * nameRelease - removes a holder from the given name. the name is deallocated when its last holder releases it
+ * @param name - the name to release. if name is NULL nothing will be done
+ */
+void nameRelease(Name name);
+
+/**
+ * nameGetString - returns the string of the given name. the string is owned by the name
+ * @param name - the name to get its string
+ * @return the string of the name. NULL if name is NULL
+ */
+const char* nameGetString(Name name);
+
+#endif //EX3_NAME_POOL_H
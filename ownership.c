@@ -0,0 +1,45 @@
+#include "ownership.h"
+#include <stdlib.h>
+
+// the element that is being inserted right now by one of the "take" functions (NULL if there is no such element)
+static void* adopted_element = NULL;
+
+/**
+ * setAddTake - adds the given element to the set without copying it.
+ * @param set - the set to add the element to
+ * @param element - the element to add. the set owns it if SET_SUCCESS is returned
+ * @return
+ * the result of setAdd. on any result other than SET_SUCCESS the caller still owns the element
+ */
+SetResult setAddTake(Set set, SetElement element) {
+    adopted_element = element;
+    SetResult result = setAdd(set, element);
+    adopted_element = NULL;
+    return result;
+}
+
+/**
+ * listInsertLastTake - inserts the given element as the last element of the list without copying it.
+ * the iterator's value is undefined after this operation (same as listInsertLast)
+ * @param list - the list to insert the element to
+ * @param element - the element to insert. the list owns it if LIST_SUCCESS is returned
+ * @return
+ * the result of listInsertLast. on any result other than LIST_SUCCESS the caller still owns the element
+ */
+ListResult listInsertLastTake(List list, ListElement element) {
+    adopted_element = element;
+    ListResult result = listInsertLast(list, element);
+    adopted_element = NULL;
+    return result;
+}
+
+/**
+ * isElementAdopted - checks if the given element is the one currently being inserted by setAddTake or
+ * listInsertLastTake. should be called by copy functions only.
+ * @param element - the element the copy function got
+ * @return
+ * true if the copy function should return the element itself, false if it should copy it
+ */
+bool isElementAdopted(void* element) {
+    return (element != NULL && element == adopted_element);
+}
@@ -0,0 +1,51 @@
+#ifndef EX3_OWNERSHIP_H
+#define EX3_OWNERSHIP_H
+
+#include <stdbool.h>
+#include "set.h"
+#include "list.h"
+
+/**
+ * "Take" (ownership transfer) variants of the set/list insert functions.
+ *
+ * setAdd and listInsertLast always store a copy of the given element, so inserting an element that was just built
+ * means copying it and destroying the original. The functions here insert the element itself instead: the element's
+ * copy function is still called by the container, but it recognizes the element that is being adopted (using
+ * isElementAdopted) and returns it as is.
+ *
+ * Every copy function of an element that is inserted with these functions must start with:
+ *     if (isElementAdopted(element)) return element;
+ *
+ * The container allocates its node before it copies the element, so the transfer is all-or-nothing: on success the
+ * container owns the element, and on any failure the element still belongs to the caller.
+ */
+
+/**
+ * setAddTake - adds the given element to the set without copying it.
+ * @param set - the set to add the element to
+ * @param element - the element to add. the set owns it if SET_SUCCESS is returned
+ * @return
+ * the result of setAdd. on any result other than SET_SUCCESS the caller still owns the element
+ */
+SetResult setAddTake(Set set, SetElement element);
+
+/**
+ * listInsertLastTake - inserts the given element as the last element of the list without copying it.
+ * the iterator's value is undefined after this operation (same as listInsertLast)
+ * @param list - the list to insert the element to
+ * @param element - the element to insert. the list owns it if LIST_SUCCESS is returned
+ * @return
+ * the result of listInsertLast. on any result other than LIST_SUCCESS the caller still owns the element
+ */
+ListResult listInsertLastTake(List list, ListElement element);
+
+/**
+ * isElementAdopted - checks if the given element is the one currently being inserted by setAddTake or
+ * listInsertLastTake. should be called by copy functions only.
+ * @param element - the element the copy function got
+ * @return
+ * true if the copy function should return the element itself, false if it should copy it
+ */
+bool isElementAdopted(void* element);
+
+#endif //EX3_OWNERSHIP_H
@@ -0,0 +1,335 @@
+#include "report_cache.h"
+#include <stdlib.h>
+#include <stdint.h>
+
+#define REPORT_CACHE_INITIAL_BUCKETS 64
+
+typedef struct report_entry_t {
+    struct report_entry_t* next; // the next entry in the same bucket of the cache
+    struct report_entry_t* newer; // the entry that was printed after this one (NULL for the most recent one)
+    struct report_entry_t* older; // the entry that was printed before this one (NULL for the least recent one)
+    int student_id;
+    ReportKind kind;
+    unsigned int version;
+    char* bytes; // the rendered report
+    size_t size;
+} report_entry_t;
+
+typedef struct report_cache_t {
+    report_entry_t** buckets;
+    int buckets_count; // always a power of 2
+    int count;
+    report_entry_t* newest; // the most recently printed entry
+    report_entry_t* oldest; // the least recently printed entry - the next one to drop
+    size_t bytes; // the bytes all the entries take
+    size_t budget; // the maximal number of bytes the entries may take
+    FILE* scratch; // temporary file the reports are rendered into, NULL until the first report is rendered
+} report_cache_t;
+
+/**
+ * hashReport - hash of the key of a report entry (the version is not a part of the key - a student has a single
+ * version of every report in the cache)
+ */
+static uint32_t hashReport(int student_id, ReportKind kind) {
+    uint32_t hash = (uint32_t)student_id * 2654435761u;
+    return (hash ^ (uint32_t)kind) * 2246822519u;
+}
+
+/**
+ * entryBytes - returns the number of bytes the given entry takes from the budget
+ */
+static size_t entryBytes(report_entry_t* entry) {
+    return sizeof(*entry) + entry->size;
+}
+
+/**
+ * findBucketLink - returns the link that points to the entry of the given key in its bucket, or the NULL link at the
+ * end of the bucket if there is no such entry
+ */
+static report_entry_t** findBucketLink(ReportCache cache, int student_id, ReportKind kind) {
+    report_entry_t** link = &cache->buckets[hashReport(student_id, kind) & (cache->buckets_count - 1)];
+    while (*link != NULL && ((*link)->student_id != student_id || (*link)->kind != kind)) {
+        link = &(*link)->next;
+    }
+    return link;
+}
+
+/**
+ * unlinkRecency - removes the given entry from the order the entries were printed in
+ */
+static void unlinkRecency(ReportCache cache, report_entry_t* entry) {
+    if (entry->newer != NULL) {
+        entry->newer->older = entry->older;
+    } else {
+        cache->newest = entry->older;
+    }
+    if (entry->older != NULL) {
+        entry->older->newer = entry->newer;
+    } else {
+        cache->oldest = entry->newer;
+    }
+}
+
+/**
+ * linkNewest - puts the given entry (that is not in the order) as the most recently printed entry
+ */
+static void linkNewest(ReportCache cache, report_entry_t* entry) {
+    entry->newer = NULL;
+    entry->older = cache->newest;
+    if (cache->newest != NULL) {
+        cache->newest->newer = entry;
+    } else {
+        cache->oldest = entry;
+    }
+    cache->newest = entry;
+}
+
+/**
+ * removeEntry - removes the entry that the given bucket link points to from the cache, and deallocates it
+ */
+static void removeEntry(ReportCache cache, report_entry_t** link) {
+    report_entry_t* entry = *link;
+    *link = entry->next;
+    unlinkRecency(cache, entry);
+    cache->bytes -= entryBytes(entry);
+    cache->count--;
+    free(entry->bytes);
+    free(entry);
+}
+
+/**
+ * reportCacheGrow - doubles the number of buckets of the cache, and moves the entries to their new buckets
+ * @return false if there was a memory error (the cache is not changed), true otherwise
+ */
+static bool reportCacheGrow(ReportCache cache) {
+    int new_buckets_count = cache->buckets_count * 2;
+    report_entry_t** new_buckets = (report_entry_t**) calloc(new_buckets_count, sizeof(*new_buckets));
+    if (new_buckets == NULL) return false;
+    for (int i = 0; i < cache->buckets_count; i++) {
+        report_entry_t* entry = cache->buckets[i];
+        while (entry != NULL) {
+            report_entry_t* next = entry->next;
+            int index = hashReport(entry->student_id, entry->kind) & (new_buckets_count - 1);
+            entry->next = new_buckets[index];
+            new_buckets[index] = entry;
+            entry = next;
+        }
+    }
+    free(cache->buckets);
+    cache->buckets = new_buckets;
+    cache->buckets_count = new_buckets_count;
+    return true;
+}
+
+/** The results of rendering a report into memory */
+typedef enum render_result_t {
+    RENDER_OK,
+    RENDER_OUT_OF_MEMORY, // the renderer had a memory error
+    RENDER_UNAVAILABLE // the report could not be rendered into memory, and must be printed as is
+} render_result_t;
+
+/**
+ * renderReport - renders a report into the scratch file of the cache, and reads it back into memory. the scratch file
+ * is reused by all the renders: it is written from its start, and only the bytes of the current report are read
+ * @param cache - the cache to render with
+ * @param renderer - the function that prints the report
+ * @param context - passed as is to the renderer
+ * @param bytes - pointer to save the rendered bytes to (they must be deallocated by the caller)
+ * @param size - pointer to save the number of rendered bytes to
+ * @return the result of the render
+ */
+static render_result_t renderReport(ReportCache cache, ReportRenderer renderer, void* context, char** bytes,
+                                    size_t* size) {
+    if (cache->scratch == NULL) {
+        cache->scratch = tmpfile();
+        if (cache->scratch == NULL) return RENDER_UNAVAILABLE;
+    }
+    rewind(cache->scratch);
+    if (!renderer(context, cache->scratch)) return RENDER_OUT_OF_MEMORY;
+    if (fflush(cache->scratch) != 0) return RENDER_UNAVAILABLE;
+    long end = ftell(cache->scratch);
+    if (end < 0) return RENDER_UNAVAILABLE;
+    *bytes = (char*) malloc(end > 0 ? (size_t)end : 1);
+    if (*bytes == NULL) return RENDER_UNAVAILABLE;
+    rewind(cache->scratch);
+    if (fread(*bytes, 1, (size_t)end, cache->scratch) != (size_t)end) {
+        free(*bytes);
+        return RENDER_UNAVAILABLE;
+    }
+    *size = (size_t)end;
+    return RENDER_OK;
+}
+
+/**
+ * insertReport - puts the given rendered report in the cache as the most recently printed entry, dropping the least
+ * recently printed entries until it fits the budget. the cache takes the bytes (they are deallocated if the report is
+ * not cached)
+ */
+static void insertReport(ReportCache cache, int student_id, ReportKind kind, unsigned int version, char* bytes,
+                         size_t size) {
+    if (sizeof(report_entry_t) + size > cache->budget) { // would drop everything and still not fit
+        free(bytes);
+        return;
+    }
+    report_entry_t* entry = (report_entry_t*) malloc(sizeof(*entry));
+    if (entry == NULL) { // the report is printed anyway, it is just not cached
+        free(bytes);
+        return;
+    }
+    entry->student_id = student_id;
+    entry->kind = kind;
+    entry->version = version;
+    entry->bytes = bytes;
+    entry->size = size;
+    while (cache->bytes + entryBytes(entry) > cache->budget) {
+        report_entry_t* oldest = cache->oldest;
+        removeEntry(cache, findBucketLink(cache, oldest->student_id, oldest->kind));
+    }
+    // keep the average bucket length under 1. if growing fails, the cache just gets a bit slower
+    if (cache->count >= cache->buckets_count) {
+        reportCacheGrow(cache);
+    }
+    report_entry_t** link = findBucketLink(cache, student_id, kind);
+    entry->next = NULL;
+    *link = entry;
+    linkNewest(cache, entry);
+    cache->bytes += entryBytes(entry);
+    cache->count++;
+}
+
+/**
+ * reportCacheCreate - creates a new empty cache
+ * @param budget - the maximal number of bytes the cached reports may take
+ * @return
+ * NULL - if allocations failed.
+ * A new ReportCache in case of success.
+ */
+ReportCache reportCacheCreate(size_t budget) {
+    ReportCache cache = (ReportCache) malloc(sizeof(*cache));
+    if (cache == NULL) return NULL;
+    cache->buckets = (report_entry_t**) calloc(REPORT_CACHE_INITIAL_BUCKETS, sizeof(*cache->buckets));
+    if (cache->buckets == NULL) {
+        free(cache);
+        return NULL;
+    }
+    cache->buckets_count = REPORT_CACHE_INITIAL_BUCKETS;
+    cache->count = 0;
+    cache->newest = NULL;
+    cache->oldest = NULL;
+    cache->bytes = 0;
+    cache->budget = budget;
+    cache->scratch = NULL;
+    return cache;
+}
+
+/**
+ * reportCachePrint - prints the report of the given kind of the student with the given id. if the report of this
+ * version is cached, its bytes are written at once. otherwise the report is rendered with the given renderer, printed
+ * and cached (unless it is larger than the whole budget).
+ * @param cache - the cache to search the report in
+ * @param student_id - the id of the student of the report
+ * @param kind - the kind of the report
+ * @param version - the version of the student's grades
+ * @param renderer - the function that prints the report
+ * @param context - passed as is to the renderer
+ * @param output_channel - the channel to print the report to
+ * @return
+ * REPORT_CACHE_NULL_ARGUMENT - if cache, renderer or output_channel is NULL
+ * REPORT_CACHE_OUT_OF_MEMORY - if the renderer had a memory error (nothing is printed or cached)
+ * REPORT_CACHE_OK - otherwise
+ */
+ReportCacheResult reportCachePrint(ReportCache cache, int student_id, ReportKind kind, unsigned int version,
+                                   ReportRenderer renderer, void* context, FILE* output_channel) {
+    if (cache == NULL || renderer == NULL || output_channel == NULL) return REPORT_CACHE_NULL_ARGUMENT;
+    report_entry_t** link = findBucketLink(cache, student_id, kind);
+    if (*link != NULL && (*link)->version == version) {
+        unlinkRecency(cache, *link);
+        linkNewest(cache, *link);
+        fwrite((*link)->bytes, 1, (*link)->size, output_channel);
+        return REPORT_CACHE_OK;
+    }
+    if (*link != NULL) { // the report of an older version will not be asked for again
+        removeEntry(cache, link);
+    }
+    char* bytes = NULL;
+    size_t size = 0;
+    render_result_t render_result = renderReport(cache, renderer, context, &bytes, &size);
+    if (render_result == RENDER_OUT_OF_MEMORY) return REPORT_CACHE_OUT_OF_MEMORY;
+    if (render_result == RENDER_UNAVAILABLE) { // can not render into memory - print the report as is
+        return renderer(context, output_channel) ? REPORT_CACHE_OK : REPORT_CACHE_OUT_OF_MEMORY;
+    }
+    fwrite(bytes, 1, size, output_channel);
+    insertReport(cache, student_id, kind, version, bytes, size);
+    return REPORT_CACHE_OK;
+}
+
+/**
+ * reportCacheContains - checks if the report of the given kind and version of the student with the given id is cached
+ * @param cache - the cache to search in
+ * @param student_id - the id of the student of the report
+ * @param kind - the kind of the report
+ * @param version - the version of the student's grades
+ * @return true if the report is cached, false otherwise (or if cache is NULL)
+ */
+bool reportCacheContains(ReportCache cache, int student_id, ReportKind kind, unsigned int version) {
+    if (cache == NULL) return false;
+    report_entry_t* entry = *findBucketLink(cache, student_id, kind);
+    return entry != NULL && entry->version == version;
+}
+
+/**
+ * reportCacheRemoveStudent - drops all the cached reports of the student with the given id. must be called when the
+ * student is removed, since a new student with the same id starts again from the first version
+ * @param cache - the cache to remove the reports from
+ * @param student_id - the id of the student
+ */
+void reportCacheRemoveStudent(ReportCache cache, int student_id) {
+    if (cache == NULL) return;
+    ReportKind kinds[] = {REPORT_KIND_FULL, REPORT_KIND_CLEAN};
+    for (int i = 0; i < (int)(sizeof(kinds) / sizeof(*kinds)); i++) {
+        report_entry_t** link = findBucketLink(cache, student_id, kinds[i]);
+        if (*link != NULL) {
+            removeEntry(cache, link);
+        }
+    }
+}
+
+/**
+ * reportCacheGetCount - returns the number of cached reports
+ * @param cache - the cache
+ * @return the number of reports. -1 if cache is NULL
+ */
+int reportCacheGetCount(ReportCache cache) {
+    if (cache == NULL) return -1;
+    return cache->count;
+}
+
+/**
+ * reportCacheGetBytes - returns the number of bytes the cached reports take (never more than the budget)
+ * @param cache - the cache
+ * @return the number of bytes. 0 if cache is NULL
+ */
+size_t reportCacheGetBytes(ReportCache cache) {
+    if (cache == NULL) return 0;
+    return cache->bytes;
+}
+
+/**
+ * reportCacheDestroy - deallocate all the memory of the cache
+ * @param cache - the cache to destroy. if cache is NULL nothing will be done
+ */
+void reportCacheDestroy(ReportCache cache) {
+    if (cache == NULL) return;
+    report_entry_t* entry = cache->newest;
+    while (entry != NULL) {
+        report_entry_t* older = entry->older;
+        free(entry->bytes);
+        free(entry);
+        entry = older;
+    }
+    if (cache->scratch != NULL) {
+        fclose(cache->scratch);
+    }
+    free(cache->buckets);
+    free(cache);
+}
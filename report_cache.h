@@ -0,0 +1,106 @@
+#ifndef EX3_REPORT_CACHE_H
+#define EX3_REPORT_CACHE_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Cache of rendered reports, keyed by the id of the student, the kind of the report and the version of the student's
+ * grades the report was rendered from.
+ *
+ * A report is rendered once into memory, and printed again with a single write for as long as the grades of the
+ * student keep the same version. only the last version of every report is kept (an older version is never asked for
+ * again). the cache keeps at most the given number of bytes (the rendered bytes and the bookkeeping of every entry),
+ * and when it is full it drops the reports that were printed least recently.
+ */
+typedef struct report_cache_t *ReportCache;
+
+/** Type used for returning error codes from functions */
+typedef enum ReportCacheResult_t {
+    REPORT_CACHE_OK,
+    REPORT_CACHE_NULL_ARGUMENT,
+    REPORT_CACHE_OUT_OF_MEMORY
+} ReportCacheResult;
+
+/** The kinds of the cached reports */
+typedef enum ReportKind_t {
+    REPORT_KIND_FULL,
+    REPORT_KIND_CLEAN
+} ReportKind;
+
+/**
+ * ReportRenderer - prints a report to the given channel
+ * @param context - the context that was given with the renderer
+ * @param output_channel - the channel to print the report to
+ * @return false if there was a memory error, true otherwise
+ */
+typedef bool (*ReportRenderer)(void* context, FILE* output_channel);
+
+/**
+ * reportCacheCreate - creates a new empty cache
+ * @param budget - the maximal number of bytes the cached reports may take
+ * @return
+ * NULL - if allocations failed.
+ * A new ReportCache in case of success.
+ */
+ReportCache reportCacheCreate(size_t budget);
+
+/**
+ * reportCachePrint - prints the report of the given kind of the student with the given id. if the report of this
+ * version is cached, its bytes are written at once. otherwise the report is rendered with the given renderer, printed
+ * and cached (unless it is larger than the whole budget).
+ * @param cache - the cache to search the report in
+ * @param student_id - the id of the student of the report
+ * @param kind - the kind of the report
+ * @param version - the version of the student's grades
+ * @param renderer - the function that prints the report
+ * @param context - passed as is to the renderer
+ * @param output_channel - the channel to print the report to
+ * @return
+ * REPORT_CACHE_NULL_ARGUMENT - if cache, renderer or output_channel is NULL
+ * REPORT_CACHE_OUT_OF_MEMORY - if the renderer had a memory error (nothing is printed or cached)
+ * REPORT_CACHE_OK - otherwise
+ */
+ReportCacheResult reportCachePrint(ReportCache cache, int student_id, ReportKind kind, unsigned int version,
+                                   ReportRenderer renderer, void* context, FILE* output_channel);
+
+/**
+ * reportCacheContains - checks if the report of the given kind and version of the student with the given id is cached
+ * @param cache - the cache to search in
+ * @param student_id - the id of the student of the report
+ * @param kind - the kind of the report
+ * @param version - the version of the student's grades
+ * @return true if the report is cached, false otherwise (or if cache is NULL)
+ */
+bool reportCacheContains(ReportCache cache, int student_id, ReportKind kind, unsigned int version);
+
+/**
+ * reportCacheRemoveStudent - drops all the cached reports of the student with the given id. must be called when the
+ * student is removed, since a new student with the same id starts again from the first version
+ * @param cache - the cache to remove the reports from
+ * @param student_id - the id of the student
+ */
+void reportCacheRemoveStudent(ReportCache cache, int student_id);
+
+/**
+ * reportCacheGetCount - returns the number of cached reports
+ * @param cache - the cache
+ * @return the number of reports. -1 if cache is NULL
+ */
+int reportCacheGetCount(ReportCache cache);
+
+/**
+ * reportCacheGetBytes - returns the number of bytes the cached reports take (never more than the budget)
+ * @param cache - the cache
+ * @return the number of bytes. 0 if cache is NULL
+ */
+size_t reportCacheGetBytes(ReportCache cache);
+
+/**
+ * reportCacheDestroy - deallocate all the memory of the cache
+ * @param cache - the cache to destroy. if cache is NULL nothing will be done
+ */
+void reportCacheDestroy(ReportCache cache);
+
+#endif //EX3_REPORT_CACHE_H
@@ -2,14 +2,16 @@
 #include <stdlib.h>
 #include "assert.h"
 #include "student.h"
+#include "ownership.h"
 
 typedef struct semester_t {
     int semester_number;
     List grades;
+    CourseCatalog courses; // the catalog the grades' courses are taken from (not owned by the semester)
 } semester_t;
 
 /**
- * semesterCreate - creates a new semester grade
+ * semesterCreate - creates a new semester grade. the courses of its grades are not shared with other grades
  * @param semester - the semester number. must be positive number
  * @return
  * SEMESTER_OUT_OF_MEMORY - if there was a memory error
@@ -17,11 +19,25 @@ typedef struct semester_t {
  * SEMESTER_OK - otherwise
  */
 SemesterResult semesterCreate(int semester_number, Semester *semester) {
+    return semesterCreateWithCatalog(semester_number, NULL, semester);
+}
+
+/**
+ * semesterCreateWithCatalog - creates a new semester grade, whose grades take their courses from the given catalog
+ * @param semester - the semester number. must be positive number
+ * @param courses - the catalog of the courses. may be NULL. the catalog must outlive the semester's grades
+ * @return
+ * SEMESTER_OUT_OF_MEMORY - if there was a memory error
+ * SEMESTER_INVALID_PARAMETER - if semester is not valid (negative number)
+ * SEMESTER_OK - otherwise
+ */
+SemesterResult semesterCreateWithCatalog(int semester_number, CourseCatalog courses, Semester *semester) {
     if (semester_number <= 0) return SEMESTER_INVALID_PARAMETER;
 
     Semester new_semester = (Semester) malloc(sizeof(*new_semester));
     if (new_semester == NULL) return SEMESTER_OUT_OF_MEMORY;
     new_semester->semester_number = semester_number;
+    new_semester->courses = courses;
     new_semester->grades = listCreate(gradeCopy, gradeDestroy);
     if (new_semester->grades == NULL) {
         free(new_semester);
@@ -40,9 +56,11 @@ SemesterResult semesterCreate(int semester_number, Semester *semester) {
  */
 SetElement semesterCopy(SetElement semester) {
     if (semester == NULL || ((Semester)semester)->grades == NULL) return NULL;
+    if (isElementAdopted(semester)) return semester;
     Semester new_semester = (Semester) malloc(sizeof(*new_semester));
     if (new_semester == NULL) return NULL;
     new_semester->semester_number = ((Semester)semester)->semester_number;
+    new_semester->courses = ((Semester)semester)->courses;
     new_semester->grades = listCopy(((Semester)semester)->grades);
     if (new_semester->grades == NULL) {
         free(new_semester);
@@ -85,6 +103,16 @@ Semester getSemesterFromSet(Set set, int semester_number) {
     return NULL;
 }
 
+/**
+ * semesterGetNumber - returns the number of the given semester
+ * @param semester - the semester to get its number
+ * @return the semester number. -1 if the semester is NULL
+ */
+int semesterGetNumber(Semester semester) {
+    if (semester == NULL) return -1;
+    return semester->semester_number;
+}
+
 /**
  * semesterAddGrade - adds the given grade as last grade of the given semester
  * @param semester - the semester to add the grade to
@@ -103,13 +131,16 @@ SemesterResult semesterAddGrade(Semester semester, int course_id, char* points,
         return SEMESTER_OUT_OF_MEMORY;
     }
     Grade new_grade = NULL;
-    GradeResult create_result = gradeCreate(course_id, points, grade, semester->semester_number, &new_grade);
+    GradeResult create_result = gradeCreateWithCatalog(course_id, points, grade, semester->semester_number,
+                                                       semester->courses, &new_grade);
     if (create_result == GRADE_OUT_OF_MEMORY) return SEMESTER_OUT_OF_MEMORY;
     if (create_result == GRADE_INVALID_PARAMETER) return SEMESTER_INVALID_PARAMETER;
 
-    ListResult add_result = listInsertLast(semester->grades, (ListElement)new_grade);
-    gradeDestroy(new_grade);
-    if (add_result == LIST_OUT_OF_MEMORY) return SEMESTER_OUT_OF_MEMORY;
+    ListResult add_result = listInsertLastTake(semester->grades, (ListElement)new_grade);
+    if (add_result != LIST_SUCCESS) {
+        gradeDestroy(new_grade);
+        return SEMESTER_OUT_OF_MEMORY;
+    }
     return SEMESTER_OK;
 }
 
@@ -256,6 +287,20 @@ void semesterPrintAllSemesterGrades(Semester semester, FILE* output_channel) {
     }
 }
 
+/**
+ * semesterForEachGrade - calls the given visitor for every grade of the semester, in the order they were inserted.
+ * the visitor must not add or remove grades of the semester.
+ * @param semester - the semester to go over its grades
+ * @param visitor - the function to call for every grade
+ * @param context - passed as is to the visitor
+ */
+void semesterForEachGrade(Semester semester, GradeVisitor visitor, void* context) {
+    if (semester == NULL || semester->grades == NULL || visitor == NULL) return;
+    LIST_FOREACH(Grade, current_grade, semester->grades) {
+        visitor(current_grade, context);
+    }
+}
+
 /**
  * semesterGetCoursesSet - get a set of ids of all the courses in the given semester.
  * if there are no courses in the given semester or there was a memory error, set is not changed
@@ -386,6 +431,22 @@ SemesterResult semesterPrintInfo(Semester semester, FILE* output_channel) {
     return SEMESTER_OK;
 }
 
+/**
+ * semesterReleaseGrades - removes the first grades of the semester (in the order they were added)
+ * @param semester - the semester to remove the grades from
+ * @param count - the maximal number of grades to remove
+ * @return the number of removed grades. 0 if semester is NULL
+ */
+int semesterReleaseGrades(Semester semester, int count) {
+    if (semester == NULL) return 0;
+    int removed = 0;
+    while (removed < count && listGetFirst(semester->grades) != NULL) {
+        listRemoveCurrent(semester->grades);
+        removed++;
+    }
+    return removed;
+}
+
 /**
  * semesterDestroy - deallocate all the data of the semester
  * @param semester - the semester to destroy
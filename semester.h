@@ -19,7 +19,7 @@ typedef enum SemesterResult_t {
 } SemesterResult;
 
 /**
-* semesterCreate - creates a new semester grade
+* semesterCreate - creates a new semester grade. the courses of its grades are not shared with other grades
 * @param semester - the semester number. must be positive number
 * @return
 * SEMESTER_OUT_OF_MEMORY - if there was a memory error
@@ -28,6 +28,17 @@ typedef enum SemesterResult_t {
 */
 SemesterResult semesterCreate(int semester_number, Semester *semester);
 
+/**
+* semesterCreateWithCatalog - creates a new semester grade, whose grades take their courses from the given catalog
+* @param semester - the semester number. must be positive number
+* @param courses - the catalog of the courses. may be NULL. the catalog must outlive the semester's grades
+* @return
+* SEMESTER_OUT_OF_MEMORY - if there was a memory error
+* SEMESTER_INVALID_PARAMETER - if semester is not valid (negative number)
+* SEMESTER_OK - otherwise
+*/
+SemesterResult semesterCreateWithCatalog(int semester_number, CourseCatalog courses, Semester *semester);
+
 /**
  * semesterCopy - creates a copy of target semester
  * @param semester - target semester
@@ -58,6 +69,13 @@ int semesterCompare(SetElement semester1, SetElement semester2);
  */
 Semester getSemesterFromSet(Set set, int semester);
 
+/**
+ * semesterGetNumber - returns the number of the given semester
+ * @param semester - the semester to get its number
+ * @return the semester number. -1 if the semester is NULL
+ */
+int semesterGetNumber(Semester semester);
+
 /**
  * semesterAddGrade - adds the given grade as last grade of the given semester
  * @param semester - the semester to add the grade to
@@ -147,6 +165,15 @@ SemesterResult semesterUpdateGrade(Semester semester, int course_id, int new_gra
  */
 void semesterPrintAllSemesterGrades(Semester semester, FILE* output_channel);
 
+/**
+ * semesterForEachGrade - calls the given visitor for every grade of the semester, in the order they were inserted.
+ * the visitor must not add or remove grades of the semester.
+ * @param semester - the semester to go over its grades
+ * @param visitor - the function to call for every grade
+ * @param context - passed as is to the visitor
+ */
+void semesterForEachGrade(Semester semester, GradeVisitor visitor, void* context);
+
 /**
  * semesterGetCoursesSet - get a set of ids of all the courses in the given semester.
  * if there are no courses in the given semester or there was a memory error, NULL is returned
@@ -204,6 +231,14 @@ int semesterGetEffectiveGradeSumX2(Semester semester);
  */
 SemesterResult semesterPrintInfo(Semester semester, FILE* output_channel);
 
+/**
+ * semesterReleaseGrades - removes the first grades of the semester (in the order they were added)
+ * @param semester - the semester to remove the grades from
+ * @param count - the maximal number of grades to remove
+ * @return the number of removed grades. 0 if semester is NULL
+ */
+int semesterReleaseGrades(Semester semester, int count);
+
 /**
  * semesterDestroy - deallocate all the data of the semester
  * @param semester - the semester to destroy
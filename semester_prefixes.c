@@ -0,0 +1,117 @@
+#include "semester_prefixes.h"
+#include <stdlib.h>
+
+#define SEMESTER_PREFIXES_INITIAL_CAPACITY 16
+
+typedef struct semester_prefix_t {
+    int semester_number;
+    int points_x2;
+    int grade_sum_x2;
+} semester_prefix_t;
+
+typedef struct semester_prefixes_t {
+    semester_prefix_t* prefixes;
+    int count; // the number of valid prefixes. the prefixes after them are invalid, and are written over
+    int capacity;
+} semester_prefixes_t;
+
+/**
+ * semesterPrefixesCreate - creates new prefixes without semesters
+ * @return
+ * NULL - if allocations failed.
+ * A new SemesterPrefixes in case of success.
+ */
+SemesterPrefixes semesterPrefixesCreate() {
+    SemesterPrefixes prefixes = (SemesterPrefixes) malloc(sizeof(*prefixes));
+    if (prefixes == NULL) return NULL;
+    prefixes->prefixes = NULL;
+    prefixes->count = 0;
+    prefixes->capacity = 0;
+    return prefixes;
+}
+
+/**
+ * semesterPrefixesAppend - adds the prefix of the given semester after the last valid prefix
+ * @param prefixes - the prefixes to add to
+ * @param semester_number - the semester (must be higher than the semester of the last valid prefix)
+ * @param points_x2 - the cumulative effective points multiple by 2, until the semester (including it)
+ * @param grade_sum_x2 - the cumulative sum of the effective grades, each multiple by its points multiple by 2
+ * @return
+ * SEMESTER_PREFIXES_NULL_ARGUMENT - if prefixes is NULL
+ * SEMESTER_PREFIXES_INVALID_PARAMETER - if the semester is not higher than the semester of the last valid prefix
+ * SEMESTER_PREFIXES_OUT_OF_MEMORY - if there was a memory error (the prefixes are not changed)
+ * SEMESTER_PREFIXES_OK - otherwise
+ */
+SemesterPrefixesResult semesterPrefixesAppend(SemesterPrefixes prefixes, int semester_number, int points_x2,
+                                              int grade_sum_x2) {
+    if (prefixes == NULL) return SEMESTER_PREFIXES_NULL_ARGUMENT;
+    if (prefixes->count > 0 && semester_number <= prefixes->prefixes[prefixes->count - 1].semester_number) {
+        return SEMESTER_PREFIXES_INVALID_PARAMETER;
+    }
+    if (prefixes->count == prefixes->capacity) {
+        int new_capacity = (prefixes->capacity == 0) ? SEMESTER_PREFIXES_INITIAL_CAPACITY : prefixes->capacity * 2;
+        semester_prefix_t* new_prefixes = (semester_prefix_t*) realloc(prefixes->prefixes,
+                                                                       sizeof(*new_prefixes) * new_capacity);
+        if (new_prefixes == NULL) return SEMESTER_PREFIXES_OUT_OF_MEMORY;
+        prefixes->prefixes = new_prefixes;
+        prefixes->capacity = new_capacity;
+    }
+    semester_prefix_t* prefix = &prefixes->prefixes[prefixes->count++];
+    prefix->semester_number = semester_number;
+    prefix->points_x2 = points_x2;
+    prefix->grade_sum_x2 = grade_sum_x2;
+    return SEMESTER_PREFIXES_OK;
+}
+
+/**
+ * semesterPrefixesInvalidateFrom - invalidates the prefixes of the given semester and of the semesters after it, after
+ * the grades of the semester were changed
+ * @param prefixes - the prefixes to invalidate. if prefixes is NULL nothing will be done
+ * @param semester_number - the first semester whose prefix is invalid
+ */
+void semesterPrefixesInvalidateFrom(SemesterPrefixes prefixes, int semester_number) {
+    if (prefixes == NULL) return;
+    while (prefixes->count > 0 && prefixes->prefixes[prefixes->count - 1].semester_number >= semester_number) {
+        prefixes->count--;
+    }
+}
+
+/**
+ * semesterPrefixesGetCount - returns the number of valid prefixes
+ * @param prefixes - the prefixes
+ * @return the number of valid prefixes. -1 if prefixes is NULL
+ */
+int semesterPrefixesGetCount(SemesterPrefixes prefixes) {
+    if (prefixes == NULL) return -1;
+    return prefixes->count;
+}
+
+/**
+ * semesterPrefixesGet - returns the valid prefix with the given index (the prefixes are sorted by the semester number)
+ * @param prefixes - the prefixes to search in
+ * @param index - the index of the prefix (lower than the number of valid prefixes)
+ * @param semester_number - pointer to save the semester of the prefix to
+ * @param points_x2 - pointer to save the cumulative effective points of the prefix to
+ * @param grade_sum_x2 - pointer to save the cumulative sum of the effective grades of the prefix to
+ * @return true if the prefix was returned, false if there is no valid prefix with this index (or one of the arguments
+ * is NULL)
+ */
+bool semesterPrefixesGet(SemesterPrefixes prefixes, int index, int* semester_number, int* points_x2,
+                         int* grade_sum_x2) {
+    if (prefixes == NULL || semester_number == NULL || points_x2 == NULL || grade_sum_x2 == NULL) return false;
+    if (index < 0 || index >= prefixes->count) return false;
+    *semester_number = prefixes->prefixes[index].semester_number;
+    *points_x2 = prefixes->prefixes[index].points_x2;
+    *grade_sum_x2 = prefixes->prefixes[index].grade_sum_x2;
+    return true;
+}
+
+/**
+ * semesterPrefixesDestroy - deallocate all the memory of the prefixes
+ * @param prefixes - the prefixes to destroy. if prefixes is NULL nothing will be done
+ */
+void semesterPrefixesDestroy(SemesterPrefixes prefixes) {
+    if (prefixes == NULL) return;
+    free(prefixes->prefixes);
+    free(prefixes);
+}
@@ -0,0 +1,80 @@
+#ifndef EX3_SEMESTER_PREFIXES_H
+#define EX3_SEMESTER_PREFIXES_H
+
+#include <stdbool.h>
+
+/**
+ * The cumulative effective totals of a grade sheet after each of its semesters, sorted by the semester number.
+ *
+ * The prefix of a semester holds the effective points and grade sum of the sheet when only the grades of that
+ * semester and the ones before it are counted. a change of the grades of a semester changes only its prefix and the
+ * prefixes after it, so only they are invalidated, and they are appended again from the last valid prefix.
+ */
+typedef struct semester_prefixes_t *SemesterPrefixes;
+
+/** Type used for returning error codes from functions */
+typedef enum SemesterPrefixesResult_t {
+    SEMESTER_PREFIXES_OK,
+    SEMESTER_PREFIXES_NULL_ARGUMENT,
+    SEMESTER_PREFIXES_OUT_OF_MEMORY,
+    SEMESTER_PREFIXES_INVALID_PARAMETER
+} SemesterPrefixesResult;
+
+/**
+ * semesterPrefixesCreate - creates new prefixes without semesters
+ * @return
+ * NULL - if allocations failed.
+ * A new SemesterPrefixes in case of success.
+ */
+SemesterPrefixes semesterPrefixesCreate();
+
+/**
+ * semesterPrefixesAppend - adds the prefix of the given semester after the last valid prefix
+ * @param prefixes - the prefixes to add to
+ * @param semester_number - the semester (must be higher than the semester of the last valid prefix)
+ * @param points_x2 - the cumulative effective points multiple by 2, until the semester (including it)
+ * @param grade_sum_x2 - the cumulative sum of the effective grades, each multiple by its points multiple by 2
+ * @return
+ * SEMESTER_PREFIXES_NULL_ARGUMENT - if prefixes is NULL
+ * SEMESTER_PREFIXES_INVALID_PARAMETER - if the semester is not higher than the semester of the last valid prefix
+ * SEMESTER_PREFIXES_OUT_OF_MEMORY - if there was a memory error (the prefixes are not changed)
+ * SEMESTER_PREFIXES_OK - otherwise
+ */
+SemesterPrefixesResult semesterPrefixesAppend(SemesterPrefixes prefixes, int semester_number, int points_x2,
+                                              int grade_sum_x2);
+
+/**
+ * semesterPrefixesInvalidateFrom - invalidates the prefixes of the given semester and of the semesters after it, after
+ * the grades of the semester were changed
+ * @param prefixes - the prefixes to invalidate. if prefixes is NULL nothing will be done
+ * @param semester_number - the first semester whose prefix is invalid
+ */
+void semesterPrefixesInvalidateFrom(SemesterPrefixes prefixes, int semester_number);
+
+/**
+ * semesterPrefixesGetCount - returns the number of valid prefixes
+ * @param prefixes - the prefixes
+ * @return the number of valid prefixes. -1 if prefixes is NULL
+ */
+int semesterPrefixesGetCount(SemesterPrefixes prefixes);
+
+/**
+ * semesterPrefixesGet - returns the valid prefix with the given index (the prefixes are sorted by the semester number)
+ * @param prefixes - the prefixes to search in
+ * @param index - the index of the prefix (lower than the number of valid prefixes)
+ * @param semester_number - pointer to save the semester of the prefix to
+ * @param points_x2 - pointer to save the cumulative effective points of the prefix to
+ * @param grade_sum_x2 - pointer to save the cumulative sum of the effective grades of the prefix to
+ * @return true if the prefix was returned, false if there is no valid prefix with this index (or one of the arguments
+ * is NULL)
+ */
+bool semesterPrefixesGet(SemesterPrefixes prefixes, int index, int* semester_number, int* points_x2,
+                         int* grade_sum_x2);
+
+/**
+ * semesterPrefixesDestroy - deallocate all the memory of the prefixes
+ * @param prefixes - the prefixes to destroy. if prefixes is NULL nothing will be done
+ */
+void semesterPrefixesDestroy(SemesterPrefixes prefixes);
+
+#endif //EX3_SEMESTER_PREFIXES_H
@@ -0,0 +1,223 @@
+#include "semester_table.h"
+#include <stdlib.h>
+#include <limits.h>
+#include "typed_containers.h"
+
+#define SEMESTER_TABLE_DIRECT_LIMIT 1024 // semesters with lower numbers are indexed directly
+#define SEMESTER_TABLE_INITIAL_CAPACITY 16
+
+typedef struct semester_table_t {
+    Semester* direct; // direct[n] is the semester number n (or NULL), for every n lower than direct_capacity
+    int direct_capacity;
+    SemesterVector sparse; // the semesters numbered SEMESTER_TABLE_DIRECT_LIMIT and above
+    int size;
+} semester_table_t;
+
+/**
+ * semesterTableGrowDirect - inner function that makes sure the direct array has a place for the given number
+ * @param table - the table to grow its direct array
+ * @param semester_number - the number to make a place for (must be lower than SEMESTER_TABLE_DIRECT_LIMIT)
+ * @return
+ * SEMESTER_TABLE_OUT_OF_MEMORY - if there was a memory error (the table is not changed)
+ * SEMESTER_TABLE_OK - otherwise
+ */
+static SemesterTableResult semesterTableGrowDirect(SemesterTable table, int semester_number) {
+    if (semester_number < table->direct_capacity) return SEMESTER_TABLE_OK;
+    int new_capacity = (table->direct_capacity == 0) ? SEMESTER_TABLE_INITIAL_CAPACITY : table->direct_capacity;
+    while (new_capacity <= semester_number) {
+        new_capacity *= 2;
+    }
+    if (new_capacity > SEMESTER_TABLE_DIRECT_LIMIT) {
+        new_capacity = SEMESTER_TABLE_DIRECT_LIMIT;
+    }
+    Semester* new_direct = (Semester*) realloc(table->direct, sizeof(Semester) * new_capacity);
+    if (new_direct == NULL) return SEMESTER_TABLE_OUT_OF_MEMORY;
+    for (int i = table->direct_capacity; i < new_capacity; i++) {
+        new_direct[i] = NULL;
+    }
+    table->direct = new_direct;
+    table->direct_capacity = new_capacity;
+    return SEMESTER_TABLE_OK;
+}
+
+/**
+ * semesterTableCreate - creates a new empty table. no memory is allocated for the semesters until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new SemesterTable in case of success.
+ */
+SemesterTable semesterTableCreate() {
+    SemesterTable table = (SemesterTable) malloc(sizeof(*table));
+    if (table == NULL) return NULL;
+    table->direct = NULL;
+    table->direct_capacity = 0;
+    semesterVectorInit(&table->sparse);
+    table->size = 0;
+    return table;
+}
+
+/**
+ * semesterTableCopy - creates a copy of the given table, with copies of all its semesters
+ * @param table - the table to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A SemesterTable with the same semesters as the given table otherwise.
+ */
+SemesterTable semesterTableCopy(SemesterTable table) {
+    if (table == NULL) return NULL;
+    SemesterTable new_table = semesterTableCreate();
+    if (new_table == NULL) return NULL;
+    if (table->direct_capacity > 0) {
+        new_table->direct = (Semester*) malloc(sizeof(Semester) * table->direct_capacity);
+        if (new_table->direct == NULL) {
+            semesterTableDestroy(new_table);
+            return NULL;
+        }
+        new_table->direct_capacity = table->direct_capacity;
+        for (int i = 0; i < table->direct_capacity; i++) {
+            new_table->direct[i] = NULL;
+        }
+    }
+    if (semesterVectorReserve(&new_table->sparse, semesterVectorSize(&table->sparse)) != VECTOR_OK) {
+        semesterTableDestroy(new_table);
+        return NULL;
+    }
+    SEMESTER_TABLE_FOREACH(semester, table) {
+        Semester new_semester = semesterCopy(semester);
+        if (new_semester == NULL) {
+            semesterTableDestroy(new_table);
+            return NULL;
+        }
+        int semester_number = semesterGetNumber(semester);
+        if (semester_number < SEMESTER_TABLE_DIRECT_LIMIT) {
+            new_table->direct[semester_number] = new_semester;
+        } else { // there is enough capacity, so appending (in the sorted order) can not fail
+            SemesterEntry entry = {semester_number, new_semester};
+            semesterVectorAppend(&new_table->sparse, entry);
+        }
+        new_table->size++;
+    }
+    return new_table;
+}
+
+/**
+ * semesterTableGetSize - returns the number of semesters in the table
+ * @param table - the table to get its size
+ * @return the number of semesters in the table. -1 if the table is NULL
+ */
+int semesterTableGetSize(SemesterTable table) {
+    if (table == NULL) return -1;
+    return table->size;
+}
+
+/**
+ * semesterTableGet - returns the semester with the given number
+ * @param table - the table to search in
+ * @param semester_number - the number of the semester to search
+ * @return the semester (owned by the table). NULL if it is not in the table (or the table is NULL)
+ */
+Semester semesterTableGet(SemesterTable table, int semester_number) {
+    if (table == NULL || semester_number <= 0) return NULL;
+    if (semester_number < SEMESTER_TABLE_DIRECT_LIMIT) {
+        if (semester_number >= table->direct_capacity) return NULL;
+        return table->direct[semester_number];
+    }
+    SemesterEntry* entry = semesterVectorFind(&table->sparse, semester_number);
+    return (entry == NULL) ? NULL : entry->semester;
+}
+
+/**
+ * semesterTableAdd - creates a new empty semester with the given number in the table
+ * @param table - the table to add the semester to
+ * @param semester_number - the number of the new semester (must be positive number)
+ * @param courses - the catalog the grades of the semester take their courses from. may be NULL
+ * @param semester - pointer to save the new semester (owned by the table) to
+ * @return
+ * SEMESTER_TABLE_NULL_ARGUMENT - if the table or semester is NULL
+ * SEMESTER_TABLE_INVALID_PARAMETER - if the semester number is not positive
+ * SEMESTER_TABLE_SEMESTER_ALREADY_EXISTS - if there is already a semester with this number in the table
+ * SEMESTER_TABLE_OUT_OF_MEMORY - if there was a memory error
+ * SEMESTER_TABLE_OK - otherwise
+ */
+SemesterTableResult semesterTableAdd(SemesterTable table, int semester_number, CourseCatalog courses,
+                                     Semester *semester) {
+    if (table == NULL || semester == NULL) return SEMESTER_TABLE_NULL_ARGUMENT;
+    if (semester_number <= 0) return SEMESTER_TABLE_INVALID_PARAMETER;
+    if (semesterTableGet(table, semester_number) != NULL) return SEMESTER_TABLE_SEMESTER_ALREADY_EXISTS;
+    // make a place for the semester first, so the semester does not have to be destroyed if it fails
+    if (semester_number < SEMESTER_TABLE_DIRECT_LIMIT) {
+        if (semesterTableGrowDirect(table, semester_number) != SEMESTER_TABLE_OK) return SEMESTER_TABLE_OUT_OF_MEMORY;
+    } else if (semesterVectorReserve(&table->sparse, semesterVectorSize(&table->sparse) + 1) != VECTOR_OK) {
+        return SEMESTER_TABLE_OUT_OF_MEMORY;
+    }
+    Semester new_semester = NULL;
+    if (semesterCreateWithCatalog(semester_number, courses, &new_semester) != SEMESTER_OK) {
+        return SEMESTER_TABLE_OUT_OF_MEMORY;
+    }
+    if (semester_number < SEMESTER_TABLE_DIRECT_LIMIT) {
+        table->direct[semester_number] = new_semester;
+    } else { // there is enough capacity, so inserting can not fail
+        SemesterEntry entry = {semester_number, new_semester};
+        semesterVectorInsert(&table->sparse, entry);
+    }
+    table->size++;
+    *semester = new_semester;
+    return SEMESTER_TABLE_OK;
+}
+
+/**
+ * semesterTableRemove - removes the semester with the given number from the table and destroys it
+ * @param table - the table to remove the semester from
+ * @param semester_number - the number of the semester to remove
+ * @return
+ * SEMESTER_TABLE_NULL_ARGUMENT - if the table is NULL
+ * SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST - if there is no semester with this number in the table
+ * SEMESTER_TABLE_OK - otherwise
+ */
+SemesterTableResult semesterTableRemove(SemesterTable table, int semester_number) {
+    if (table == NULL) return SEMESTER_TABLE_NULL_ARGUMENT;
+    Semester semester = semesterTableGet(table, semester_number);
+    if (semester == NULL) return SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST;
+    if (semester_number < SEMESTER_TABLE_DIRECT_LIMIT) {
+        table->direct[semester_number] = NULL;
+    } else {
+        semesterVectorRemove(&table->sparse, semester_number);
+    }
+    semesterDestroy(semester);
+    table->size--;
+    return SEMESTER_TABLE_OK;
+}
+
+/**
+ * semesterTableNext - returns the semester with the lowest number that is higher than the given number
+ * @param table - the table to search in
+ * @param semester_number - the number to start after. 0 to get the first semester
+ * @return the next semester. NULL if there is none (or the table is NULL)
+ */
+Semester semesterTableNext(SemesterTable table, int semester_number) {
+    if (table == NULL || semester_number == INT_MAX) return NULL;
+    int next_number = (semester_number < 0) ? 1 : semester_number + 1;
+    for (; next_number < table->direct_capacity; next_number++) {
+        if (table->direct[next_number] != NULL) return table->direct[next_number];
+    }
+    int index = semesterVectorLowerBound(&table->sparse, next_number);
+    if (index == semesterVectorSize(&table->sparse)) return NULL;
+    return semesterVectorAt(&table->sparse, index)->semester;
+}
+
+/**
+ * semesterTableDestroy - deallocate the table and all its semesters
+ * @param table - the table to destroy. if table is NULL nothing will be done
+ */
+void semesterTableDestroy(SemesterTable table) {
+    if (table == NULL) return;
+    for (int i = 0; i < table->direct_capacity; i++) {
+        semesterDestroy(table->direct[i]);
+    }
+    for (int i = 0; i < semesterVectorSize(&table->sparse); i++) {
+        semesterDestroy(semesterVectorAt(&table->sparse, i)->semester);
+    }
+    free(table->direct);
+    semesterVectorDestroy(&table->sparse);
+    free(table);
+}
@@ -0,0 +1,107 @@
+#ifndef EX3_SEMESTER_TABLE_H
+#define EX3_SEMESTER_TABLE_H
+
+#include "semester.h"
+
+/**
+ * Table of the semesters of a single student, indexed by the semester number.
+ *
+ * Semesters numbered below SEMESTER_TABLE_DIRECT_LIMIT (all the real ones) are kept in an array indexed directly by
+ * their number, which grows up to the highest number in use. higher numbers are kept in a small sorted array, so a
+ * huge semester number does not make the table huge. the table owns its semesters.
+ */
+typedef struct semester_table_t *SemesterTable;
+
+/** Type used for returning error codes from functions */
+typedef enum SemesterTableResult_t {
+    SEMESTER_TABLE_OK,
+    SEMESTER_TABLE_NULL_ARGUMENT,
+    SEMESTER_TABLE_OUT_OF_MEMORY,
+    SEMESTER_TABLE_INVALID_PARAMETER,
+    SEMESTER_TABLE_SEMESTER_ALREADY_EXISTS,
+    SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST
+} SemesterTableResult;
+
+/**
+ * semesterTableCreate - creates a new empty table. no memory is allocated for the semesters until the first add
+ * @return
+ * NULL - if allocations failed.
+ * A new SemesterTable in case of success.
+ */
+SemesterTable semesterTableCreate();
+
+/**
+ * semesterTableCopy - creates a copy of the given table, with copies of all its semesters
+ * @param table - the table to copy
+ * @return
+ * NULL if a NULL was sent or a memory allocation failed.
+ * A SemesterTable with the same semesters as the given table otherwise.
+ */
+SemesterTable semesterTableCopy(SemesterTable table);
+
+/**
+ * semesterTableGetSize - returns the number of semesters in the table
+ * @param table - the table to get its size
+ * @return the number of semesters in the table. -1 if the table is NULL
+ */
+int semesterTableGetSize(SemesterTable table);
+
+/**
+ * semesterTableGet - returns the semester with the given number
+ * @param table - the table to search in
+ * @param semester_number - the number of the semester to search
+ * @return the semester (owned by the table). NULL if it is not in the table (or the table is NULL)
+ */
+Semester semesterTableGet(SemesterTable table, int semester_number);
+
+/**
+ * semesterTableAdd - creates a new empty semester with the given number in the table
+ * @param table - the table to add the semester to
+ * @param semester_number - the number of the new semester (must be positive number)
+ * @param courses - the catalog the grades of the semester take their courses from. may be NULL
+ * @param semester - pointer to save the new semester (owned by the table) to
+ * @return
+ * SEMESTER_TABLE_NULL_ARGUMENT - if the table or semester is NULL
+ * SEMESTER_TABLE_INVALID_PARAMETER - if the semester number is not positive
+ * SEMESTER_TABLE_SEMESTER_ALREADY_EXISTS - if there is already a semester with this number in the table
+ * SEMESTER_TABLE_OUT_OF_MEMORY - if there was a memory error
+ * SEMESTER_TABLE_OK - otherwise
+ */
+SemesterTableResult semesterTableAdd(SemesterTable table, int semester_number, CourseCatalog courses,
+                                     Semester *semester);
+
+/**
+ * semesterTableRemove - removes the semester with the given number from the table and destroys it
+ * @param table - the table to remove the semester from
+ * @param semester_number - the number of the semester to remove
+ * @return
+ * SEMESTER_TABLE_NULL_ARGUMENT - if the table is NULL
+ * SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST - if there is no semester with this number in the table
+ * SEMESTER_TABLE_OK - otherwise
+ */
+SemesterTableResult semesterTableRemove(SemesterTable table, int semester_number);
+
+/**
+ * semesterTableNext - returns the semester with the lowest number that is higher than the given number
+ * @param table - the table to search in
+ * @param semester_number - the number to start after. 0 to get the first semester
+ * @return the next semester. NULL if there is none (or the table is NULL)
+ */
+Semester semesterTableNext(SemesterTable table, int semester_number);
+
+/**
+ * semesterTableDestroy - deallocate the table and all its semesters
+ * @param table - the table to destroy. if table is NULL nothing will be done
+ */
+void semesterTableDestroy(SemesterTable table);
+
+/**
+ * Macro for iterating over the semesters of a table, sorted by the semester number.
+ * the table must not be changed while iterating over it.
+ * declares a new Semester variable named iterator, that contains the current semester in every iteration.
+ */
+#define SEMESTER_TABLE_FOREACH(iterator, table) \
+    for (Semester iterator = semesterTableNext(table, 0); iterator != NULL; \
+         iterator = semesterTableNext(table, semesterGetNumber(iterator)))
+
+#endif //EX3_SEMESTER_TABLE_H
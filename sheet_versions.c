@@ -0,0 +1,502 @@
+#include "sheet_versions.h"
+#include <stdlib.h>
+#include "mtm_ex3.h"
+#include "course_catalog.h"
+#include "grade_kernels.h"
+
+#define SHEET_VERSIONS_INITIAL_CAPACITY 16
+
+typedef struct version_grade_t {
+    int course_id;
+    int points_x2;
+    int grade;
+} version_grade_t;
+
+typedef struct semester_version_t {
+    int references; // the number of sheet versions that hold the semester
+    int semester_number;
+    int count;
+    version_grade_t grades[]; // in the order they were added to the semester, allocated together with it
+} semester_version_t;
+
+typedef struct sheet_version_t {
+    int references; // the number of SheetVersions that hold the version (a copy shares the versions)
+    int count;
+    semester_version_t* semesters[]; // sorted by the semester number, allocated together with the version
+} sheet_version_t;
+
+typedef struct version_entry_t {
+    int sequence;
+    sheet_version_t* sheet;
+} version_entry_t;
+
+typedef struct sheet_versions_t {
+    version_entry_t* entries; // sorted by the sequence number, without two versions with the same number
+    int count;
+    int capacity;
+} sheet_versions_t;
+
+/** An effective grade of a version (a grade of its clean sheet), with the semester it counts in */
+typedef struct effective_grade_t {
+    int course_id;
+    int semester_number;
+    int points_x2;
+    int grade;
+} effective_grade_t;
+
+/**
+ * countGrade - inner GradeVisitor that counts the grades of a semester
+ * @param grade - the counted grade
+ * @param context - pointer to the int counter
+ */
+static void countGrade(Grade grade, void* context) {
+    (void)grade;
+    (*(int*)context)++;
+}
+
+/**
+ * collectGrade - inner GradeVisitor that adds the given grade after the grades of the semester version
+ * @param grade - the grade to add
+ * @param context - the semester_version_t, allocated with enough place for all the grades of the semester
+ */
+static void collectGrade(Grade grade, void* context) {
+    semester_version_t* semester = context;
+    version_grade_t* version_grade = &semester->grades[semester->count++];
+    version_grade->course_id = getCourseId(grade);
+    version_grade->points_x2 = getCoursePointsX2(grade);
+    version_grade->grade = getGradeNumber(grade);
+}
+
+/**
+ * semesterVersionCreate - creates an immutable copy of the current grades of the given semester
+ * @return the copy (held by one version). NULL if allocations failed
+ */
+static semester_version_t* semesterVersionCreate(int semester_number, Semester semester) {
+    int count = 0;
+    semesterForEachGrade(semester, countGrade, &count);
+    semester_version_t* version = (semester_version_t*) malloc(sizeof(*version) + sizeof(version_grade_t) * count);
+    if (version == NULL) return NULL;
+    version->references = 1;
+    version->semester_number = semester_number;
+    version->count = 0;
+    semesterForEachGrade(semester, collectGrade, version);
+    return version;
+}
+
+/**
+ * semesterVersionRelease - removes a holder from the given semester, and deallocates it when it has no holders
+ */
+static void semesterVersionRelease(semester_version_t* semester) {
+    if (semester == NULL) return;
+    semester->references--;
+    if (semester->references > 0) return;
+    free(semester);
+}
+
+/**
+ * sheetVersionCreate - creates a version with place for the given number of semesters (held by one SheetVersions)
+ * @return the version. NULL if allocations failed
+ */
+static sheet_version_t* sheetVersionCreate(int count) {
+    sheet_version_t* sheet = (sheet_version_t*) malloc(sizeof(*sheet) + sizeof(semester_version_t*) * count);
+    if (sheet == NULL) return NULL;
+    sheet->references = 1;
+    sheet->count = count;
+    return sheet;
+}
+
+/**
+ * sheetVersionRelease - removes a holder from the given version, and deallocates it when it has no holders
+ */
+static void sheetVersionRelease(sheet_version_t* sheet) {
+    if (sheet == NULL) return;
+    sheet->references--;
+    if (sheet->references > 0) return;
+    for (int i = 0; i < sheet->count; i++) {
+        semesterVersionRelease(sheet->semesters[i]);
+    }
+    free(sheet);
+}
+
+/**
+ * getLastSheet - returns the last recorded version. NULL if no version was recorded
+ */
+static sheet_version_t* getLastSheet(SheetVersions versions) {
+    return (versions->count == 0) ? NULL : versions->entries[versions->count - 1].sheet;
+}
+
+/**
+ * findSheet - returns the last version that was recorded until the given sequence number (including it), by a binary
+ * search. NULL if no version was recorded until it
+ */
+static sheet_version_t* findSheet(SheetVersions versions, int sequence) {
+    int low = 0, high = versions->count; // the first version after the sequence number is in [low, high]
+    while (low < high) {
+        int middle = low + (high - low) / 2;
+        if (versions->entries[middle].sequence <= sequence) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return (low == 0) ? NULL : versions->entries[low - 1].sheet;
+}
+
+/**
+ * reserveEntry - makes sure there is place for one more version, so adding a version does not fail
+ * @return false if there was a memory error, true otherwise
+ */
+static bool reserveEntry(SheetVersions versions) {
+    if (versions->count < versions->capacity) return true;
+    int new_capacity = (versions->capacity == 0) ? SHEET_VERSIONS_INITIAL_CAPACITY : versions->capacity * 2;
+    version_entry_t* new_entries = (version_entry_t*) realloc(versions->entries, sizeof(*new_entries) * new_capacity);
+    if (new_entries == NULL) return false;
+    versions->entries = new_entries;
+    versions->capacity = new_capacity;
+    return true;
+}
+
+/**
+ * addSheet - adds the given version after the last version (there must be place for it), or replaces the last version
+ * if it has the same sequence number. the versions take the holder of the given version
+ */
+static void addSheet(SheetVersions versions, int sequence, sheet_version_t* sheet) {
+    if (versions->count > 0 && versions->entries[versions->count - 1].sequence == sequence) {
+        sheetVersionRelease(versions->entries[versions->count - 1].sheet);
+        versions->entries[versions->count - 1].sheet = sheet;
+        return;
+    }
+    versions->entries[versions->count].sequence = sequence;
+    versions->entries[versions->count].sheet = sheet;
+    versions->count++;
+}
+
+/**
+ * sheetVersionsCreate - creates new versions of an empty sheet, without any recorded version
+ * @return
+ * NULL - if allocations failed.
+ * A new SheetVersions in case of success.
+ */
+SheetVersions sheetVersionsCreate() {
+    SheetVersions versions = (SheetVersions) malloc(sizeof(*versions));
+    if (versions == NULL) return NULL;
+    versions->entries = NULL;
+    versions->count = 0;
+    versions->capacity = 0;
+    return versions;
+}
+
+/**
+ * sheetVersionsCopy - creates a copy of the given versions, that shares all the recorded versions with them
+ * @param versions - the versions to copy
+ * @return
+ * NULL - if versions is NULL or allocations failed.
+ * A new SheetVersions in case of success.
+ */
+SheetVersions sheetVersionsCopy(SheetVersions versions) {
+    if (versions == NULL) return NULL;
+    SheetVersions copy = sheetVersionsCreate();
+    if (copy == NULL) return NULL;
+    if (versions->count > 0) {
+        copy->entries = (version_entry_t*) malloc(sizeof(version_entry_t) * versions->count);
+        if (copy->entries == NULL) {
+            free(copy);
+            return NULL;
+        }
+        copy->capacity = versions->count;
+    }
+    for (int i = 0; i < versions->count; i++) {
+        copy->entries[i] = versions->entries[i];
+        copy->entries[i].sheet->references++;
+    }
+    copy->count = versions->count;
+    return copy;
+}
+
+/**
+ * sheetVersionsRecordSemester - records a new version of the sheet, where the semester with the given number has the
+ * current grades of the given semester, and all the other semesters are as in the last version. if the last version
+ * was recorded with the same sequence number, the new version replaces it.
+ * @param versions - the versions to record to
+ * @param sequence - the sequence number of the command that changed the semester (must not be lower than the sequence
+ * number of the last version)
+ * @param semester_number - the number of the changed semester (must be positive number)
+ * @param semester - the semester after the change. NULL if the semester was removed from the sheet
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions is NULL
+ * SHEET_VERSIONS_INVALID_PARAMETER - if the sequence number is lower than the one of the last version, or the semester
+ * number is not positive
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error (the versions are not changed)
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsRecordSemester(SheetVersions versions, int sequence, int semester_number,
+                                                Semester semester) {
+    if (versions == NULL) return SHEET_VERSIONS_NULL_ARGUMENT;
+    if (semester_number <= 0) return SHEET_VERSIONS_INVALID_PARAMETER;
+    if (versions->count > 0 && sequence < versions->entries[versions->count - 1].sequence) {
+        return SHEET_VERSIONS_INVALID_PARAMETER;
+    }
+    if (!reserveEntry(versions)) return SHEET_VERSIONS_OUT_OF_MEMORY;
+    sheet_version_t* last = getLastSheet(versions);
+    int last_count = (last == NULL) ? 0 : last->count;
+    int index = 0; // the place of the semester in the last version
+    while (index < last_count && last->semesters[index]->semester_number < semester_number) {
+        index++;
+    }
+    bool replaced = index < last_count && last->semesters[index]->semester_number == semester_number;
+    semester_version_t* changed = NULL;
+    if (semester != NULL) {
+        changed = semesterVersionCreate(semester_number, semester);
+        if (changed == NULL) return SHEET_VERSIONS_OUT_OF_MEMORY;
+    }
+    sheet_version_t* sheet = sheetVersionCreate(last_count - (replaced ? 1 : 0) + ((changed != NULL) ? 1 : 0));
+    if (sheet == NULL) {
+        semesterVersionRelease(changed);
+        return SHEET_VERSIONS_OUT_OF_MEMORY;
+    }
+    // the semesters that were not changed are shared with the last version
+    int next = 0;
+    for (int i = 0; i < index; i++) {
+        sheet->semesters[next] = last->semesters[i];
+        sheet->semesters[next++]->references++;
+    }
+    if (changed != NULL) {
+        sheet->semesters[next++] = changed;
+    }
+    for (int i = index + (replaced ? 1 : 0); i < last_count; i++) {
+        sheet->semesters[next] = last->semesters[i];
+        sheet->semesters[next++]->references++;
+    }
+    addSheet(versions, sequence, sheet);
+    return SHEET_VERSIONS_OK;
+}
+
+/**
+ * sheetVersionsRecordEmpty - records a new version of the sheet without semesters, so the whole sheet can be recorded
+ * again semester after semester. if the last version was recorded with the same sequence number, the new version
+ * replaces it.
+ * @param versions - the versions to record to
+ * @param sequence - the sequence number of the command (must not be lower than the sequence number of the last version)
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions is NULL
+ * SHEET_VERSIONS_INVALID_PARAMETER - if the sequence number is lower than the one of the last version
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error (the versions are not changed)
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsRecordEmpty(SheetVersions versions, int sequence) {
+    if (versions == NULL) return SHEET_VERSIONS_NULL_ARGUMENT;
+    if (versions->count > 0 && sequence < versions->entries[versions->count - 1].sequence) {
+        return SHEET_VERSIONS_INVALID_PARAMETER;
+    }
+    if (!reserveEntry(versions)) return SHEET_VERSIONS_OUT_OF_MEMORY;
+    sheet_version_t* sheet = sheetVersionCreate(0);
+    if (sheet == NULL) return SHEET_VERSIONS_OUT_OF_MEMORY;
+    addSheet(versions, sequence, sheet);
+    return SHEET_VERSIONS_OK;
+}
+
+/**
+ * sheetVersionsGetCount - returns the number of recorded versions
+ * @param versions - the versions
+ * @return the number of versions. -1 if versions is NULL
+ */
+int sheetVersionsGetCount(SheetVersions versions) {
+    if (versions == NULL) return -1;
+    return versions->count;
+}
+
+/**
+ * sheetVersionsGetSemesterCount - returns the number of semesters the sheet had as of the given sequence number (after
+ * the command with this number)
+ * @param versions - the versions to search in
+ * @param sequence - the sequence number
+ * @return the number of semesters (0 if no version was recorded until the sequence number). -1 if versions is NULL
+ */
+int sheetVersionsGetSemesterCount(SheetVersions versions, int sequence) {
+    if (versions == NULL) return -1;
+    sheet_version_t* sheet = findSheet(versions, sequence);
+    return (sheet == NULL) ? 0 : sheet->count;
+}
+
+/**
+ * isLastGradeOfCourse - checks if the grade with the given index is the last grade of its course in the semester (the
+ * grade of the course that counts in the semester)
+ */
+static bool isLastGradeOfCourse(semester_version_t* semester, int index) {
+    for (int i = index + 1; i < semester->count; i++) {
+        if (semester->grades[i].course_id == semester->grades[index].course_id) return false;
+    }
+    return true;
+}
+
+/**
+ * compareEffectiveGrades - orders effective grades by their course id, and then by their semester number
+ */
+static int compareEffectiveGrades(const void* element1, const void* element2) {
+    const effective_grade_t* grade1 = element1;
+    const effective_grade_t* grade2 = element2;
+    if (grade1->course_id != grade2->course_id) return (grade1->course_id < grade2->course_id) ? -1 : 1;
+    if (grade1->semester_number != grade2->semester_number) {
+        return (grade1->semester_number < grade2->semester_number) ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * collectEffectiveGrades - inner function that collects the effective grades of the given version (its clean sheet):
+ * the last grade of every course in the last semester it was taken in, and for sport courses - the last grade of the
+ * course in every semester it was taken in. the grades are sorted by the course id, and then by the semester number
+ * @param sheet - the version (NULL for an empty sheet)
+ * @param grades - pointer to save the allocated array of the effective grades to (NULL if there are none)
+ * @param count - pointer to save the number of effective grades to
+ * @return false if there was a memory error, true otherwise
+ */
+static bool collectEffectiveGrades(sheet_version_t* sheet, effective_grade_t** grades, int* count) {
+    *grades = NULL;
+    *count = 0;
+    int total = 0;
+    for (int i = 0; sheet != NULL && i < sheet->count; i++) {
+        total += sheet->semesters[i]->count;
+    }
+    if (total == 0) return true;
+    *grades = (effective_grade_t*) malloc(sizeof(effective_grade_t) * total);
+    if (*grades == NULL) return false;
+    for (int i = 0; i < sheet->count; i++) {
+        semester_version_t* semester = sheet->semesters[i];
+        for (int j = 0; j < semester->count; j++) {
+            if (!isLastGradeOfCourse(semester, j)) continue;
+            effective_grade_t* effective = &(*grades)[(*count)++];
+            effective->course_id = semester->grades[j].course_id;
+            effective->semester_number = semester->semester_number;
+            effective->points_x2 = semester->grades[j].points_x2;
+            effective->grade = semester->grades[j].grade;
+        }
+    }
+    qsort(*grades, *count, sizeof(effective_grade_t), compareEffectiveGrades);
+    // a course that is not a sport course counts only in the last semester it was taken in
+    int kept = 0;
+    for (int i = 0; i < *count; i++) {
+        if (isSportCourseId((*grades)[i].course_id) || i == *count - 1 ||
+            (*grades)[i + 1].course_id != (*grades)[i].course_id) {
+            (*grades)[kept++] = (*grades)[i];
+        }
+    }
+    *count = kept;
+    return true;
+}
+
+/**
+ * sumEffectiveGrades - inner function that sums the points and the grades of the given effective grades
+ */
+static void sumEffectiveGrades(effective_grade_t* grades, int count, int* points_x2, int* grade_sum_x2) {
+    *points_x2 = 0;
+    *grade_sum_x2 = 0;
+    for (int i = 0; i < count; i++) {
+        *points_x2 += grades[i].points_x2;
+        *grade_sum_x2 += grades[i].points_x2 * grades[i].grade;
+    }
+}
+
+/**
+ * sheetVersionsPrintFull - prints all the grades of the sheet as of the given sequence number, semester after
+ * semester, with the info of every semester and the summary of the sheet (like the full report of a student, without
+ * the details of the student)
+ * @param versions - the versions to print from
+ * @param sequence - the sequence number of the command that the sheet is printed as of (after it)
+ * @param output_channel - the channel to print the sheet to
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions or output_channel is NULL
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsPrintFull(SheetVersions versions, int sequence, FILE* output_channel) {
+    if (versions == NULL || output_channel == NULL) return SHEET_VERSIONS_NULL_ARGUMENT;
+    sheet_version_t* sheet = findSheet(versions, sequence);
+    effective_grade_t* effective_grades;
+    int effective_count;
+    if (!collectEffectiveGrades(sheet, &effective_grades, &effective_count)) return SHEET_VERSIONS_OUT_OF_MEMORY;
+    int total_points_x2 = 0, failed_points_x2 = 0;
+    for (int i = 0; sheet != NULL && i < sheet->count; i++) {
+        semester_version_t* semester = sheet->semesters[i];
+        int semester_points_x2 = 0, semester_failed_points_x2 = 0;
+        int semester_effective_points_x2 = 0, semester_effective_grade_sum_x2 = 0;
+        for (int j = 0; j < semester->count; j++) {
+            version_grade_t* grade = &semester->grades[j];
+            mtmPrintGradeInfo(output_channel, grade->course_id, grade->points_x2, grade->grade);
+            semester_points_x2 += grade->points_x2;
+            if (grade->grade < FAILED_GRADE_LIMIT) {
+                semester_failed_points_x2 += grade->points_x2;
+            }
+            if (isLastGradeOfCourse(semester, j)) {
+                semester_effective_points_x2 += grade->points_x2;
+                semester_effective_grade_sum_x2 += grade->points_x2 * grade->grade;
+            }
+        }
+        mtmPrintSemesterInfo(output_channel, semester->semester_number, semester_points_x2, semester_failed_points_x2,
+                             semester_effective_points_x2, semester_effective_grade_sum_x2);
+        total_points_x2 += semester_points_x2;
+        failed_points_x2 += semester_failed_points_x2;
+    }
+    int effective_points_x2, effective_grade_sum_x2;
+    sumEffectiveGrades(effective_grades, effective_count, &effective_points_x2, &effective_grade_sum_x2);
+    mtmPrintSummary(output_channel, total_points_x2, failed_points_x2, effective_points_x2, effective_grade_sum_x2);
+    free(effective_grades);
+    return SHEET_VERSIONS_OK;
+}
+
+/**
+ * sheetVersionsPrintClean - prints the effective grades of the sheet as of the given sequence number, sorted by the
+ * course id (and by the semester number for sport courses), with the clean summary of the sheet (like the clean
+ * report of a student, without the details of the student)
+ * @param versions - the versions to print from
+ * @param sequence - the sequence number of the command that the sheet is printed as of (after it)
+ * @param output_channel - the channel to print the sheet to
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions or output_channel is NULL
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsPrintClean(SheetVersions versions, int sequence, FILE* output_channel) {
+    if (versions == NULL || output_channel == NULL) return SHEET_VERSIONS_NULL_ARGUMENT;
+    effective_grade_t* effective_grades;
+    int effective_count;
+    if (!collectEffectiveGrades(findSheet(versions, sequence), &effective_grades, &effective_count)) {
+        return SHEET_VERSIONS_OUT_OF_MEMORY;
+    }
+    for (int i = 0; i < effective_count; i++) {
+        mtmPrintGradeInfo(output_channel, effective_grades[i].course_id, effective_grades[i].points_x2,
+                          effective_grades[i].grade);
+    }
+    int effective_points_x2, effective_grade_sum_x2;
+    sumEffectiveGrades(effective_grades, effective_count, &effective_points_x2, &effective_grade_sum_x2);
+    mtmPrintCleanSummary(output_channel, effective_points_x2, effective_grade_sum_x2);
+    free(effective_grades);
+    return SHEET_VERSIONS_OK;
+}
+
+/**
+ * sheetVersionsReleaseLast - removes the last recorded version (it is deallocated unless a copy still holds it)
+ * @param versions - the versions to remove the last version from
+ * @return the number of semesters the removed version held. -1 if there are no versions (or versions is NULL)
+ */
+int sheetVersionsReleaseLast(SheetVersions versions) {
+    if (versions == NULL || versions->count == 0) return -1;
+    sheet_version_t* sheet = versions->entries[--versions->count].sheet;
+    int semester_count = sheet->count;
+    sheetVersionRelease(sheet);
+    return semester_count;
+}
+
+/**
+ * sheetVersionsDestroy - deallocate all the memory of the versions (the versions that are shared with a copy are
+ * deallocated when the copy is destroyed)
+ * @param versions - the versions to destroy. if versions is NULL nothing will be done
+ */
+void sheetVersionsDestroy(SheetVersions versions) {
+    if (versions == NULL) return;
+    for (int i = 0; i < versions->count; i++) {
+        sheetVersionRelease(versions->entries[i].sheet);
+    }
+    free(versions->entries);
+    free(versions);
+}
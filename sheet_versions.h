@@ -0,0 +1,133 @@
+#ifndef EX3_SHEET_VERSIONS_H
+#define EX3_SHEET_VERSIONS_H
+
+#include <stdio.h>
+#include "semester.h"
+
+/**
+ * The versions of a grade sheet, tagged with the sequence numbers of the commands that made them.
+ *
+ * The versions are persistent: a version is an immutable array of immutable semesters, and a new version copies only
+ * the semester that was changed - all the other semesters are shared with the version before it (each semester keeps
+ * the number of versions that hold it). so recording a change takes O(grades of the semester + semesters), and the
+ * sheet as of any past command is found by a binary search over the versions, without replaying the changes.
+ */
+typedef struct sheet_versions_t *SheetVersions;
+
+/** Type used for returning error codes from functions */
+typedef enum SheetVersionsResult_t {
+    SHEET_VERSIONS_OK,
+    SHEET_VERSIONS_NULL_ARGUMENT,
+    SHEET_VERSIONS_OUT_OF_MEMORY,
+    SHEET_VERSIONS_INVALID_PARAMETER
+} SheetVersionsResult;
+
+/**
+ * sheetVersionsCreate - creates new versions of an empty sheet, without any recorded version
+ * @return
+ * NULL - if allocations failed.
+ * A new SheetVersions in case of success.
+ */
+SheetVersions sheetVersionsCreate();
+
+/**
+ * sheetVersionsCopy - creates a copy of the given versions, that shares all the recorded versions with them
+ * @param versions - the versions to copy
+ * @return
+ * NULL - if versions is NULL or allocations failed.
+ * A new SheetVersions in case of success.
+ */
+SheetVersions sheetVersionsCopy(SheetVersions versions);
+
+/**
+ * sheetVersionsRecordSemester - records a new version of the sheet, where the semester with the given number has the
+ * current grades of the given semester, and all the other semesters are as in the last version. if the last version
+ * was recorded with the same sequence number, the new version replaces it.
+ * @param versions - the versions to record to
+ * @param sequence - the sequence number of the command that changed the semester (must not be lower than the sequence
+ * number of the last version)
+ * @param semester_number - the number of the changed semester (must be positive number)
+ * @param semester - the semester after the change. NULL if the semester was removed from the sheet
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions is NULL
+ * SHEET_VERSIONS_INVALID_PARAMETER - if the sequence number is lower than the one of the last version, or the semester
+ * number is not positive
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error (the versions are not changed)
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsRecordSemester(SheetVersions versions, int sequence, int semester_number,
+                                                Semester semester);
+
+/**
+ * sheetVersionsRecordEmpty - records a new version of the sheet without semesters, so the whole sheet can be recorded
+ * again semester after semester. if the last version was recorded with the same sequence number, the new version
+ * replaces it.
+ * @param versions - the versions to record to
+ * @param sequence - the sequence number of the command (must not be lower than the sequence number of the last version)
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions is NULL
+ * SHEET_VERSIONS_INVALID_PARAMETER - if the sequence number is lower than the one of the last version
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error (the versions are not changed)
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsRecordEmpty(SheetVersions versions, int sequence);
+
+/**
+ * sheetVersionsGetCount - returns the number of recorded versions
+ * @param versions - the versions
+ * @return the number of versions. -1 if versions is NULL
+ */
+int sheetVersionsGetCount(SheetVersions versions);
+
+/**
+ * sheetVersionsGetSemesterCount - returns the number of semesters the sheet had as of the given sequence number (after
+ * the command with this number)
+ * @param versions - the versions to search in
+ * @param sequence - the sequence number
+ * @return the number of semesters (0 if no version was recorded until the sequence number). -1 if versions is NULL
+ */
+int sheetVersionsGetSemesterCount(SheetVersions versions, int sequence);
+
+/**
+ * sheetVersionsPrintFull - prints all the grades of the sheet as of the given sequence number, semester after
+ * semester, with the info of every semester and the summary of the sheet (like the full report of a student, without
+ * the details of the student)
+ * @param versions - the versions to print from
+ * @param sequence - the sequence number of the command that the sheet is printed as of (after it)
+ * @param output_channel - the channel to print the sheet to
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions or output_channel is NULL
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsPrintFull(SheetVersions versions, int sequence, FILE* output_channel);
+
+/**
+ * sheetVersionsPrintClean - prints the effective grades of the sheet as of the given sequence number, sorted by the
+ * course id (and by the semester number for sport courses), with the clean summary of the sheet (like the clean
+ * report of a student, without the details of the student)
+ * @param versions - the versions to print from
+ * @param sequence - the sequence number of the command that the sheet is printed as of (after it)
+ * @param output_channel - the channel to print the sheet to
+ * @return
+ * SHEET_VERSIONS_NULL_ARGUMENT - if versions or output_channel is NULL
+ * SHEET_VERSIONS_OUT_OF_MEMORY - if there was a memory error
+ * SHEET_VERSIONS_OK - otherwise
+ */
+SheetVersionsResult sheetVersionsPrintClean(SheetVersions versions, int sequence, FILE* output_channel);
+
+/**
+ * sheetVersionsReleaseLast - removes the last recorded version (it is deallocated unless a copy still holds it)
+ * @param versions - the versions to remove the last version from
+ * @return the number of semesters the removed version held. -1 if there are no versions (or versions is NULL)
+ */
+int sheetVersionsReleaseLast(SheetVersions versions);
+
+/**
+ * sheetVersionsDestroy - deallocate all the memory of the versions (the versions that are shared with a copy are
+ * deallocated when the copy is destroyed)
+ * @param versions - the versions to destroy. if versions is NULL nothing will be done
+ */
+void sheetVersionsDestroy(SheetVersions versions);
+
+#endif //EX3_SHEET_VERSIONS_H
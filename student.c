@@ -3,22 +3,41 @@
 #include <stdlib.h>
 #include "assert.h"
 #include "semester.h"
+#include "semester_table.h"
 #include "grade.h"
+#include "ownership.h"
+#include "int_set.h"
+#include "course_bitmap.h"
+#include "course_history.h"
+#include "semester_prefixes.h"
+#include "sheet_versions.h"
 
-#define MIN_SPORT_COURSE_ID 390000
-#define MAX_SPORT_COURSE_ID 399999
+/** the cold data of a student - used only when printing. the names are shared through a NamePool */
+typedef struct student_names_t {
+    Name first;
+    Name last;
+} student_names_t;
 
 typedef struct student_t {
     int id;
-    char* firstName;
-    char* lastName;
-    Set friends; // set of the students' ids
-    Set pendingFriendRequests; // set of the students' ids
-    Set semesters;
+    IntSet friends; // set of the students' ids
+    IntSet pendingFriendRequests; // set of the students' ids
+    SemesterTable semesters; // the semesters the student has grades in, indexed by their number
+    CourseBitmap taken_courses; // the ids of all the courses the student has grades in
+    CourseHistory course_history; // the semesters and the grades of every course the student has grades in
+    CourseCatalog courses; // the catalog the courses of the student's grades are taken from (not owned)
+    int effective_points_x2; // the points of the student's clean sheet (multiple by 2), kept up to date with the grades
+    int effective_grade_sum_x2; // the sum of the effective grades, each multiple by its points (multiple by 2)
+    SemesterPrefixes progression; // the effective totals after every semester, NULL until they are first needed
+    SheetVersions versions; // the past versions of the grade sheet, NULL until the first version is recorded
+    bool versions_stale; // whether the grades were changed since the last version without recording it
+    unsigned int version; // advanced by every change of the grades, so reports rendered before it are not reused
+    student_names_t names;
 } student_t;
 
 /**
 * studentCreate: creates new student (and allocates memory for all it's details).
+* the names of the student are not shared with other students.
 * @param id - the id of the student
 * @param firstName - the student's first name. the data is copied from the pointer
 * @param lastName - the student's last name. the data is copied from the pointer
@@ -30,46 +49,92 @@ typedef struct student_t {
 * STUDENT_OK - otherwise
 */
 StudentResult studentCreate(int id, char* firstName, char* lastName, Student *student) {
+    return studentCreateWithSharedData(id, firstName, lastName, NULL, NULL, student);
+}
+
+/**
+* studentCreateWithSharedData: creates new student, whose names are interned in the given name pool, and
+* whose grades take their courses from the given catalog.
+* @param id - the id of the student
+* @param firstName - the student's first name. the data is copied from the pointer (if it is not in the pool yet)
+* @param lastName - the student's last name. the data is copied from the pointer (if it is not in the pool yet)
+* @param names - the pool to intern the names in. if NULL, the names are not shared with other students
+* @param courses - the catalog of the courses. if NULL, the courses of the grades are not shared with other grades
+* @param student - pointer to the student object which the new student will be saved to
+* @return
+* STUDENT_NULL_ARGUMENT - if one of the argument is Null
+* STUDENT_OUT_OF_MEMORY - if there was a memory error
+* STUDENT_INVALID_PARAMETER - if the id entered is invalid (number is higher than 999999999 or negative)
+* STUDENT_OK - otherwise
+*/
+StudentResult studentCreateWithSharedData(int id, char* firstName, char* lastName, NamePool names,
+                                          CourseCatalog courses, Student *student) {
     if (firstName == NULL || lastName == NULL) return STUDENT_NULL_ARGUMENT;
     if (id >= 1000000000 || id <= 0) return STUDENT_INVALID_PARAMETER;
 
     Student new_student = (Student) malloc(sizeof(*new_student));
     if (new_student == NULL) return STUDENT_OUT_OF_MEMORY;
     new_student->id = id;
-    new_student->firstName = (char*) malloc(strlen(firstName) + 1);
-    if (new_student->firstName == NULL) {
+    new_student->courses = courses;
+    new_student->effective_points_x2 = 0;
+    new_student->effective_grade_sum_x2 = 0;
+    new_student->progression = NULL;
+    new_student->versions = NULL;
+    new_student->versions_stale = true; // the first version records the whole sheet
+    new_student->version = 0;
+    new_student->names.first = namePoolIntern(names, firstName);
+    if (new_student->names.first == NULL) {
         free(new_student);
         return STUDENT_OUT_OF_MEMORY;
     }
-    strcpy(new_student->firstName, firstName);
-    new_student->lastName = (char*) malloc(strlen(lastName) + 1);
-    if (new_student->lastName == NULL) {
-        free(new_student->firstName);
+    new_student->names.last = namePoolIntern(names, lastName);
+    if (new_student->names.last == NULL) {
+        nameRelease(new_student->names.first);
         free(new_student);
         return STUDENT_OUT_OF_MEMORY;
     }
-    strcpy(new_student->lastName, lastName);
-    new_student->friends = setCreate(copyInt, destroyInt, compareInt);
+    new_student->friends = intSetCreate();
     if (new_student->friends == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
+        nameRelease(new_student->names.first);
+        nameRelease(new_student->names.last);
         free(new_student);
         return STUDENT_OUT_OF_MEMORY;
     }
-    new_student->pendingFriendRequests = setCreate(copyInt, destroyInt, compareInt);
+    new_student->pendingFriendRequests = intSetCreate();
     if (new_student->pendingFriendRequests == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
-        setDestroy(new_student->friends);
+        nameRelease(new_student->names.first);
+        nameRelease(new_student->names.last);
+        intSetDestroy(new_student->friends);
         free(new_student);
         return STUDENT_OUT_OF_MEMORY;
     }
-    new_student->semesters = setCreate(semesterCopy, semesterDestroy, semesterCompare);
+    new_student->semesters = semesterTableCreate();
     if (new_student->semesters == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
-        setDestroy(new_student->friends);
-        setDestroy(new_student->pendingFriendRequests);
+        nameRelease(new_student->names.first);
+        nameRelease(new_student->names.last);
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
+        free(new_student);
+        return STUDENT_OUT_OF_MEMORY;
+    }
+    new_student->taken_courses = courseBitmapCreate();
+    if (new_student->taken_courses == NULL) {
+        nameRelease(new_student->names.first);
+        nameRelease(new_student->names.last);
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
+        semesterTableDestroy(new_student->semesters);
+        free(new_student);
+        return STUDENT_OUT_OF_MEMORY;
+    }
+    new_student->course_history = courseHistoryCreate();
+    if (new_student->course_history == NULL) {
+        nameRelease(new_student->names.first);
+        nameRelease(new_student->names.last);
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
+        semesterTableDestroy(new_student->semesters);
+        courseBitmapDestroy(new_student->taken_courses);
         free(new_student);
         return STUDENT_OUT_OF_MEMORY;
     }
@@ -78,7 +143,7 @@ StudentResult studentCreate(int id, char* firstName, char* lastName, Student *st
 }
 
 /**
- * studentCopy: Creates a copy of target student.
+ * studentCopy: Creates a copy of target student. the copy shares the names of the target student.
  *
  * @param student - Target student.
  * @return
@@ -87,46 +152,66 @@ StudentResult studentCreate(int id, char* firstName, char* lastName, Student *st
  */
 SetElement studentCopy(SetElement student) {
     if (student == NULL) return NULL;
+    if (isElementAdopted(student)) return student;
     Student new_student = (Student) malloc(sizeof(*new_student));
     if (new_student == NULL) return NULL;
     new_student->id = ((Student)student)->id;
-    new_student->firstName = (char*) malloc(strlen(((Student)student)->firstName) + 1);
-    if (new_student->firstName == NULL) {
+    new_student->courses = ((Student)student)->courses;
+    new_student->effective_points_x2 = ((Student)student)->effective_points_x2;
+    new_student->effective_grade_sum_x2 = ((Student)student)->effective_grade_sum_x2;
+    new_student->progression = NULL; // the copy calculates its own progression when it is needed
+    new_student->versions = NULL;
+    new_student->versions_stale = ((Student)student)->versions_stale;
+    new_student->version = ((Student)student)->version;
+    new_student->friends = intSetCopy(((Student)student)->friends);
+    if (new_student->friends == NULL) {
         free(new_student);
         return NULL;
     }
-    strcpy(new_student->firstName, ((Student)student)->firstName);
-    new_student->lastName = (char*) malloc(strlen(((Student)student)->lastName) + 1);
-    if (new_student->lastName == NULL) {
-        free(new_student->firstName);
+    new_student->pendingFriendRequests = intSetCopy(((Student)student)->pendingFriendRequests);
+    if (new_student->pendingFriendRequests == NULL) {
+        intSetDestroy(new_student->friends);
         free(new_student);
         return NULL;
     }
-    strcpy(new_student->lastName, ((Student)student)->lastName);
-    new_student->friends = setCopy(((Student)student)->friends);
-    if (new_student->friends == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
+    new_student->semesters = semesterTableCopy(((Student)student)->semesters);
+    if (new_student->semesters == NULL) {
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
         free(new_student);
         return NULL;
     }
-    new_student->pendingFriendRequests = setCopy(((Student)student)->pendingFriendRequests);
-    if (new_student->pendingFriendRequests == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
-        setDestroy(new_student->friends);
+    new_student->taken_courses = courseBitmapCopy(((Student)student)->taken_courses);
+    if (new_student->taken_courses == NULL) {
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
+        semesterTableDestroy(new_student->semesters);
         free(new_student);
         return NULL;
     }
-    new_student->semesters = setCopy(((Student)student)->semesters);
-    if (new_student->semesters == NULL) {
-        free(new_student->firstName);
-        free(new_student->lastName);
-        setDestroy(new_student->friends);
-        setDestroy(new_student->pendingFriendRequests);
+    new_student->course_history = courseHistoryCopy(((Student)student)->course_history);
+    if (new_student->course_history == NULL) {
+        intSetDestroy(new_student->friends);
+        intSetDestroy(new_student->pendingFriendRequests);
+        semesterTableDestroy(new_student->semesters);
+        courseBitmapDestroy(new_student->taken_courses);
         free(new_student);
         return NULL;
     }
+    if (((Student)student)->versions != NULL) { // the copy shares the past versions
+        new_student->versions = sheetVersionsCopy(((Student)student)->versions);
+        if (new_student->versions == NULL) {
+            intSetDestroy(new_student->friends);
+            intSetDestroy(new_student->pendingFriendRequests);
+            semesterTableDestroy(new_student->semesters);
+            courseBitmapDestroy(new_student->taken_courses);
+            courseHistoryDestroy(new_student->course_history);
+            free(new_student);
+            return NULL;
+        }
+    }
+    new_student->names.first = nameRetain(((Student)student)->names.first);
+    new_student->names.last = nameRetain(((Student)student)->names.last);
     return new_student;
 }
 
@@ -153,7 +238,7 @@ int studentCompare(SetElement student1, SetElement student2) {
 }
 
 ///////////////////////////////////////////////////////////////////
-// functions to use for Set of ints (students' ids)
+// functions to use for Set of ints (courses' ids)
 ///////////////////////////////////////////////////////////////////
 /**
  * copyInt - copies int
@@ -222,7 +307,57 @@ Student getStudentFromSet(Set set, int id) {
  */
 Set studentGetStudentFriends(Student student) {
     if (student == NULL) return NULL;
-    return setCopy(student->friends);
+    Set friends = setCreate(copyInt, destroyInt, compareInt);
+    if (friends == NULL) return NULL;
+    INT_SET_FOREACH(friend_id, student->friends) {
+        if (setAdd(friends, &friend_id) == SET_OUT_OF_MEMORY) {
+            setDestroy(friends);
+            return NULL;
+        }
+    }
+    return friends;
+}
+
+/**
+ * studentForEachFriend - calls the given visitor for the id of every friend of the student (sorted by id).
+ * unlike studentGetStudentFriends, the ids are not copied. the visitor must not change the student's friends.
+ * @param student - the student to go over his friends
+ * @param visitor - the function to call for every friend id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachFriend(Student student, StudentIdVisitor visitor, void* context) {
+    if (student == NULL || visitor == NULL) return;
+    INT_SET_FOREACH(friend_id, student->friends) {
+        visitor(friend_id, context);
+    }
+}
+
+/**
+ * studentForEachMutualFriend - calls the given visitor for the id of every student who is a friend of both students
+ * (sorted by id). the friends lists are intersected in place, without copying them.
+ * @param student1 - the first student
+ * @param student2 - the second student
+ * @param visitor - the function to call for every mutual friend id. it must not change the students' friends
+ * @param context - passed as is to the visitor
+ * @return the number of mutual friends. 0 if one of the arguments is NULL
+ */
+int studentForEachMutualFriend(Student student1, Student student2, StudentIdVisitor visitor, void* context) {
+    if (student1 == NULL || student2 == NULL) return 0;
+    return intSetForEachCommon(student1->friends, student2->friends, visitor, context);
+}
+
+/**
+ * studentForEachFriendRequest - calls the given visitor for the id of every student who has a pending friend request
+ * to the given student (sorted by id). the ids are not copied. the visitor must not change the student's requests.
+ * @param student - the student to go over his pending friend requests
+ * @param visitor - the function to call for every requesting student id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachFriendRequest(Student student, StudentIdVisitor visitor, void* context) {
+    if (student == NULL || visitor == NULL) return;
+    INT_SET_FOREACH(requesting_id, student->pendingFriendRequests) {
+        visitor(requesting_id, context);
+    }
 }
 
 /**
@@ -239,12 +374,12 @@ Set studentGetStudentFriends(Student student) {
 
 StudentResult addFriendRequest(Student student, Student friend) {
     if (student == NULL || friend == NULL || student->friends == NULL) return STUDENT_NULL_ARGUMENT;
-    if (setIsIn(student->friends, &(friend->id)) || studentCompare(student, friend) == 0) {
+    if (intSetIsIn(student->friends, friend->id) || studentCompare(student, friend) == 0) {
         return STUDENT_ALREADY_FRIEND;
     }
-    SetResult addResult = setAdd(friend->pendingFriendRequests, &(student->id));
-    if (addResult == SET_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    if (addResult == SET_ITEM_ALREADY_EXISTS) return STUDENT_ALREADY_REQUESTED;
+    IntSetResult addResult = intSetAdd(friend->pendingFriendRequests, student->id);
+    if (addResult == INT_SET_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
+    if (addResult == INT_SET_ITEM_ALREADY_EXISTS) return STUDENT_ALREADY_REQUESTED;
     return STUDENT_OK;
 }
 
@@ -257,8 +392,8 @@ StudentResult addFriendRequest(Student student, Student friend) {
  * STUDENT_OK - otherwise (success)
  */
 StudentResult removeFriendRequest(Student student, Student friend) {
-    SetResult removeResult = setRemove(friend->pendingFriendRequests, &(student->id));
-    if (removeResult == SET_ITEM_DOES_NOT_EXIST) return STUDENT_REQUEST_NOT_EXIST;
+    IntSetResult removeResult = intSetRemove(friend->pendingFriendRequests, student->id);
+    if (removeResult == INT_SET_ITEM_DOES_NOT_EXIST) return STUDENT_REQUEST_NOT_EXIST;
     return STUDENT_OK;
 }
 
@@ -270,7 +405,7 @@ StudentResult removeFriendRequest(Student student, Student friend) {
  */
 bool isThereFriendRequest(Student student, Student friend) {
     if (student == NULL || friend == NULL) return false;
-    return (setIsIn(student->pendingFriendRequests, &(friend->id)) || studentCompare(student, friend) == 0);
+    return (intSetIsIn(student->pendingFriendRequests, friend->id) || studentCompare(student, friend) == 0);
 }
 
 /**
@@ -287,9 +422,9 @@ bool isThereFriendRequest(Student student, Student friend) {
 StudentResult addFriend(Student student, Student friend) {
     if (student == NULL || friend == NULL) return STUDENT_NULL_ARGUMENT;
     if (studentCompare(student, friend) == 0) return STUDENT_ALREADY_FRIEND;
-    SetResult result = setAdd(student->friends, &(friend->id));
-    if (result == SET_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    if (result == SET_ITEM_ALREADY_EXISTS) return STUDENT_ALREADY_FRIEND;
+    IntSetResult result = intSetAdd(student->friends, friend->id);
+    if (result == INT_SET_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
+    if (result == INT_SET_ITEM_ALREADY_EXISTS) return STUDENT_ALREADY_FRIEND;
     return STUDENT_OK;
 }
 
@@ -302,7 +437,19 @@ StudentResult addFriend(Student student, Student friend) {
  */
 bool isFriend(Student student, Student friend) {
     if (student == NULL || friend == NULL) return false;
-    return (setIsIn(student->friends, &(friend->id)) || studentCompare(student, friend) == 0);
+    return (intSetIsIn(student->friends, friend->id) || studentCompare(student, friend) == 0);
+}
+
+/**
+ * isFriendById - checks if the student with the given id is in the friends list of student
+ * @param student - the student to check it's friend list
+ * @param friend_id - the id of the student to check if he is in the friends list
+ * @return
+ * true if the student with friend_id is in student's friends list, false otherwise (and for the student's own id)
+ */
+bool isFriendById(Student student, int friend_id) {
+    if (student == NULL) return false;
+    return intSetIsIn(student->friends, friend_id);
 }
 
 /**
@@ -312,8 +459,8 @@ bool isFriend(Student student, Student friend) {
  */
 void removeFriend(Student student1, Student student2) {
     if (student1 == NULL || student2 == NULL) return;
-    setRemove(student1->friends, &(student2->id));
-    setRemove(student2->friends, &(student1->id));
+    intSetRemove(student1->friends, student2->id);
+    intSetRemove(student2->friends, student1->id);
 }
 
 /**
@@ -324,16 +471,76 @@ void removeFriend(Student student1, Student student2) {
  */
 void removeStudentFromFriendsSet(Set set, Student student) {
     if (set == NULL || student == NULL) return;
-    // remove student from all friend lists
+    // remove student from all friend lists and all student's friend requests, in a single pass over the students
     SET_FOREACH(Student, currentStudent, set) {
-        setRemove(currentStudent->friends, &(student->id));
+        intSetRemove(currentStudent->friends, student->id);
+        intSetRemove(currentStudent->pendingFriendRequests, student->id);
     }
-    // remove all student's friend requests
-    SET_FOREACH(Student, currentStudent, set) {
-        setRemove(currentStudent->pendingFriendRequests, &(student->id));
+}
+
+/**
+ * studentForgetStudent - removes the student with the given id from the friends and the pending friend requests of
+ * the given student
+ * @param student - the student to remove the id from
+ * @param id - the id of the student to forget
+ */
+void studentForgetStudent(Student student, int id) {
+    if (student == NULL) return;
+    intSetRemove(student->friends, id);
+    intSetRemove(student->pendingFriendRequests, id);
+}
+
+/**
+ * addEffectiveSheetCourseGradeAndPointsX2 - inner function that adds the effective sheet grade and point (multiple
+ * by 2) of the given course of the given student to the sum of the effective grades and point (given as pointers).
+ * if it is a course sport - add every semester effective grade and points
+ * @param student - the student to calculate it's grades
+ * @param course_id - the id of the course to add it's grades
+ * @param total_effective_course_points_x2 - pointer to the sum of effective points of the courses so far(multiple by 2)
+ * @param sum_effective_course_grades - pointer to the sum of effective grades of the courses so far
+ */
+static void addEffectiveSheetCourseGradeAndPointsX2(Student student, int course_id,
+                                         int* total_effective_course_points_x2, int* sum_effective_course_grades) {
+    if (student == NULL || sum_effective_course_grades == NULL || total_effective_course_points_x2 == NULL) return;
+
+    int course_effective_semester_grades, course_points_x2, course_effective_sheet_grade = 0,course_points_sheet_x2 = 0;
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
+        course_points_x2 = semesterGetCoursePointsX2(current_semester, course_id);
+        course_effective_semester_grades = semesterGetCourseLastGrade(current_semester, course_id);
+        // check if this course was learned at this semester
+        if (course_points_x2 != -1 && course_effective_semester_grades != -1) {
+            // if it is sport course - add to total
+            if (isSportCourseId(course_id)) {
+                *total_effective_course_points_x2 += course_points_x2;
+                *sum_effective_course_grades += (course_points_x2*course_effective_semester_grades);
+            } else { // if it is not a sport course - keep the last semester details
+                course_effective_sheet_grade = course_effective_semester_grades;
+                course_points_sheet_x2 = course_points_x2;
+            }
+        }
+    }
+    // if it is not a sport course - add the course data after checking all semesters
+    if (!isSportCourseId(course_id)) {
+        *total_effective_course_points_x2 += course_points_sheet_x2;
+        *sum_effective_course_grades += (course_points_sheet_x2 * course_effective_sheet_grade);
     }
 }
 
+/**
+ * updateCourseEffectiveTotals - inner function that replaces the effective points and grades the given course had in
+ * the student's effective totals before its grades were changed, with the ones it has now
+ * @param student - the student whose grades were changed
+ * @param course_id - the id of the course of the changed grades
+ * @param old_points_x2 - the effective points of the course before the change (multiple by 2)
+ * @param old_grade_sum_x2 - the sum of the effective grades of the course before the change
+ */
+static void updateCourseEffectiveTotals(Student student, int course_id, int old_points_x2, int old_grade_sum_x2) {
+    student->effective_points_x2 -= old_points_x2;
+    student->effective_grade_sum_x2 -= old_grade_sum_x2;
+    addEffectiveSheetCourseGradeAndPointsX2(student, course_id, &student->effective_points_x2,
+                                            &student->effective_grade_sum_x2);
+}
+
 /**
  * studentAddGrade - adds the given grade to the student's grade sheet, attacked to the given course
  * in the given semester.
@@ -351,37 +558,41 @@ void removeStudentFromFriendsSet(Set set, Student student) {
  */
 StudentResult studentAddGrade(Student student, int semester_number, int course_id, char* points, int grade) {
     if (points == NULL || student == NULL) return STUDENT_NULL_ARGUMENT;
-    Semester semester = getSemesterFromSet(student->semesters, semester_number);
-    int semester_added = 0; // in case we will have to remove it later in case of error
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    addEffectiveSheetCourseGradeAndPointsX2(student, course_id, &old_points_x2, &old_grade_sum_x2);
+    Semester semester = semesterTableGet(student->semesters, semester_number);
+    bool semester_added = false; // in case we will have to remove it later in case of error
     // if the semester do not exist - first create it
     if (semester == NULL) {
-        SemesterResult create_result = semesterCreate(semester_number, &semester);
-        if (create_result == SEMESTER_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-        if (create_result == SEMESTER_INVALID_PARAMETER) return STUDENT_INVALID_PARAMETER;
-        SetResult add_result = setAdd(student->semesters, semester);
-        semesterDestroy(semester);
-        if (add_result == SET_OUT_OF_MEMORY) {
-            return STUDENT_OUT_OF_MEMORY;
-        }
-        semester = getSemesterFromSet(student->semesters, semester_number);
-        semester_added = 1;
+        SemesterTableResult create_result = semesterTableAdd(student->semesters, semester_number, student->courses,
+                                                             &semester);
+        if (create_result == SEMESTER_TABLE_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
+        if (create_result == SEMESTER_TABLE_INVALID_PARAMETER) return STUDENT_INVALID_PARAMETER;
+        semester_added = true;
     }
     SemesterResult add_result = semesterAddGrade(semester, course_id, points, grade);
-    if (add_result == SEMESTER_OUT_OF_MEMORY) {
-        if (semester_added == 1) {
-            setRemove(student->semesters, semester);
-            return STUDENT_OUT_OF_MEMORY;
+    if (add_result == SEMESTER_OUT_OF_MEMORY || add_result == SEMESTER_INVALID_PARAMETER) {
+        if (semester_added) {
+            semesterTableRemove(student->semesters, semester_number);
         }
-        return STUDENT_OUT_OF_MEMORY;
+        return (add_result == SEMESTER_OUT_OF_MEMORY) ? STUDENT_OUT_OF_MEMORY : STUDENT_INVALID_PARAMETER;
     }
-    if (add_result == SEMESTER_INVALID_PARAMETER) {
-        if (semester_added == 1) {
-            setRemove(student->semesters, semester);
-            return STUDENT_INVALID_PARAMETER;
+    CourseBitmapResult bitmap_result = courseBitmapAdd(student->taken_courses, course_id);
+    if (bitmap_result == COURSE_BITMAP_OUT_OF_MEMORY ||
+        courseHistoryAddGrade(student->course_history, course_id, semester_number, grade) != COURSE_HISTORY_OK) {
+        // remove the grade that was just added (and its semester and course, if they were added for it)
+        if (bitmap_result == COURSE_BITMAP_OK) {
+            courseBitmapRemove(student->taken_courses, course_id);
         }
-        return STUDENT_INVALID_PARAMETER;
+        if (semesterRemoveGrade(semester, course_id) == SEMESTER_GOT_EMPTY) {
+            semesterTableRemove(student->semesters, semester_number);
+        }
+        return STUDENT_OUT_OF_MEMORY;
     }
-    // the data is not copied to the set, so do not need to destroy semester
+    updateCourseEffectiveTotals(student, course_id, old_points_x2, old_grade_sum_x2);
+    semesterPrefixesInvalidateFrom(student->progression, semester_number);
+    student->version++;
+    // the semester is owned by the table, so do not need to destroy it
     return STUDENT_OK;
 }
 
@@ -398,14 +609,25 @@ StudentResult studentAddGrade(Student student, int semester_number, int course_i
  */
 StudentResult studentRemoveGrade(Student student, int semester, int course_id) {
     if (student == NULL || student->semesters == NULL) return STUDENT_OUT_OF_MEMORY;
-    Semester grade_semester = getSemesterFromSet(student->semesters, semester);
+    Semester grade_semester = semesterTableGet(student->semesters, semester);
     if (grade_semester == NULL) return STUDENT_COURSE_DOES_NOT_EXIST;
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    addEffectiveSheetCourseGradeAndPointsX2(student, course_id, &old_points_x2, &old_grade_sum_x2);
     SemesterResult remove_result = semesterRemoveGrade(grade_semester, course_id);
     if (remove_result == SEMESTER_COURSE_DOES_NOT_EXIST) return STUDENT_COURSE_DOES_NOT_EXIST;
     if (remove_result == SEMESTER_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
+    courseHistoryRemoveGrade(student->course_history, course_id, semester,
+                             semesterGetCourseLastGrade(grade_semester, course_id),
+                             semesterGetCourseBestGrade(grade_semester, course_id));
     if (remove_result == SEMESTER_GOT_EMPTY) {
-        setRemove(student->semesters, grade_semester);
+        semesterTableRemove(student->semesters, semester);
     }
+    if (courseHistoryContains(student->course_history, course_id) == false) {
+        courseBitmapRemove(student->taken_courses, course_id);
+    }
+    updateCourseEffectiveTotals(student, course_id, old_points_x2, old_grade_sum_x2);
+    semesterPrefixesInvalidateFrom(student->progression, semester);
+    student->version++;
     return STUDENT_OK;
 }
 
@@ -424,98 +646,22 @@ StudentResult studentRemoveGrade(Student student, int semester, int course_id) {
 StudentResult studentUpdateGrade(Student student, int course_id, int new_grade) {
     if (student == NULL || student->semesters == NULL) return STUDENT_OUT_OF_MEMORY;
     // get the last semester the student have grade for this course
-    Semester max_semester = NULL;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
-        if (semesterGetCourseLastGrade(current_semester, course_id) != -1) {
-            max_semester = current_semester;
-        }
-    }
-    if (max_semester == NULL) return STUDENT_COURSE_DOES_NOT_EXIST;
+    int max_semester_number = courseHistoryGetLastSemester(student->course_history, course_id);
+    if (max_semester_number == -1) return STUDENT_COURSE_DOES_NOT_EXIST;
+    Semester max_semester = semesterTableGet(student->semesters, max_semester_number);
+    int old_points_x2 = 0, old_grade_sum_x2 = 0;
+    addEffectiveSheetCourseGradeAndPointsX2(student, course_id, &old_points_x2, &old_grade_sum_x2);
     SemesterResult update_result = semesterUpdateGrade(max_semester, course_id, new_grade);
     if (update_result == SEMESTER_COURSE_DOES_NOT_EXIST) return STUDENT_COURSE_DOES_NOT_EXIST;
     if (update_result == SEMESTER_INVALID_PARAMETER) return STUDENT_INVALID_PARAMETER;
+    courseHistoryUpdateGrades(student->course_history, course_id, max_semester_number, new_grade,
+                              semesterGetCourseBestGrade(max_semester, course_id));
+    updateCourseEffectiveTotals(student, course_id, old_points_x2, old_grade_sum_x2);
+    semesterPrefixesInvalidateFrom(student->progression, max_semester_number);
+    student->version++;
     return STUDENT_OK;
 }
 
-/**
- * studentGetAllCoursesSet - inner function to get a set of the ids of all the courses the student have grades in
- * @param student - the student to get his courses
- * @param set - pointer to the set that will be return
- * @return
- * STUDENT_OUT_OF_MEMORY - if there was a memory error
- * STUDENT_OK - otherwise
- */
-static StudentResult studentGetAllCoursesSet(Student student, Set *set) {
-    if (student == NULL || student->semesters == NULL) return STUDENT_OUT_OF_MEMORY;
-    Set courses = setCreate(copyInt, destroyInt, compareInt);
-    if (courses == NULL) return STUDENT_OUT_OF_MEMORY;
-    Set semester_courses;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
-        SemesterResult semester_courses_result = semesterGetCoursesSet(current_semester, &semester_courses);
-        if (semester_courses_result == SEMESTER_OUT_OF_MEMORY) {
-            setDestroy(courses);
-            return STUDENT_OUT_OF_MEMORY;
-        }
-        SET_FOREACH(int*, current_semester_course, semester_courses) {
-            // try to add the course even if it is already in the set - because if it is, nothing will happened
-            SetResult add_course_result = setAdd(courses, current_semester_course);
-            if (add_course_result == SET_OUT_OF_MEMORY) {
-                setDestroy(courses);
-                setDestroy(semester_courses);
-                return STUDENT_OUT_OF_MEMORY;
-            }
-        }
-        setDestroy(semester_courses);
-    }
-    *set = courses;
-    return STUDENT_OK;
-}
-
-/**
- * isCourseASportCourse - inner function to determine if a course is a sport course
- * @param course_id - the id of the course
- * @return whether this course is a sport course
- */
-static bool isCourseASportCourse(int course_id) {
-    return (course_id >= MIN_SPORT_COURSE_ID && course_id <= MAX_SPORT_COURSE_ID);
-}
-
-/**
- * addEffectiveSheetCourseGradeAndPointsX2 - inner function that adds the effective sheet grade and point (multiple
- * by 2) of the given course of the given student to the sum of the effective grades and point (given as pointers).
- * if it is a course sport - add every semester effective grade and points
- * @param student - the student to calculate it's grades
- * @param course_id - the id of the course to add it's grades
- * @param total_effective_course_points_x2 - pointer to the sum of effective points of the courses so far(multiple by 2)
- * @param sum_effective_course_grades - pointer to the sum of effective grades of the courses so far
- */
-static void addEffectiveSheetCourseGradeAndPointsX2(Student student, int course_id,
-                                         int* total_effective_course_points_x2, int* sum_effective_course_grades) {
-    if (student == NULL || sum_effective_course_grades == NULL || total_effective_course_points_x2 == NULL) return;
-
-    int course_effective_semester_grades, course_points_x2, course_effective_sheet_grade = 0,course_points_sheet_x2 = 0;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
-        course_points_x2 = semesterGetCoursePointsX2(current_semester, course_id);
-        course_effective_semester_grades = semesterGetCourseLastGrade(current_semester, course_id);
-        // check if this course was learned at this semester
-        if (course_points_x2 != -1 && course_effective_semester_grades != -1) {
-            // if it is sport course - add to total
-            if (isCourseASportCourse(course_id)) {
-                *total_effective_course_points_x2 += course_points_x2;
-                *sum_effective_course_grades += (course_points_x2*course_effective_semester_grades);
-            } else { // if it is not a sport course - keep the last semester details
-                course_effective_sheet_grade = course_effective_semester_grades;
-                course_points_sheet_x2 = course_points_x2;
-            }
-        }
-    }
-    // if it is not a sport course - add the course data after checking all semesters
-    if (!isCourseASportCourse(course_id)) {
-        *total_effective_course_points_x2 += course_points_sheet_x2;
-        *sum_effective_course_grades += (course_points_sheet_x2 * course_effective_sheet_grade);
-    }
-}
-
 /**
  * printEffectiveSheetCourseGradeInfo - inner function that prints the effective sheet grade info of the the with the
  * given id. if it is a sport course- print the effective grade info of every semester this course was learned.
@@ -527,13 +673,13 @@ static void printEffectiveSheetCourseGradeInfo(Student student, int course_id, F
     if (student == NULL || output_channel == NULL) return;
 
     int course_effective_semester_grades, course_points_x2, course_effective_sheet_grade = 0,course_points_sheet_x2 = 0;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
         course_points_x2 = semesterGetCoursePointsX2(current_semester, course_id);
         course_effective_semester_grades = semesterGetCourseLastGrade(current_semester, course_id);
         // check if this course was learned at this semester
         if (course_points_x2 != -1 && course_effective_semester_grades != -1) {
             // if it is sport course - print the details of this semester
-            if (isCourseASportCourse(course_id)) {
+            if (isSportCourseId(course_id)) {
                 mtmPrintGradeInfo(output_channel, course_id, course_points_x2, course_effective_semester_grades);
             } else { // if it is not a sport course - keep the last semester details
                 course_effective_sheet_grade = course_effective_semester_grades;
@@ -542,7 +688,7 @@ static void printEffectiveSheetCourseGradeInfo(Student student, int course_id, F
         }
     }
     // if it is not a sport course - print the course data after checking all semesters
-    if (!isCourseASportCourse(course_id)) {
+    if (!isSportCourseId(course_id)) {
         mtmPrintGradeInfo(output_channel, course_id, course_points_sheet_x2, course_effective_sheet_grade);
     }
 }
@@ -557,10 +703,9 @@ static void printEffectiveSheetCourseGradeInfo(Student student, int course_id, F
  */
 static StudentResult studentPrintSummary(Student student, FILE* output_channel) {
     if (student == NULL || student->semesters == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
-    int total_course_points_x2 = 0, total_failed_course_points_x2 = 0, total_effective_course_points_x2 = 0,
-            sum_effective_course_grades = 0;
+    int total_course_points_x2 = 0, total_failed_course_points_x2 = 0;
     int semester_course_points_x2, semester_failed_course_points_x2;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
         semester_course_points_x2 = semesterGetTotalCoursePointsX2(current_semester);
         if (semester_course_points_x2 == -1) return STUDENT_OUT_OF_MEMORY;
         total_course_points_x2 += semester_course_points_x2;
@@ -568,16 +713,8 @@ static StudentResult studentPrintSummary(Student student, FILE* output_channel)
         if (semester_failed_course_points_x2 == -1) return STUDENT_OUT_OF_MEMORY;
         total_failed_course_points_x2 += semester_failed_course_points_x2;
     }
-    Set courses;
-    StudentResult set_create_result = studentGetAllCoursesSet(student, &courses);
-    if (set_create_result == STUDENT_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    SET_FOREACH(int*, current_course_id, courses) {
-        addEffectiveSheetCourseGradeAndPointsX2(student, *current_course_id, &total_effective_course_points_x2,
-                                                      &sum_effective_course_grades);
-    }
-    setDestroy(courses);
     mtmPrintSummary(output_channel, total_course_points_x2, total_failed_course_points_x2,
-                    total_effective_course_points_x2,sum_effective_course_grades);
+                    student->effective_points_x2, student->effective_grade_sum_x2);
     return STUDENT_OK;
 }
 
@@ -591,16 +728,7 @@ static StudentResult studentPrintSummary(Student student, FILE* output_channel)
  */
 static StudentResult studentPrintCleanSummary(Student student, FILE* output_channel) {
     if (student == NULL || student->semesters == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
-    int total_effective_course_points_x2 = 0, sum_effective_course_grades = 0;
-    Set courses;
-    StudentResult set_create_result = studentGetAllCoursesSet(student, &courses);
-    if (set_create_result == STUDENT_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    SET_FOREACH(int*, current_course_id, courses) {
-        addEffectiveSheetCourseGradeAndPointsX2(student, *current_course_id, &total_effective_course_points_x2,
-                                                &sum_effective_course_grades);
-    }
-    setDestroy(courses);
-    mtmPrintCleanSummary(output_channel, total_effective_course_points_x2, sum_effective_course_grades);
+    mtmPrintCleanSummary(output_channel, student->effective_points_x2, student->effective_grade_sum_x2);
     return STUDENT_OK;
 }
 
@@ -614,8 +742,9 @@ static StudentResult studentPrintCleanSummary(Student student, FILE* output_chan
  */
 StudentResult studentPrintFullReport(Student student, FILE* output_channel) {
     if (student == NULL || student->semesters == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
-    mtmPrintStudentInfo(output_channel, student->id, student->firstName, student->lastName);
-    SET_FOREACH(Semester, current_semester, student->semesters) {
+    mtmPrintStudentInfo(output_channel, student->id, nameGetString(student->names.first),
+                        nameGetString(student->names.last));
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
         semesterPrintAllSemesterGrades(current_semester, output_channel);
         SemesterResult print_result = semesterPrintInfo(current_semester, output_channel);
         if (print_result == SEMESTER_OUT_OF_MEMORY || print_result == SEMESTER_NULL_ARGUMENT) {
@@ -638,20 +767,226 @@ StudentResult studentPrintFullReport(Student student, FILE* output_channel) {
  */
 StudentResult studentPrintCleanReport(Student student, FILE* output_channel) {
     if (student == NULL || student->semesters == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
-    mtmPrintStudentInfo(output_channel, student->id, student->firstName, student->lastName);
+    mtmPrintStudentInfo(output_channel, student->id, nameGetString(student->names.first),
+                        nameGetString(student->names.last));
 
-    Set courses;
-    StudentResult set_create_result = studentGetAllCoursesSet(student, &courses);
-    if (set_create_result == STUDENT_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    SET_FOREACH(int*, current_course_id, courses) {
-        printEffectiveSheetCourseGradeInfo(student, *current_course_id, output_channel);
+    COURSE_BITMAP_FOREACH(current_course_id, student->taken_courses) {
+        printEffectiveSheetCourseGradeInfo(student, current_course_id, output_channel);
     }
-    setDestroy(courses);
 
     // print the clean summary and return it's result (memory error or ok)
     return studentPrintCleanSummary(student, output_channel);
 }
 
+#define PROGRESSION_INITIAL_CAPACITY 16
+
+/** The data updateProgression passes to collectLastGrade for every grade of a semester */
+typedef struct progression_step_t {
+    Grade* last_grades; // the last grade of every course in the semester, so far
+    int count;
+    int capacity;
+    bool failed; // whether there was a memory error
+} progression_step_t;
+
+/**
+ * collectLastGrade - inner GradeVisitor that keeps the given grade as the last grade of its course in the semester.
+ * the grades are visited in the order they were added, so a later grade of the course replaces the one before it.
+ * the grades are only collected, since the list of the semester can not be searched while it is gone over
+ * @param grade - the grade to collect
+ * @param context - pointer to the progression_step_t of the semester
+ */
+static void collectLastGrade(Grade grade, void* context) {
+    progression_step_t* step = context;
+    if (step->failed) return;
+    for (int i = 0; i < step->count; i++) {
+        if (getCourseId(step->last_grades[i]) == getCourseId(grade)) {
+            step->last_grades[i] = grade;
+            return;
+        }
+    }
+    if (step->count == step->capacity) {
+        int new_capacity = (step->capacity == 0) ? PROGRESSION_INITIAL_CAPACITY : step->capacity * 2;
+        Grade* new_grades = (Grade*) realloc(step->last_grades, sizeof(Grade) * new_capacity);
+        if (new_grades == NULL) {
+            step->failed = true;
+            return;
+        }
+        step->last_grades = new_grades;
+        step->capacity = new_capacity;
+    }
+    step->last_grades[step->count++] = grade;
+}
+
+/**
+ * addProgressionGrade - inner function that adds the given effective grade of the given semester to the cumulative
+ * totals. for a course that is not a sport course, the grade overrides the effective grade of the course in the
+ * previous semester it was taken in, so that grade is taken out of the totals
+ * @param student - the student of the grade
+ * @param semester_number - the semester of the grade
+ * @param grade - the last grade of its course in the semester
+ * @param points_x2 - pointer to the cumulative effective points until the semester
+ * @param grade_sum_x2 - pointer to the cumulative sum of the effective grades until the semester
+ */
+static void addProgressionGrade(Student student, int semester_number, Grade grade, int* points_x2,
+                                int* grade_sum_x2) {
+    int course_id = getCourseId(grade);
+    *points_x2 += getCoursePointsX2(grade);
+    *grade_sum_x2 += getCoursePointsX2(grade) * getGradeNumber(grade);
+    if (isSportCourseId(course_id)) return;
+    int previous_number = courseHistoryGetPreviousSemester(student->course_history, course_id, semester_number);
+    if (previous_number == -1) return;
+    Semester previous = semesterTableGet(student->semesters, previous_number);
+    int previous_points_x2 = semesterGetCoursePointsX2(previous, course_id);
+    *points_x2 -= previous_points_x2;
+    *grade_sum_x2 -= previous_points_x2 * semesterGetCourseLastGrade(previous, course_id);
+}
+
+/**
+ * updateProgression - inner function that calculates the cumulative totals of the semesters after the last valid
+ * prefix of the student's progression, each from the one before it, so every semester is gone over once
+ * @param student - the student to update his progression
+ * @return false if there was a memory error (the prefixes that were calculated stay valid), true otherwise
+ */
+static bool updateProgression(Student student) {
+    if (student->progression == NULL) {
+        student->progression = semesterPrefixesCreate();
+        if (student->progression == NULL) return false;
+    }
+    int count = semesterPrefixesGetCount(student->progression);
+    int last_number = 0, points_x2 = 0, grade_sum_x2 = 0;
+    if (count > 0) {
+        semesterPrefixesGet(student->progression, count - 1, &last_number, &points_x2, &grade_sum_x2);
+    }
+    progression_step_t step = {NULL, 0, 0, false};
+    for (Semester semester = semesterTableNext(student->semesters, last_number); semester != NULL && !step.failed;
+         semester = semesterTableNext(student->semesters, semesterGetNumber(semester))) {
+        step.count = 0;
+        semesterForEachGrade(semester, collectLastGrade, &step);
+        for (int i = 0; i < step.count; i++) {
+            addProgressionGrade(student, semesterGetNumber(semester), step.last_grades[i], &points_x2, &grade_sum_x2);
+        }
+        if (!step.failed && semesterPrefixesAppend(student->progression, semesterGetNumber(semester), points_x2,
+                                                   grade_sum_x2) != SEMESTER_PREFIXES_OK) {
+            step.failed = true;
+        }
+    }
+    free(step.last_grades);
+    return !step.failed;
+}
+
+/**
+ * studentPrintProgression - prints the cumulative effective points and average of the student after every semester he
+ * has grades in: the effective grades of the clean sheet when only the semesters until it are counted. the totals are
+ * kept between the reports, and only the ones from the first semester that was changed since are calculated again
+ * @param student - the student to print his progression
+ * @param output_channel - the channel to print the progression to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintProgression(Student student, FILE* output_channel) {
+    if (student == NULL || student->semesters == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
+    if (!updateProgression(student)) return STUDENT_OUT_OF_MEMORY;
+    int semester_number, points_x2, grade_sum_x2;
+    for (int i = 0; semesterPrefixesGet(student->progression, i, &semester_number, &points_x2, &grade_sum_x2); i++) {
+        fprintf(output_channel, "After semester %d: points %d.%d, average %.2f\n", semester_number, points_x2 / 2,
+                (points_x2 % 2) * 5, (points_x2 == 0) ? 0.0 : (double)grade_sum_x2 / points_x2);
+    }
+    return STUDENT_OK;
+}
+
+/**
+ * studentRecordVersion - records the current grades of the semester with the given number as a new version of the
+ * student's grade sheet, tagged with the given sequence number (the other semesters are shared with the last version).
+ * meant to be called after every change of the grades. if the last version is missing a change (it was not recorded,
+ * or there was a memory error), the whole sheet is recorded.
+ * @param student - the student whose grades were changed
+ * @param sequence - the sequence number of the command that changed the grades (must not be lower than the sequence
+ * number of the last version)
+ * @param semester_number - the semester of the changed grades
+ * @return
+ * STUDENT_NULL_ARGUMENT - if the student is NULL
+ * STUDENT_INVALID_PARAMETER - if the sequence number is lower than the one of the last version, or the semester number
+ * is not positive
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error (the whole sheet is recorded with the next version)
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentRecordVersion(Student student, int sequence, int semester_number) {
+    if (student == NULL) return STUDENT_NULL_ARGUMENT;
+    if (student->versions == NULL) {
+        student->versions = sheetVersionsCreate();
+        if (student->versions == NULL) return STUDENT_OUT_OF_MEMORY;
+    }
+    SheetVersionsResult record_result;
+    if (student->versions_stale) {
+        record_result = sheetVersionsRecordEmpty(student->versions, sequence);
+        for (Semester semester = semesterTableNext(student->semesters, 0);
+             semester != NULL && record_result == SHEET_VERSIONS_OK;
+             semester = semesterTableNext(student->semesters, semesterGetNumber(semester))) {
+            record_result = sheetVersionsRecordSemester(student->versions, sequence, semesterGetNumber(semester),
+                                                        semester);
+        }
+    } else {
+        record_result = sheetVersionsRecordSemester(student->versions, sequence, semester_number,
+                                                    semesterTableGet(student->semesters, semester_number));
+    }
+    if (record_result == SHEET_VERSIONS_INVALID_PARAMETER) return STUDENT_INVALID_PARAMETER;
+    student->versions_stale = (record_result != SHEET_VERSIONS_OK);
+    return (record_result == SHEET_VERSIONS_OK) ? STUDENT_OK : STUDENT_OUT_OF_MEMORY;
+}
+
+/**
+ * studentPrintReportAsOf - inner function that prints the full or the clean report of the student, as his grade sheet
+ * was after the command with the given sequence number, from the recorded versions of the sheet
+ * @param student - the student to print his report
+ * @param sequence - the sequence number of the command
+ * @param full - true to print the full report, false to print the clean report
+ * @param output_channel - the channel to print the report to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+static StudentResult studentPrintReportAsOf(Student student, int sequence, bool full, FILE* output_channel) {
+    if (student == NULL || output_channel == NULL) return STUDENT_OUT_OF_MEMORY;
+    if (student->versions == NULL) { // no version was recorded, so the sheet was always empty
+        student->versions = sheetVersionsCreate();
+        if (student->versions == NULL) return STUDENT_OUT_OF_MEMORY;
+    }
+    mtmPrintStudentInfo(output_channel, student->id, nameGetString(student->names.first),
+                        nameGetString(student->names.last));
+    SheetVersionsResult print_result = full ? sheetVersionsPrintFull(student->versions, sequence, output_channel) :
+                                       sheetVersionsPrintClean(student->versions, sequence, output_channel);
+    return (print_result == SHEET_VERSIONS_OK) ? STUDENT_OK : STUDENT_OUT_OF_MEMORY;
+}
+
+/**
+ * studentPrintFullReportAsOf - prints the full grades report of the student as his grade sheet was after the command
+ * with the given sequence number, from the recorded versions of the sheet (the changes are not replayed)
+ * @param student - the student to print his report
+ * @param sequence - the sequence number of the command
+ * @param output_channel - the channel to print the report to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintFullReportAsOf(Student student, int sequence, FILE* output_channel) {
+    return studentPrintReportAsOf(student, sequence, true, output_channel);
+}
+
+/**
+ * studentPrintCleanReportAsOf - prints the clean grades report of the student as his grade sheet was after the
+ * command with the given sequence number, from the recorded versions of the sheet (the changes are not replayed)
+ * @param student - the student to print his report
+ * @param sequence - the sequence number of the command
+ * @param output_channel - the channel to print the report to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintCleanReportAsOf(Student student, int sequence, FILE* output_channel) {
+    return studentPrintReportAsOf(student, sequence, false, output_channel);
+}
+
 /**
  * insertGradeIntoArrayIfHigher - checks if the given grade if higher than at least one of the grades inside the array.
  * if it is - insert it to the array, sorted.
@@ -725,12 +1060,12 @@ static void insertGradeIntoArrayIfLower(Grade** array, int length, Grade *grade)
 static void insertCourseGradeIntoArrayIfFit(Student student, int course_id, Grade** array, int length, bool best) {
     if (array == NULL || student == NULL) return;
     Grade course_semester_effective_grade, course_effective_grade;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
         course_effective_grade = semesterGetCourseLastGradeObject(current_semester, course_id);
         // check if this course was learned at this semester
         if (course_effective_grade != NULL) {
             // if it is sport course - insert the details of this semester into the array
-            if (isCourseASportCourse(course_id)) {
+            if (isSportCourseId(course_id)) {
                 course_effective_grade = semesterGetCourseLastGradeObject(current_semester, course_id);
                 if (best) {
                     insertGradeIntoArrayIfHigher(array, length, &course_effective_grade);
@@ -743,7 +1078,7 @@ static void insertCourseGradeIntoArrayIfFit(Student student, int course_id, Grad
         }
     }
     // if it is not a sport course - insert the course data after checking all semesters
-    if (!isCourseASportCourse(course_id)) {
+    if (!isSportCourseId(course_id)) {
         if (best) {
             insertGradeIntoArrayIfHigher(array, length, &course_semester_effective_grade);
         } else {
@@ -797,14 +1132,10 @@ StudentResult studentPrintBestOrWorstGrades(Student student, int amount, bool be
         }
         *(best_grades[i]) = NULL;
     }
-    Set courses;
-    StudentResult set_create_result = studentGetAllCoursesSet(student, &courses);
-    if (set_create_result == STUDENT_OUT_OF_MEMORY) return STUDENT_OUT_OF_MEMORY;
-    SET_FOREACH(int*, current_course_id, courses) {
-        insertCourseGradeIntoArrayIfFit(student, *current_course_id, best_grades, amount, best);
+    COURSE_BITMAP_FOREACH(current_course_id, student->taken_courses) {
+        insertCourseGradeIntoArrayIfFit(student, current_course_id, best_grades, amount, best);
     }
     studentPrintGradesArray(best_grades, amount, output_channel);
-    setDestroy(courses);
     for (int i =0; i < amount; i ++) {
         free(best_grades[i]);
     }
@@ -822,14 +1153,186 @@ StudentResult studentPrintBestOrWorstGrades(Student student, int amount, bool be
  */
 int studentGetBestGradeInCourse(Student student, int course_id) {
     if (student == NULL) return -1;
-    int best_grade = -1, best_semester_grade;
-    SET_FOREACH(Semester, current_semester, student->semesters) {
-        best_semester_grade = semesterGetCourseBestGrade(current_semester, course_id);
-        if (best_semester_grade > best_grade) {
-            best_grade = best_semester_grade;
+    return courseHistoryGetBestGrade(student->course_history, course_id);
+}
+
+/**
+ * studentForEachCourse - calls the given visitor for the id of every course the student has grades in (sorted by id).
+ * the visitor must not change the student's grades.
+ * @param student - the student to go over his courses
+ * @param visitor - the function to call for every course id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachCourse(Student student, CourseIdVisitor visitor, void* context) {
+    if (student == NULL || visitor == NULL) return;
+    COURSE_BITMAP_FOREACH(course_id, student->taken_courses) {
+        visitor(course_id, context);
+    }
+}
+
+/**
+ * studentGetLastGradeObject - returns the last grade inserted for the course with the given id in the given semester
+ * of the student (the grade studentRemoveGrade would remove)
+ * @param student - the student to search his grade
+ * @param semester - the semester of the grade
+ * @param course_id - the id of the course of the grade
+ * @return the grade, owned by the student. NULL if there is no such grade (or the student is NULL)
+ */
+Grade studentGetLastGradeObject(Student student, int semester, int course_id) {
+    if (student == NULL) return NULL;
+    return semesterGetCourseLastGradeObject(semesterTableGet(student->semesters, semester), course_id);
+}
+
+/**
+ * studentGetCourseLastSemester - returns the last semester the student has grades in the course with the given id
+ * (the semester of the grade studentUpdateGrade updates)
+ * @param student - the student to search in
+ * @param course_id - the id of the course
+ * @return the semester number. -1 if the student has no grades in the course (or the student is NULL)
+ */
+int studentGetCourseLastSemester(Student student, int course_id) {
+    if (student == NULL) return -1;
+    return courseHistoryGetLastSemester(student->course_history, course_id);
+}
+
+/**
+ * studentForEachGrade - calls the given visitor for every grade of the student, semester after semester.
+ * the visitor must not add or remove grades of the student.
+ * @param student - the student to go over his grades
+ * @param visitor - the function to call for every grade
+ * @param context - passed as is to the visitor
+ */
+void studentForEachGrade(Student student, GradeVisitor visitor, void* context) {
+    if (student == NULL || visitor == NULL) return;
+    SEMESTER_TABLE_FOREACH(current_semester, student->semesters) {
+        semesterForEachGrade(current_semester, visitor, context);
+    }
+}
+
+/**
+ * studentGetEffectiveGrade - returns the effective grade of the course with the given id that a grade in the given
+ * semester counts in: for a sport course - the last grade of the course in the given semester (every semester of a
+ * sport course counts), and for any other course - the last grade in the last semester the course was taken in (the
+ * given semester is ignored)
+ * @param student - the student to search his grade
+ * @param course_id - the id of the course
+ * @param semester - the semester (only matters for sport courses)
+ * @return the effective grade. -1 if there is none (or the student is NULL)
+ */
+int studentGetEffectiveGrade(Student student, int course_id, int semester) {
+    if (student == NULL) return -1;
+    if (!isSportCourseId(course_id)) {
+        semester = courseHistoryGetLastSemester(student->course_history, course_id);
+    }
+    return courseHistoryGetLastGrade(student->course_history, course_id, semester);
+}
+
+/** The data studentForEachEffectiveGrade passes to visitEffectiveSemester for every semester of every course */
+typedef struct effective_grades_visit_t {
+    CourseHistory course_history;
+    EffectiveGradeVisitor visitor;
+    void* context;
+} effective_grades_visit_t;
+
+/**
+ * visitEffectiveSemester - inner CourseSemesterVisitor that calls the visitor of the visit for the last grade of the
+ * course in the semester, if it is an effective grade
+ * @param course_id - the id of the course
+ * @param semester_number - the semester
+ * @param last_grade - the last grade of the course in the semester
+ * @param context - pointer to the effective_grades_visit_t of the visit
+ */
+static void visitEffectiveSemester(int course_id, int semester_number, int last_grade, void* context) {
+    effective_grades_visit_t* visit = context;
+    if (isSportCourseId(course_id) ||
+        courseHistoryGetLastSemester(visit->course_history, course_id) == semester_number) {
+        visit->visitor(course_id, last_grade, visit->context);
+    }
+}
+
+/**
+ * studentForEachEffectiveGrade - calls the given visitor for every effective grade of the student (the grades of his
+ * clean sheet): the last grade of every course in the last semester it was taken in, and for sport courses - the last
+ * grade of the course in every semester it was taken in
+ * @param student - the student to go over his effective grades
+ * @param visitor - the function to call for every effective grade
+ * @param context - passed as is to the visitor
+ */
+void studentForEachEffectiveGrade(Student student, EffectiveGradeVisitor visitor, void* context) {
+    if (student == NULL || visitor == NULL) return;
+    effective_grades_visit_t visit = {student->course_history, visitor, context};
+    courseHistoryForEachSemester(student->course_history, visitEffectiveSemester, &visit);
+}
+
+/**
+ * studentGetEffectiveTotals - returns the totals of the student's clean sheet, that his effective average is
+ * calculated from. the totals are kept up to date with every change of the grades, so nothing is gone over
+ * @param student - the student to get his totals
+ * @param points_x2 - pointer to save the effective points of the student to (multiple by 2)
+ * @param grade_sum_x2 - pointer to save the sum of the effective grades to, each multiple by its points (multiple by 2)
+ */
+void studentGetEffectiveTotals(Student student, int* points_x2, int* grade_sum_x2) {
+    if (student == NULL || points_x2 == NULL || grade_sum_x2 == NULL) return;
+    *points_x2 = student->effective_points_x2;
+    *grade_sum_x2 = student->effective_grade_sum_x2;
+}
+
+/**
+ * studentGetVersion - returns the version of the student's grades. the version is advanced by every change of the
+ * grades (and kept by a copy of the student), so anything computed from the grades of an older version is stale
+ * @param student - the student to get his version
+ * @return the version of the grades. 0 if the student is NULL
+ */
+unsigned int studentGetVersion(Student student) {
+    if (student == NULL) return 0;
+    return student->version;
+}
+
+/**
+ * studentGetWhatIfTotals - returns the totals the student's clean sheet would have if he got the grades of the given
+ * scenario in a new semester, after all his semesters. the changes are applied as a delta on the effective totals the
+ * student keeps, so only the courses of the scenario are searched and the student is not changed
+ * @param student - the student to evaluate the scenario for
+ * @param scenario - the hypothetical grades
+ * @param points_x2 - pointer to save the effective points of the scenario to (multiple by 2)
+ * @param grade_sum_x2 - pointer to save the sum of the effective grades of the scenario to, each multiple by its points
+ * (multiple by 2)
+ * @return
+ * STUDENT_NULL_ARGUMENT - if one of the arguments is NULL
+ * STUDENT_INVALID_PARAMETER - if a change with invalid parameters was added to the scenario
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentGetWhatIfTotals(Student student, WhatIf scenario, int* points_x2, int* grade_sum_x2) {
+    if (student == NULL || scenario == NULL || points_x2 == NULL || grade_sum_x2 == NULL) return STUDENT_NULL_ARGUMENT;
+    if (!whatIfIsValid(scenario)) return STUDENT_INVALID_PARAMETER;
+    *points_x2 = student->effective_points_x2;
+    *grade_sum_x2 = student->effective_grade_sum_x2;
+    int course_id, course_points_x2, grade;
+    for (int i = 0; whatIfGetChange(scenario, i, &course_id, &course_points_x2, &grade); i++) {
+        // the new semester is after all the others, so its grade replaces the effective grade of a course that is
+        // not a sport course (every semester of a sport course counts)
+        int last_semester = courseHistoryGetLastSemester(student->course_history, course_id);
+        if (!isSportCourseId(course_id) && last_semester != -1) {
+            int old_points_x2 = semesterGetCoursePointsX2(semesterTableGet(student->semesters, last_semester),
+                                                          course_id);
+            *points_x2 -= old_points_x2;
+            *grade_sum_x2 -= old_points_x2 * courseHistoryGetLastGrade(student->course_history, course_id,
+                                                                       last_semester);
         }
+        *points_x2 += course_points_x2;
+        *grade_sum_x2 += course_points_x2 * grade;
     }
-    return best_grade;
+    return STUDENT_OK;
+}
+
+/**
+ * studentGetId - returns the id of the student
+ * @param student - the student to get his id
+ * @return the id of the student. -1 if the student is NULL
+ */
+int studentGetId(Student student) {
+    if (student == NULL) return -1;
+    return student->id;
 }
 
 /**
@@ -839,7 +1342,48 @@ int studentGetBestGradeInCourse(Student student, int course_id) {
  */
 void studentPrintName(Student student, FILE* output_channel) {
     if (student == NULL || output_channel == NULL) return;
-    mtmPrintStudentName(output_channel, student->firstName, student->lastName);
+    mtmPrintStudentName(output_channel, nameGetString(student->names.first), nameGetString(student->names.last));
+}
+
+/**
+ * studentRelease - deallocates a bounded part of the grades of the student: its versions, then the grades of its
+ * semesters, and then its courses. meant for a removed student that is only destroyed afterwards (its grades are not
+ * consistent until it is fully released), so destroying a student with a long history can be spread over many calls.
+ * every version costs one unit and one more for every semester it held, and every grade and every course cost one unit.
+ * @param student - the student to release
+ * @param budget - pointer to the work that may be done. at least one step is done if it is positive, so it may end
+ * below zero. it is updated with the budget left
+ * @param visitor - called with the id of every course the student is released from (may be NULL). the course is no
+ * longer one of the student's courses when it is called
+ * @param context - passed as is to the visitor
+ * @return true if the student is fully released (and destroying it takes constant time), false otherwise
+ */
+bool studentRelease(Student student, int* budget, CourseIdVisitor visitor, void* context) {
+    if (student == NULL || budget == NULL) return true;
+    while (*budget > 0) {
+        int semester_count = sheetVersionsReleaseLast(student->versions);
+        if (semester_count == -1) break;
+        *budget -= semester_count + 1;
+    }
+    while (*budget > 0) {
+        Semester semester = semesterTableNext(student->semesters, 0);
+        if (semester == NULL) break;
+        *budget -= semesterReleaseGrades(semester, *budget);
+        if (*budget > 0) {
+            semesterTableRemove(student->semesters, semesterGetNumber(semester)); // the semester has no grades left
+            (*budget)--;
+        }
+    }
+    while (*budget > 0) {
+        int course_id = courseHistoryRemoveLastCourse(student->course_history);
+        if (course_id == -1) return true;
+        courseBitmapRemove(student->taken_courses, course_id);
+        if (visitor != NULL) {
+            visitor(course_id, context);
+        }
+        (*budget)--;
+    }
+    return false;
 }
 
 /**
@@ -850,10 +1394,14 @@ void studentPrintName(Student student, FILE* output_channel) {
  */
 void studentDestroy(SetElement student) {
     if (student == NULL) return;
-    free(((Student)student)->firstName);
-    free(((Student)student)->lastName);
-    setDestroy(((Student)student)->friends);
-    setDestroy(((Student)student)->pendingFriendRequests);
-    setDestroy(((Student)student)->semesters);
+    nameRelease(((Student)student)->names.first);
+    nameRelease(((Student)student)->names.last);
+    intSetDestroy(((Student)student)->friends);
+    intSetDestroy(((Student)student)->pendingFriendRequests);
+    semesterTableDestroy(((Student)student)->semesters);
+    courseBitmapDestroy(((Student)student)->taken_courses);
+    courseHistoryDestroy(((Student)student)->course_history);
+    semesterPrefixesDestroy(((Student)student)->progression);
+    sheetVersionsDestroy(((Student)student)->versions);
     free((Student)student);
 }
\ No newline at end of file
@@ -3,9 +3,22 @@
 
 #include "set.h"
 #include "mtm_ex3.h"
+#include "name_pool.h"
+#include "course_catalog.h"
+#include "grade.h"
+#include "what_if.h"
 
 typedef struct student_t *Student;
 
+/** Type of the function called by studentForEachFriend/studentForEachFriendRequest for every student id */
+typedef void (*StudentIdVisitor)(int id, void* context);
+
+/** Type of the function called by studentForEachCourse for every course id */
+typedef void (*CourseIdVisitor)(int course_id, void* context);
+
+/** Type of function that is called on every effective grade of a student, with the id of its course */
+typedef void (*EffectiveGradeVisitor)(int course_id, int grade, void* context);
+
 /** Type used for returning error codes from functions */
 typedef enum StudentResult_t {
     STUDENT_OK,
@@ -20,6 +33,7 @@ typedef enum StudentResult_t {
 
 /**
  * studentCreate: creates new student (and allocates memory for all it's details).
+ * the names of the student are not shared with other students.
  * @param id - the id of the student
  * @param firstName - the student's first name. the data is copied from the pointer
  * @param lastName - the student's last name. the data is copied from the pointer
@@ -33,7 +47,25 @@ typedef enum StudentResult_t {
 StudentResult studentCreate(int id, char* firstName, char* lastName, Student *student);
 
 /**
- * studentCopy: Creates a copy of target student.
+ * studentCreateWithSharedData: creates new student, whose names are interned in the given name pool, and
+ * whose grades take their courses from the given catalog.
+ * @param id - the id of the student
+ * @param firstName - the student's first name. the data is copied from the pointer (if it is not in the pool yet)
+ * @param lastName - the student's last name. the data is copied from the pointer (if it is not in the pool yet)
+ * @param names - the pool to intern the names in. if NULL, the names are not shared with other students
+ * @param courses - the catalog of the courses. if NULL, the courses of the grades are not shared with other grades
+ * @param student - pointer to the student object which the new student will be saved to
+ * @return
+ * STUDENT_NULL_ARGUMENT - if one of the argument is Null
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_INVALID_PARAMETER - if the id entered is invalid (number is higher than 999999999 or negative)
+ * STUDENT_OK - otherwise
+*/
+StudentResult studentCreateWithSharedData(int id, char* firstName, char* lastName, NamePool names,
+                                          CourseCatalog courses, Student *student);
+
+/**
+ * studentCopy: Creates a copy of target student. the copy shares the names of the target student.
  *
  * @param student - Target student.
  * @return
@@ -73,6 +105,35 @@ Student getStudentFromSet(Set set, int id);
  */
 Set studentGetStudentFriends(Student student);
 
+/**
+ * studentForEachFriend - calls the given visitor for the id of every friend of the student (sorted by id).
+ * unlike studentGetStudentFriends, the ids are not copied. the visitor must not change the student's friends.
+ * @param student - the student to go over his friends
+ * @param visitor - the function to call for every friend id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachFriend(Student student, StudentIdVisitor visitor, void* context);
+
+/**
+ * studentForEachMutualFriend - calls the given visitor for the id of every student who is a friend of both students
+ * (sorted by id). the friends lists are intersected in place, without copying them.
+ * @param student1 - the first student
+ * @param student2 - the second student
+ * @param visitor - the function to call for every mutual friend id. it must not change the students' friends
+ * @param context - passed as is to the visitor
+ * @return the number of mutual friends. 0 if one of the arguments is NULL
+ */
+int studentForEachMutualFriend(Student student1, Student student2, StudentIdVisitor visitor, void* context);
+
+/**
+ * studentForEachFriendRequest - calls the given visitor for the id of every student who has a pending friend request
+ * to the given student (sorted by id). the ids are not copied. the visitor must not change the student's requests.
+ * @param student - the student to go over his pending friend requests
+ * @param visitor - the function to call for every requesting student id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachFriendRequest(Student student, StudentIdVisitor visitor, void* context);
+
 /**
  * addFriendRequest - add friend request from student to friend
  * @param student - the student who send the request
@@ -126,6 +187,15 @@ StudentResult addFriend(Student student, Student friend);
  */
 bool isFriend(Student student, Student friend);
 
+/**
+ * isFriendById - checks if the student with the given id is in the friends list of student
+ * @param student - the student to check it's friend list
+ * @param friend_id - the id of the student to check if he is in the friends list
+ * @return
+ * true if the student with friend_id is in student's friends list, false otherwise (and for the student's own id)
+ */
+bool isFriendById(Student student, int friend_id);
+
 /**
  * removeFriend - remove student1 from student2's friends list and vise versa.
  * @param student1 - the first student
@@ -134,7 +204,7 @@ bool isFriend(Student student, Student friend);
 void removeFriend(Student student1, Student student2);
 
 ///////////////////////////////////////////////////////////////////
-// functions to use for Set of ints (students' ids)
+// functions to use for Set of ints (courses' ids)
 ///////////////////////////////////////////////////////////////////
 /**
  * copyInt - copies int
@@ -167,6 +237,14 @@ void destroyInt(SetElement element);
  */
 void removeStudentFromFriendsSet(Set set, Student student);
 
+/**
+ * studentForgetStudent - removes the student with the given id from the friends and the pending friend requests of
+ * the given student
+ * @param student - the student to remove the id from
+ * @param id - the id of the student to forget
+ */
+void studentForgetStudent(Student student, int id);
+
 /**
  * studentAddGrade - adds the given grade to the student's grade sheet, attacked to the given course
  * in the given semester.
@@ -232,6 +310,59 @@ StudentResult studentPrintFullReport(Student student, FILE* output_channel);
  */
 StudentResult studentPrintCleanReport(Student student, FILE* output_channel);
 
+/**
+ * studentPrintProgression - prints the cumulative effective points and average of the student after every semester he
+ * has grades in: the effective grades of the clean sheet when only the semesters until it are counted
+ * @param student - the student to print his progression
+ * @param output_channel - the channel to print the progression to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintProgression(Student student, FILE* output_channel);
+
+/**
+ * studentRecordVersion - records the current grades of the semester with the given number as a new version of the
+ * student's grade sheet, tagged with the given sequence number (the other semesters are shared with the last version).
+ * meant to be called after every change of the grades. if the last version is missing a change (it was not recorded,
+ * or there was a memory error), the whole sheet is recorded.
+ * @param student - the student whose grades were changed
+ * @param sequence - the sequence number of the command that changed the grades (must not be lower than the sequence
+ * number of the last version)
+ * @param semester_number - the semester of the changed grades
+ * @return
+ * STUDENT_NULL_ARGUMENT - if the student is NULL
+ * STUDENT_INVALID_PARAMETER - if the sequence number is lower than the one of the last version, or the semester number
+ * is not positive
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error (the whole sheet is recorded with the next version)
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentRecordVersion(Student student, int sequence, int semester_number);
+
+/**
+ * studentPrintFullReportAsOf - prints the full grades report of the student as his grade sheet was after the command
+ * with the given sequence number, from the recorded versions of the sheet (the changes are not replayed)
+ * @param student - the student to print his report
+ * @param sequence - the sequence number of the command
+ * @param output_channel - the channel to print the report to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintFullReportAsOf(Student student, int sequence, FILE* output_channel);
+
+/**
+ * studentPrintCleanReportAsOf - prints the clean grades report of the student as his grade sheet was after the
+ * command with the given sequence number, from the recorded versions of the sheet (the changes are not replayed)
+ * @param student - the student to print his report
+ * @param sequence - the sequence number of the command
+ * @param output_channel - the channel to print the report to
+ * @return
+ * STUDENT_OUT_OF_MEMORY - if there was a memory error
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentPrintCleanReportAsOf(Student student, int sequence, FILE* output_channel);
+
 /**
  * studentPrintBestOrWorstGrades - prints the best/worst (according to the parameter given) effective sheet grades of
  * the given student. the amount of grades printed is given (must be positive number)
@@ -256,6 +387,105 @@ StudentResult studentPrintBestOrWorstGrades(Student student, int amount, bool be
  */
 int studentGetBestGradeInCourse(Student student, int course_id);
 
+/**
+ * studentForEachCourse - calls the given visitor for the id of every course the student has grades in (sorted by id).
+ * the visitor must not change the student's grades.
+ * @param student - the student to go over his courses
+ * @param visitor - the function to call for every course id
+ * @param context - passed as is to the visitor
+ */
+void studentForEachCourse(Student student, CourseIdVisitor visitor, void* context);
+
+/**
+ * studentGetLastGradeObject - returns the last grade inserted for the course with the given id in the given semester
+ * of the student (the grade studentRemoveGrade would remove)
+ * @param student - the student to search his grade
+ * @param semester - the semester of the grade
+ * @param course_id - the id of the course of the grade
+ * @return the grade, owned by the student. NULL if there is no such grade (or the student is NULL)
+ */
+Grade studentGetLastGradeObject(Student student, int semester, int course_id);
+
+/**
+ * studentGetCourseLastSemester - returns the last semester the student has grades in the course with the given id
+ * (the semester of the grade studentUpdateGrade updates)
+ * @param student - the student to search in
+ * @param course_id - the id of the course
+ * @return the semester number. -1 if the student has no grades in the course (or the student is NULL)
+ */
+int studentGetCourseLastSemester(Student student, int course_id);
+
+/**
+ * studentForEachGrade - calls the given visitor for every grade of the student, semester after semester.
+ * the visitor must not add or remove grades of the student.
+ * @param student - the student to go over his grades
+ * @param visitor - the function to call for every grade
+ * @param context - passed as is to the visitor
+ */
+void studentForEachGrade(Student student, GradeVisitor visitor, void* context);
+
+/**
+ * studentGetEffectiveGrade - returns the effective grade of the course with the given id that a grade in the given
+ * semester counts in: for a sport course - the last grade of the course in the given semester (every semester of a
+ * sport course counts), and for any other course - the last grade in the last semester the course was taken in (the
+ * given semester is ignored)
+ * @param student - the student to search his grade
+ * @param course_id - the id of the course
+ * @param semester - the semester (only matters for sport courses)
+ * @return the effective grade. -1 if there is none (or the student is NULL)
+ */
+int studentGetEffectiveGrade(Student student, int course_id, int semester);
+
+/**
+ * studentForEachEffectiveGrade - calls the given visitor for every effective grade of the student (the grades of his
+ * clean sheet): the last grade of every course in the last semester it was taken in, and for sport courses - the last
+ * grade of the course in every semester it was taken in
+ * @param student - the student to go over his effective grades
+ * @param visitor - the function to call for every effective grade
+ * @param context - passed as is to the visitor
+ */
+void studentForEachEffectiveGrade(Student student, EffectiveGradeVisitor visitor, void* context);
+
+/**
+ * studentGetEffectiveTotals - returns the totals of the student's clean sheet, that his effective average is
+ * calculated from. the totals are kept up to date with every change of the grades, so nothing is gone over
+ * @param student - the student to get his totals
+ * @param points_x2 - pointer to save the effective points of the student to (multiple by 2)
+ * @param grade_sum_x2 - pointer to save the sum of the effective grades to, each multiple by its points (multiple by 2)
+ */
+void studentGetEffectiveTotals(Student student, int* points_x2, int* grade_sum_x2);
+
+/**
+ * studentGetVersion - returns the version of the student's grades. the version is advanced by every change of the
+ * grades (and kept by a copy of the student), so anything computed from the grades of an older version is stale
+ * @param student - the student to get his version
+ * @return the version of the grades. 0 if the student is NULL
+ */
+unsigned int studentGetVersion(Student student);
+
+/**
+ * studentGetWhatIfTotals - returns the totals the student's clean sheet would have if he got the grades of the given
+ * scenario in a new semester, after all his semesters. the changes are applied as a delta on the effective totals the
+ * student keeps, so only the courses of the scenario are searched and the student is not changed
+ * @param student - the student to evaluate the scenario for
+ * @param scenario - the hypothetical grades
+ * @param points_x2 - pointer to save the effective points of the scenario to (multiple by 2)
+ * @param grade_sum_x2 - pointer to save the sum of the effective grades of the scenario to, each multiple by its points
+ * (multiple by 2)
+ * @return
+ * STUDENT_NULL_ARGUMENT - if one of the arguments is NULL
+ * STUDENT_INVALID_PARAMETER - if a change with invalid parameters was added to the scenario
+ * STUDENT_OK - otherwise
+ */
+StudentResult studentGetWhatIfTotals(Student student, WhatIf scenario, int* points_x2, int* grade_sum_x2);
+
+/**
+ * studentGetId - returns the id of the student
+ * @param student - the student to get his id
+ * @return the id of the student. -1 if the student is NULL
+ */
+int studentGetId(Student student);
+
 /**
  * studentPrintName - prints the name of the student
  * @param student - the student to print his name
@@ -263,6 +493,21 @@ int studentGetBestGradeInCourse(Student student, int course_id);
  */
 void studentPrintName(Student student, FILE* output_channel);
 
+/**
+ * studentRelease - deallocates a bounded part of the grades of the student: its versions, then the grades of its
+ * semesters, and then its courses. meant for a removed student that is only destroyed afterwards (its grades are not
+ * consistent until it is fully released), so destroying a student with a long history can be spread over many calls.
+ * every version costs one unit and one more for every semester it held, and every grade and every course cost one unit.
+ * @param student - the student to release
+ * @param budget - pointer to the work that may be done. at least one step is done if it is positive, so it may end
+ * below zero. it is updated with the budget left
+ * @param visitor - called with the id of every course the student is released from (may be NULL). the course is no
+ * longer one of the student's courses when it is called
+ * @param context - passed as is to the visitor
+ * @return true if the student is fully released (and destroying it takes constant time), false otherwise
+ */
+bool studentRelease(Student student, int* budget, CourseIdVisitor visitor, void* context);
+
 /**
  * studentDestroy - deallocate all the data of the student
  *
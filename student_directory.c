@@ -0,0 +1,227 @@
+#include "student_directory.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STUDENT_DIRECTORY_INITIAL_BUCKETS 64
+
+typedef struct directory_entry_t {
+    Student student; // NULL if the bucket is empty
+    int id;
+    int slot;
+} directory_entry_t;
+
+typedef struct student_directory_t {
+    directory_entry_t* buckets; // open addressing with linear probing
+    int buckets_count; // always a power of 2, and at least twice the size
+    int size;
+    int* free_slots; // the slots of removed students, ready for reuse
+    int free_slots_count;
+    int slot_count; // the number of slots that were given to students so far
+    Student* slot_students; // the student of every slot (NULL for a free slot)
+    int slot_capacity; // the capacity of free_slots and slot_students, never lower than slot_count
+} student_directory_t;
+
+/**
+ * hashId - spreads the bits of the id, so near ids do not fall into near buckets
+ */
+static uint32_t hashId(int id) {
+    uint32_t hash = (uint32_t)id;
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3bu;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+/**
+ * findBucket - returns the index of the bucket of the given id, or of the empty bucket it should be put in
+ */
+static int findBucket(directory_entry_t* buckets, int buckets_count, int id) {
+    int index = hashId(id) & (buckets_count - 1);
+    while (buckets[index].student != NULL && buckets[index].id != id) {
+        index = (index + 1) & (buckets_count - 1);
+    }
+    return index;
+}
+
+/**
+ * studentDirectoryGrow - doubles the number of buckets of the directory, and moves the entries to their new buckets
+ * @return false if there was a memory error (the directory is not changed), true otherwise
+ */
+static bool studentDirectoryGrow(StudentDirectory directory) {
+    int new_buckets_count = directory->buckets_count * 2;
+    directory_entry_t* new_buckets = (directory_entry_t*) calloc(new_buckets_count, sizeof(*new_buckets));
+    if (new_buckets == NULL) return false;
+    for (int i = 0; i < directory->buckets_count; i++) {
+        if (directory->buckets[i].student == NULL) continue;
+        new_buckets[findBucket(new_buckets, new_buckets_count, directory->buckets[i].id)] = directory->buckets[i];
+    }
+    free(directory->buckets);
+    directory->buckets = new_buckets;
+    directory->buckets_count = new_buckets_count;
+    return true;
+}
+
+/**
+ * studentDirectoryCreate - creates a new empty directory
+ * @return
+ * NULL - if allocations failed.
+ * A new StudentDirectory in case of success.
+ */
+StudentDirectory studentDirectoryCreate() {
+    StudentDirectory directory = (StudentDirectory) malloc(sizeof(*directory));
+    if (directory == NULL) return NULL;
+    directory->buckets = (directory_entry_t*) calloc(STUDENT_DIRECTORY_INITIAL_BUCKETS, sizeof(directory_entry_t));
+    if (directory->buckets == NULL) {
+        free(directory);
+        return NULL;
+    }
+    directory->buckets_count = STUDENT_DIRECTORY_INITIAL_BUCKETS;
+    directory->size = 0;
+    directory->free_slots = NULL;
+    directory->slot_students = NULL;
+    directory->free_slots_count = 0;
+    directory->slot_count = 0;
+    directory->slot_capacity = 0;
+    return directory;
+}
+
+/**
+ * studentDirectoryAdd - adds the given student to the directory, by his id
+ * @param directory - the directory to add the student to
+ * @param student - the student to add. the directory keeps the pointer, so the student must stay alive until it is
+ * removed from the directory
+ * @return
+ * STUDENT_DIRECTORY_NULL_ARGUMENT - if one of the arguments is NULL
+ * STUDENT_DIRECTORY_STUDENT_ALREADY_EXISTS - if there is already a student with the same id in the directory
+ * STUDENT_DIRECTORY_OUT_OF_MEMORY - if there was a memory error (the directory is not changed)
+ * STUDENT_DIRECTORY_OK - otherwise
+ */
+StudentDirectoryResult studentDirectoryAdd(StudentDirectory directory, Student student) {
+    if (directory == NULL || student == NULL) return STUDENT_DIRECTORY_NULL_ARGUMENT;
+    int id = studentGetId(student);
+    if (studentDirectoryGet(directory, id) != NULL) return STUDENT_DIRECTORY_STUDENT_ALREADY_EXISTS;
+    // allocate everything first, so nothing has to be undone if an allocation fails
+    if (directory->free_slots_count == 0 && directory->slot_count == directory->slot_capacity) {
+        int new_capacity = (directory->slot_capacity == 0) ? STUDENT_DIRECTORY_INITIAL_BUCKETS :
+                           directory->slot_capacity * 2;
+        int* new_free_slots = (int*) realloc(directory->free_slots, sizeof(int) * new_capacity);
+        if (new_free_slots == NULL) return STUDENT_DIRECTORY_OUT_OF_MEMORY;
+        directory->free_slots = new_free_slots;
+        Student* new_slot_students = (Student*) realloc(directory->slot_students, sizeof(Student) * new_capacity);
+        if (new_slot_students == NULL) return STUDENT_DIRECTORY_OUT_OF_MEMORY; // the bigger free_slots is still valid
+        directory->slot_students = new_slot_students;
+        directory->slot_capacity = new_capacity;
+    }
+    if ((directory->size + 1) * 2 > directory->buckets_count && !studentDirectoryGrow(directory)) {
+        return STUDENT_DIRECTORY_OUT_OF_MEMORY;
+    }
+    int slot = (directory->free_slots_count > 0) ? directory->free_slots[--directory->free_slots_count] :
+               directory->slot_count++;
+    directory_entry_t* entry = &directory->buckets[findBucket(directory->buckets, directory->buckets_count, id)];
+    entry->student = student;
+    entry->id = id;
+    entry->slot = slot;
+    directory->slot_students[slot] = student;
+    directory->size++;
+    return STUDENT_DIRECTORY_OK;
+}
+
+/**
+ * studentDirectoryRemove - removes the student with the given id from the directory (the student is not destroyed)
+ * @param directory - the directory to remove the student from
+ * @param id - the id of the student to remove
+ * @return
+ * STUDENT_DIRECTORY_NULL_ARGUMENT - if the directory is NULL
+ * STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST - if there is no student with this id in the directory
+ * STUDENT_DIRECTORY_OK - otherwise
+ */
+StudentDirectoryResult studentDirectoryRemove(StudentDirectory directory, int id) {
+    if (directory == NULL) return STUDENT_DIRECTORY_NULL_ARGUMENT;
+    int mask = directory->buckets_count - 1;
+    int index = findBucket(directory->buckets, directory->buckets_count, id);
+    if (directory->buckets[index].student == NULL) return STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST;
+    directory->free_slots[directory->free_slots_count++] = directory->buckets[index].slot;
+    directory->slot_students[directory->buckets[index].slot] = NULL;
+    directory->buckets[index].student = NULL;
+    directory->size--;
+    // move back the following entries of the run that can take the emptied bucket, so no lookup stops too early
+    int next = (index + 1) & mask;
+    while (directory->buckets[next].student != NULL) {
+        int home = hashId(directory->buckets[next].id) & mask;
+        if (((next - home) & mask) >= ((next - index) & mask)) {
+            directory->buckets[index] = directory->buckets[next];
+            directory->buckets[next].student = NULL;
+            index = next;
+        }
+        next = (next + 1) & mask;
+    }
+    return STUDENT_DIRECTORY_OK;
+}
+
+/**
+ * studentDirectoryGet - returns the student with the given id
+ * @param directory - the directory to search in
+ * @param id - the id of the student
+ * @return the student. NULL if there is no student with this id (or the directory is NULL)
+ */
+Student studentDirectoryGet(StudentDirectory directory, int id) {
+    if (directory == NULL) return NULL;
+    return directory->buckets[findBucket(directory->buckets, directory->buckets_count, id)].student;
+}
+
+/**
+ * studentDirectoryGetSlot - returns the slot of the student with the given id
+ * @param directory - the directory to search in
+ * @param id - the id of the student
+ * @return the slot of the student. -1 if there is no student with this id (or the directory is NULL)
+ */
+int studentDirectoryGetSlot(StudentDirectory directory, int id) {
+    if (directory == NULL) return -1;
+    directory_entry_t* entry = &directory->buckets[findBucket(directory->buckets, directory->buckets_count, id)];
+    return (entry->student == NULL) ? -1 : entry->slot;
+}
+
+/**
+ * studentDirectoryGetBySlot - returns the student with the given slot
+ * @param directory - the directory to search in
+ * @param slot - the slot of the student
+ * @return the student. NULL if no student has this slot (or the directory is NULL)
+ */
+Student studentDirectoryGetBySlot(StudentDirectory directory, int slot) {
+    if (directory == NULL || slot < 0 || slot >= directory->slot_count) return NULL;
+    return directory->slot_students[slot];
+}
+
+/**
+ * studentDirectoryGetSlotCount - returns the number of slots in use or free for reuse. all the slots of the students
+ * in the directory are lower than it
+ * @param directory - the directory
+ * @return the number of slots. -1 if the directory is NULL
+ */
+int studentDirectoryGetSlotCount(StudentDirectory directory) {
+    if (directory == NULL) return -1;
+    return directory->slot_count;
+}
+
+/**
+ * studentDirectoryGetSize - returns the number of students in the directory
+ * @param directory - the directory
+ * @return the number of students. -1 if the directory is NULL
+ */
+int studentDirectoryGetSize(StudentDirectory directory) {
+    if (directory == NULL) return -1;
+    return directory->size;
+}
+
+/**
+ * studentDirectoryDestroy - deallocate all the memory of the directory (the students are not destroyed)
+ * @param directory - the directory to destroy. if directory is NULL nothing will be done
+ */
+void studentDirectoryDestroy(StudentDirectory directory) {
+    if (directory == NULL) return;
+    free(directory->buckets);
+    free(directory->free_slots);
+    free(directory->slot_students);
+    free(directory);
+}
@@ -0,0 +1,102 @@
+#ifndef EX3_STUDENT_DIRECTORY_H
+#define EX3_STUDENT_DIRECTORY_H
+
+#include "student.h"
+
+/**
+ * Hash table of students by their id, for constant time lookups (instead of going over a Set of students).
+ *
+ * Every student in the directory also gets a slot - a small number that no other student in the directory has, and
+ * that is lower than studentDirectoryGetSlotCount. the slots of removed students are reused, so arrays indexed by the
+ * slots stay as small as the largest number of students the directory had.
+ * The directory does not own the students.
+ */
+typedef struct student_directory_t *StudentDirectory;
+
+/** Type used for returning error codes from functions */
+typedef enum StudentDirectoryResult_t {
+    STUDENT_DIRECTORY_OK,
+    STUDENT_DIRECTORY_NULL_ARGUMENT,
+    STUDENT_DIRECTORY_OUT_OF_MEMORY,
+    STUDENT_DIRECTORY_STUDENT_ALREADY_EXISTS,
+    STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST
+} StudentDirectoryResult;
+
+/**
+ * studentDirectoryCreate - creates a new empty directory
+ * @return
+ * NULL - if allocations failed.
+ * A new StudentDirectory in case of success.
+ */
+StudentDirectory studentDirectoryCreate();
+
+/**
+ * studentDirectoryAdd - adds the given student to the directory, by his id
+ * @param directory - the directory to add the student to
+ * @param student - the student to add. the directory keeps the pointer, so the student must stay alive until it is
+ * removed from the directory
+ * @return
+ * STUDENT_DIRECTORY_NULL_ARGUMENT - if one of the arguments is NULL
+ * STUDENT_DIRECTORY_STUDENT_ALREADY_EXISTS - if there is already a student with the same id in the directory
+ * STUDENT_DIRECTORY_OUT_OF_MEMORY - if there was a memory error (the directory is not changed)
+ * STUDENT_DIRECTORY_OK - otherwise
+ */
+StudentDirectoryResult studentDirectoryAdd(StudentDirectory directory, Student student);
+
+/**
+ * studentDirectoryRemove - removes the student with the given id from the directory (the student is not destroyed)
+ * @param directory - the directory to remove the student from
+ * @param id - the id of the student to remove
+ * @return
+ * STUDENT_DIRECTORY_NULL_ARGUMENT - if the directory is NULL
+ * STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST - if there is no student with this id in the directory
+ * STUDENT_DIRECTORY_OK - otherwise
+ */
+StudentDirectoryResult studentDirectoryRemove(StudentDirectory directory, int id);
+
+/**
+ * studentDirectoryGet - returns the student with the given id
+ * @param directory - the directory to search in
+ * @param id - the id of the student
+ * @return the student. NULL if there is no student with this id (or the directory is NULL)
+ */
+Student studentDirectoryGet(StudentDirectory directory, int id);
+
+/**
+ * studentDirectoryGetSlot - returns the slot of the student with the given id
+ * @param directory - the directory to search in
+ * @param id - the id of the student
+ * @return the slot of the student. -1 if there is no student with this id (or the directory is NULL)
+ */
+int studentDirectoryGetSlot(StudentDirectory directory, int id);
+
+/**
+ * studentDirectoryGetBySlot - returns the student with the given slot
+ * @param directory - the directory to search in
+ * @param slot - the slot of the student
+ * @return the student. NULL if no student has this slot (or the directory is NULL)
+ */
+Student studentDirectoryGetBySlot(StudentDirectory directory, int slot);
+
+/**
+ * studentDirectoryGetSlotCount - returns the number of slots in use or free for reuse. all the slots of the students
+ * in the directory are lower than it
+ * @param directory - the directory
+ * @return the number of slots. -1 if the directory is NULL
+ */
+int studentDirectoryGetSlotCount(StudentDirectory directory);
+
+/**
+ * studentDirectoryGetSize - returns the number of students in the directory
+ * @param directory - the directory
+ * @return the number of students. -1 if the directory is NULL
+ */
+int studentDirectoryGetSize(StudentDirectory directory);
+
+/**
+ * studentDirectoryDestroy - deallocate all the memory of the directory (the students are not destroyed)
+ * @param directory - the directory to destroy. if directory is NULL nothing will be done
+ */
+void studentDirectoryDestroy(StudentDirectory directory);
+
+#endif //EX3_STUDENT_DIRECTORY_H
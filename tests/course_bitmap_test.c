@@ -0,0 +1,111 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../course_bitmap.h"
+
+static bool testCourseBitmapCreate() {
+    //CourseBitmap courseBitmapCreate();
+    CourseBitmap bitmap = courseBitmapCreate();
+    ASSERT_TEST(bitmap != NULL);
+    ASSERT_TEST(courseBitmapGetSize(bitmap) == 0);
+    ASSERT_TEST(courseBitmapNext(bitmap, 0) == -1);
+    ASSERT_TEST(courseBitmapGetSize(NULL) == -1);
+    courseBitmapDestroy(bitmap);
+    return true;
+}
+
+static bool testCourseBitmapAdd() {
+    //CourseBitmapResult courseBitmapAdd(CourseBitmap bitmap, int course_id);
+    CourseBitmap bitmap = courseBitmapCreate();
+    ASSERT_TEST(courseBitmapAdd(bitmap, 234122) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 104012) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 999999) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 1) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 104012) == COURSE_BITMAP_ITEM_ALREADY_EXISTS);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 0) == COURSE_BITMAP_INVALID_PARAMETER);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 1000000) == COURSE_BITMAP_INVALID_PARAMETER);
+    ASSERT_TEST(courseBitmapAdd(NULL, 104012) == COURSE_BITMAP_NULL_ARGUMENT);
+    ASSERT_TEST(courseBitmapGetSize(bitmap) == 4);
+    ASSERT_TEST(courseBitmapContains(bitmap, 104012) == true);
+    ASSERT_TEST(courseBitmapContains(bitmap, 104013) == false);
+    ASSERT_TEST(courseBitmapContains(bitmap, 1000000) == false);
+    ASSERT_TEST(courseBitmapContains(NULL, 104012) == false);
+    courseBitmapDestroy(bitmap);
+    return true;
+}
+
+static bool testCourseBitmapRemove() {
+    //CourseBitmapResult courseBitmapRemove(CourseBitmap bitmap, int course_id);
+    CourseBitmap bitmap = courseBitmapCreate();
+    ASSERT_TEST(courseBitmapRemove(bitmap, 104012) == COURSE_BITMAP_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 104012) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapAdd(bitmap, 104013) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapRemove(bitmap, 104012) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapRemove(bitmap, 104012) == COURSE_BITMAP_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(courseBitmapRemove(NULL, 104013) == COURSE_BITMAP_NULL_ARGUMENT);
+    ASSERT_TEST(courseBitmapGetSize(bitmap) == 1);
+    ASSERT_TEST(courseBitmapNext(bitmap, 0) == 104013);
+    ASSERT_TEST(courseBitmapRemove(bitmap, 104013) == COURSE_BITMAP_OK);
+    ASSERT_TEST(courseBitmapNext(bitmap, 0) == -1);
+    courseBitmapDestroy(bitmap);
+    return true;
+}
+
+static bool testCourseBitmapForeach() {
+    //COURSE_BITMAP_FOREACH(iterator, bitmap)
+    CourseBitmap bitmap = courseBitmapCreate();
+    int courses[] = {394808, 104012, 65535, 65536, 234122, 1, 999999};
+    int sorted_courses[] = {1, 65535, 65536, 104012, 234122, 394808, 999999};
+    for (int i = 0; i < 7; i++) {
+        ASSERT_TEST(courseBitmapAdd(bitmap, courses[i]) == COURSE_BITMAP_OK);
+    }
+    int counter = 0;
+    COURSE_BITMAP_FOREACH(course_id, bitmap) {
+        ASSERT_TEST(course_id == sorted_courses[counter]);
+        counter++;
+    }
+    ASSERT_TEST(counter == 7);
+    ASSERT_TEST(courseBitmapNext(bitmap, 104012) == 234122);
+    ASSERT_TEST(courseBitmapNext(bitmap, 999999) == -1);
+    ASSERT_TEST(courseBitmapNext(NULL, 0) == -1);
+    courseBitmapDestroy(bitmap);
+    return true;
+}
+
+static bool testCourseBitmapManyCourses() {
+    // a chunk with more courses than an array container holds is converted to a bitmap container and back
+    CourseBitmap bitmap = courseBitmapCreate();
+    for (int course_id = 100000; course_id < 110000; course_id += 2) {
+        ASSERT_TEST(courseBitmapAdd(bitmap, course_id) == COURSE_BITMAP_OK);
+    }
+    ASSERT_TEST(courseBitmapGetSize(bitmap) == 5000);
+    ASSERT_TEST(courseBitmapContains(bitmap, 104012) == true);
+    ASSERT_TEST(courseBitmapContains(bitmap, 104013) == false);
+    ASSERT_TEST(courseBitmapNext(bitmap, 104012) == 104014);
+    CourseBitmap copy = courseBitmapCopy(bitmap);
+    ASSERT_TEST(courseBitmapGetSize(copy) == 5000);
+    for (int course_id = 100000; course_id < 109000; course_id += 2) {
+        ASSERT_TEST(courseBitmapRemove(bitmap, course_id) == COURSE_BITMAP_OK);
+    }
+    ASSERT_TEST(courseBitmapGetSize(bitmap) == 500);
+    int expected = 109000, counter = 0;
+    COURSE_BITMAP_FOREACH(course_id, bitmap) {
+        ASSERT_TEST(course_id == expected);
+        expected += 2;
+        counter++;
+    }
+    ASSERT_TEST(counter == 500);
+    ASSERT_TEST(courseBitmapContains(copy, 100000) == true); // the copy is not affected
+    ASSERT_TEST(courseBitmapCopy(NULL) == NULL);
+    courseBitmapDestroy(bitmap);
+    courseBitmapDestroy(copy);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testCourseBitmapCreate);
+    RUN_TEST(testCourseBitmapAdd);
+    RUN_TEST(testCourseBitmapRemove);
+    RUN_TEST(testCourseBitmapForeach);
+    RUN_TEST(testCourseBitmapManyCourses);
+    return 0;
+}
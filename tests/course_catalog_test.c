@@ -0,0 +1,97 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../course_catalog.h"
+
+static bool testCourseCatalogCreate() {
+    //CourseCatalog courseCatalogCreate();
+    CourseCatalog catalog = courseCatalogCreate();
+    ASSERT_TEST(catalog != NULL);
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 0);
+    ASSERT_TEST(courseCatalogGetSize(NULL) == -1);
+    courseCatalogDestroy(catalog);
+    return true;
+}
+
+static bool testCourseCatalogGet() {
+    //Course courseCatalogGet(CourseCatalog catalog, int course_id, int points_x2);
+    CourseCatalog catalog = courseCatalogCreate();
+    Course calculus = courseCatalogGet(catalog, 104012, 11);
+    ASSERT_TEST(calculus != NULL);
+    ASSERT_TEST(courseGetId(calculus) == 104012);
+    ASSERT_TEST(courseGetPointsX2(calculus) == 11);
+    ASSERT_TEST(courseIsSport(calculus) == false);
+    ASSERT_TEST(courseCatalogGet(catalog, 104012, 11) == calculus); // the same entry is shared
+    Course calculus_other_points = courseCatalogGet(catalog, 104012, 10);
+    ASSERT_TEST(calculus_other_points != calculus);
+    Course sport = courseCatalogGet(catalog, 394808, 2);
+    ASSERT_TEST(courseIsSport(sport) == true);
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 3);
+
+    // entries without a catalog are not shared
+    Course unshared = courseCatalogGet(NULL, 104012, 11);
+    ASSERT_TEST(unshared != NULL && unshared != calculus);
+    ASSERT_TEST(courseGetPointsX2(unshared) == 11);
+
+    ASSERT_TEST(courseGetId(NULL) == -1);
+    ASSERT_TEST(courseGetPointsX2(NULL) == -1);
+    ASSERT_TEST(courseIsSport(NULL) == false);
+
+    courseRelease(unshared);
+    courseRelease(calculus);
+    courseRelease(calculus);
+    courseRelease(calculus_other_points);
+    courseRelease(sport);
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 0);
+    courseCatalogDestroy(catalog);
+    return true;
+}
+
+static bool testCourseRelease() {
+    //void courseRelease(Course course);
+    CourseCatalog catalog = courseCatalogCreate();
+    Course course = courseCatalogGet(catalog, 234122, 6);
+    ASSERT_TEST(courseRetain(course) == course);
+    courseRelease(course);
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 1); // still held once
+    courseRelease(course);
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 0);
+    courseRelease(NULL);
+    ASSERT_TEST(courseRetain(NULL) == NULL);
+
+    // more entries than the initial number of buckets
+    Course courses[300];
+    for (int i = 0; i < 300; i++) {
+        courses[i] = courseCatalogGet(catalog, 100000 + i, 6);
+        ASSERT_TEST(courses[i] != NULL);
+    }
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 300);
+    for (int i = 0; i < 150; i++) {
+        courseRelease(courses[i]);
+    }
+    ASSERT_TEST(courseCatalogGetSize(catalog) == 150);
+
+    // entries that outlive their catalog
+    courseCatalogDestroy(catalog);
+    ASSERT_TEST(courseGetId(courses[299]) == 100299);
+    for (int i = 150; i < 300; i++) {
+        courseRelease(courses[i]);
+    }
+    return true;
+}
+
+static bool testIsSportCourseId() {
+    //bool isSportCourseId(int course_id);
+    ASSERT_TEST(isSportCourseId(390000) == true);
+    ASSERT_TEST(isSportCourseId(399999) == true);
+    ASSERT_TEST(isSportCourseId(389999) == false);
+    ASSERT_TEST(isSportCourseId(400000) == false);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testCourseCatalogCreate);
+    RUN_TEST(testCourseCatalogGet);
+    RUN_TEST(testCourseRelease);
+    RUN_TEST(testIsSportCourseId);
+    return 0;
+}
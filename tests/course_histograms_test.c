@@ -0,0 +1,105 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../course_histograms.h"
+
+#define MANY_COURSES 200
+
+static bool testCourseHistogramsCreate() {
+    //CourseHistograms courseHistogramsCreate();
+    CourseHistograms histograms = courseHistogramsCreate();
+    ASSERT_TEST(histograms != NULL);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 234122) == 0);
+    ASSERT_TEST(courseHistogramsGetMean(histograms, 234122) == -1);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 50) == -1);
+    ASSERT_TEST(courseHistogramsGetFailedCount(histograms, 234122) == 0);
+    ASSERT_TEST(courseHistogramsGetCount(NULL, 234122) == 0);
+    courseHistogramsDestroy(histograms);
+    return true;
+}
+
+static bool testCourseHistogramsAdd() {
+    //CourseHistogramsResult courseHistogramsAdd(CourseHistograms histograms, int course_id, int grade);
+    CourseHistograms histograms = courseHistogramsCreate();
+    ASSERT_TEST(courseHistogramsAdd(NULL, 234122, 80) == COURSE_HISTOGRAMS_NULL_ARGUMENT);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 234122, 101) == COURSE_HISTOGRAMS_INVALID_PARAMETER);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 234122, -1) == COURSE_HISTOGRAMS_INVALID_PARAMETER);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 234122, 80) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 234122, 30) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 234122, 100) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 104012, 0) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 234122) == 3);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 104012) == 1);
+    ASSERT_TEST(courseHistogramsGetMean(histograms, 234122) == 70);
+    ASSERT_TEST(courseHistogramsGetFailedCount(histograms, 234122) == 1);
+    ASSERT_TEST(courseHistogramsGetFailedCount(histograms, 104012) == 1);
+    courseHistogramsDestroy(histograms);
+    return true;
+}
+
+static bool testCourseHistogramsRemove() {
+    //CourseHistogramsResult courseHistogramsRemove(CourseHistograms histograms, int course_id, int grade);
+    CourseHistograms histograms = courseHistogramsCreate();
+    courseHistogramsAdd(histograms, 234122, 80);
+    courseHistogramsAdd(histograms, 234122, 54);
+    ASSERT_TEST(courseHistogramsRemove(NULL, 234122, 80) == COURSE_HISTOGRAMS_NULL_ARGUMENT);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 234122, 70) == COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 104012, 80) == COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 234122, 200) == COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 234122, 54) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 234122, 54) == COURSE_HISTOGRAMS_GRADE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 234122) == 1);
+    ASSERT_TEST(courseHistogramsGetFailedCount(histograms, 234122) == 0);
+    ASSERT_TEST(courseHistogramsRemove(histograms, 234122, 80) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 234122) == 0);
+    ASSERT_TEST(courseHistogramsGetMean(histograms, 234122) == -1);
+    courseHistogramsDestroy(histograms);
+    return true;
+}
+
+static bool testCourseHistogramsGetPercentile() {
+    //int courseHistogramsGetPercentile(CourseHistograms histograms, int course_id, int percent);
+    CourseHistograms histograms = courseHistogramsCreate();
+    int grades[] = {40, 90, 60, 70, 100, 60, 80, 50, 95, 65};
+    for (int i = 0; i < 10; i++) {
+        courseHistogramsAdd(histograms, 234122, grades[i]);
+    }
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 0) == 40);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 25) == 60);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 50) == 65); // the lower median
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 75) == 90);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 90) == 95);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 100) == 100);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, 101) == -1);
+    ASSERT_TEST(courseHistogramsGetPercentile(histograms, 234122, -1) == -1);
+    ASSERT_TEST(courseHistogramsGetPercentile(NULL, 234122, 50) == -1);
+    courseHistogramsDestroy(histograms);
+    return true;
+}
+
+static bool testCourseHistogramsManyCourses() {
+    //void courseHistogramsClear(CourseHistograms histograms);
+    CourseHistograms histograms = courseHistogramsCreate();
+    for (int i = 0; i < MANY_COURSES; i++) {
+        ASSERT_TEST(courseHistogramsAdd(histograms, (i + 1) * 64, i % 101) == COURSE_HISTOGRAMS_OK);
+        ASSERT_TEST(courseHistogramsAdd(histograms, (i + 1) * 64, 100) == COURSE_HISTOGRAMS_OK);
+    }
+    for (int i = 0; i < MANY_COURSES; i++) {
+        ASSERT_TEST(courseHistogramsGetCount(histograms, (i + 1) * 64) == 2);
+        ASSERT_TEST(courseHistogramsGetPercentile(histograms, (i + 1) * 64, 50) == i % 101);
+    }
+    courseHistogramsClear(histograms);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 64) == 0);
+    ASSERT_TEST(courseHistogramsAdd(histograms, 64, 70) == COURSE_HISTOGRAMS_OK);
+    ASSERT_TEST(courseHistogramsGetCount(histograms, 64) == 1);
+    courseHistogramsDestroy(histograms);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testCourseHistogramsCreate);
+    RUN_TEST(testCourseHistogramsAdd);
+    RUN_TEST(testCourseHistogramsRemove);
+    RUN_TEST(testCourseHistogramsGetPercentile);
+    RUN_TEST(testCourseHistogramsManyCourses);
+    return 0;
+}
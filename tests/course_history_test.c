@@ -0,0 +1,164 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../course_history.h"
+
+static bool testCourseHistoryCreate() {
+    //CourseHistory courseHistoryCreate();
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(history != NULL);
+    ASSERT_TEST(courseHistoryContains(history, 104012) == false);
+    ASSERT_TEST(courseHistoryGetLastSemester(history, 104012) == -1);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == -1);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+static bool testCourseHistoryAddGrade() {
+    //CourseHistoryResult courseHistoryAddGrade(CourseHistory history, int course_id, int semester_number, int grade);
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 2, 70) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 1, 50) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 2, 60) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 234122, 1, 90) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(NULL, 234122, 1, 90) == COURSE_HISTORY_NULL_ARGUMENT);
+    ASSERT_TEST(courseHistoryContains(history, 104012) == true);
+    ASSERT_TEST(courseHistoryContains(history, 104013) == false);
+    ASSERT_TEST(courseHistoryContains(NULL, 104012) == false);
+    ASSERT_TEST(courseHistoryGetLastSemester(history, 104012) == 2);
+    ASSERT_TEST(courseHistoryGetLastSemester(history, 234122) == 1);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == 70);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 234122) == 90);
+    ASSERT_TEST(courseHistoryGetBestGrade(NULL, 234122) == -1);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+static bool testCourseHistoryRemoveGrade() {
+    //CourseHistoryResult courseHistoryRemoveGrade(CourseHistory history, int course_id, int semester_number,
+    //                                             int last_grade, int best_grade);
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 1, 50) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 2, 70) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 2, 60) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 104012, 3, -1, -1) == COURSE_HISTORY_COURSE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 234122, 1, -1, -1) == COURSE_HISTORY_COURSE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistoryRemoveGrade(NULL, 104012, 2, 70, 70) == COURSE_HISTORY_NULL_ARGUMENT);
+    // the grade 60 was removed from semester 2, so 70 is left there
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 104012, 2, 70, 70) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryGetLastSemester(history, 104012) == 2);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == 70);
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 104012, 2, -1, -1) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryGetLastSemester(history, 104012) == 1);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == 50);
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 104012, 1, -1, -1) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryContains(history, 104012) == false);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == -1);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+static bool testCourseHistoryUpdateGrades() {
+    //CourseHistoryResult courseHistoryUpdateGrades(CourseHistory history, int course_id, int semester_number,
+    //                                              int last_grade, int best_grade);
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 1, 80) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 2, 70) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryUpdateGrades(history, 104012, 3, 90, 90) == COURSE_HISTORY_COURSE_DOES_NOT_EXIST);
+    ASSERT_TEST(courseHistoryUpdateGrades(NULL, 104012, 2, 90, 90) == COURSE_HISTORY_NULL_ARGUMENT);
+    ASSERT_TEST(courseHistoryUpdateGrades(history, 104012, 2, 95, 95) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == 95);
+    // lowering the grade makes the best grade of the other semester the best again
+    ASSERT_TEST(courseHistoryUpdateGrades(history, 104012, 2, 40, 40) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryGetBestGrade(history, 104012) == 80);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+static bool testCourseHistoryCopy() {
+    //CourseHistory courseHistoryCopy(CourseHistory history);
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(courseHistoryAddGrade(history, 104012, 1, 80) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryAddGrade(history, 234122, 2, 70) == COURSE_HISTORY_OK);
+    CourseHistory copy = courseHistoryCopy(history);
+    ASSERT_TEST(copy != NULL);
+    ASSERT_TEST(courseHistoryRemoveGrade(history, 104012, 1, -1, -1) == COURSE_HISTORY_OK);
+    ASSERT_TEST(courseHistoryGetBestGrade(copy, 104012) == 80); // the copy is not affected
+    ASSERT_TEST(courseHistoryGetLastSemester(copy, 234122) == 2);
+    ASSERT_TEST(courseHistoryCopy(NULL) == NULL);
+    courseHistoryDestroy(history);
+    courseHistoryDestroy(copy);
+    return true;
+}
+
+static bool testCourseHistoryGetLastGrade() {
+    //int courseHistoryGetLastGrade(CourseHistory history, int course_id, int semester_number);
+    CourseHistory history = courseHistoryCreate();
+    ASSERT_TEST(courseHistoryGetLastGrade(history, 104012, 1) == -1);
+    courseHistoryAddGrade(history, 104012, 1, 80);
+    courseHistoryAddGrade(history, 104012, 1, 30);
+    courseHistoryAddGrade(history, 104012, 2, 70);
+    ASSERT_TEST(courseHistoryGetLastGrade(history, 104012, 1) == 30);
+    ASSERT_TEST(courseHistoryGetLastGrade(history, 104012, 2) == 70);
+    ASSERT_TEST(courseHistoryGetLastGrade(history, 104012, 3) == -1);
+    ASSERT_TEST(courseHistoryGetLastGrade(NULL, 104012, 1) == -1);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+static bool testCourseHistoryGetPreviousSemester() {
+    //int courseHistoryGetPreviousSemester(CourseHistory history, int course_id, int semester_number);
+    CourseHistory history = courseHistoryCreate();
+    courseHistoryAddGrade(history, 104012, 2, 80);
+    courseHistoryAddGrade(history, 104012, 5, 70);
+    courseHistoryAddGrade(history, 104012, 7, 60);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 104012, 2) == -1);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 104012, 3) == 2);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 104012, 5) == 2);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 104012, 7) == 5);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 104012, 100) == 7);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(history, 234122, 100) == -1);
+    ASSERT_TEST(courseHistoryGetPreviousSemester(NULL, 104012, 100) == -1);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+/** CourseSemesterVisitor for the tests, that writes every visit into the array the context points to */
+static void collectSemester(int course_id, int semester_number, int last_grade, void* context) {
+    int** next = context;
+    (*next)[0] = course_id;
+    (*next)[1] = semester_number;
+    (*next)[2] = last_grade;
+    *next += 3;
+}
+
+static bool testCourseHistoryForEachSemester() {
+    //void courseHistoryForEachSemester(CourseHistory history, CourseSemesterVisitor visitor, void* context);
+    CourseHistory history = courseHistoryCreate();
+    courseHistoryAddGrade(history, 234122, 2, 90);
+    courseHistoryAddGrade(history, 104012, 3, 70);
+    courseHistoryAddGrade(history, 104012, 1, 80);
+    courseHistoryAddGrade(history, 104012, 1, 60);
+    int visits[9] = {0};
+    int* next = visits;
+    courseHistoryForEachSemester(history, collectSemester, &next);
+    ASSERT_TEST(next == visits + 9);
+    ASSERT_TEST(visits[0] == 104012 && visits[1] == 1 && visits[2] == 60);
+    ASSERT_TEST(visits[3] == 104012 && visits[4] == 3 && visits[5] == 70);
+    ASSERT_TEST(visits[6] == 234122 && visits[7] == 2 && visits[8] == 90);
+    courseHistoryForEachSemester(NULL, collectSemester, &next);
+    ASSERT_TEST(next == visits + 9);
+    courseHistoryDestroy(history);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testCourseHistoryCreate);
+    RUN_TEST(testCourseHistoryAddGrade);
+    RUN_TEST(testCourseHistoryRemoveGrade);
+    RUN_TEST(testCourseHistoryUpdateGrades);
+    RUN_TEST(testCourseHistoryCopy);
+    RUN_TEST(testCourseHistoryGetLastGrade);
+    RUN_TEST(testCourseHistoryGetPreviousSemester);
+    RUN_TEST(testCourseHistoryForEachSemester);
+    return 0;
+}
@@ -3,6 +3,11 @@
 #include "../course_manager.h"
 #include <stdio.h>
 
+#define RECLAIM_STUDENTS 100
+#define RECLAIM_BUDGET 10
+#define RECLAIM_GRADES 100
+#define RECLAIM_FIRST_COURSE 100001
+
 static bool testCourseManagerCreate() {
     //CourseManager courseManagerCreate();
     CourseManager course_manager_test = courseManagerCreate();
@@ -41,6 +46,181 @@ static bool testRemoveStudent() {
     return true;
 }
 
+static bool testLazyRemoveStudent() {
+    //void courseManagerSetLazyRemoval(CourseManager course_manager, bool lazy_removal);
+    //bool courseManagerReclaim(CourseManager course_manager, int budget);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    ASSERT_TEST(courseManagerReclaim(course_manager_test, 1) == true);
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    ASSERT_TEST(addStudent(course_manager_test, 222222226, "Eran", "Channover") == COURSE_MANAGER_OK);
+    ASSERT_TEST(addStudent(course_manager_test, 333333334, "Test", "Tester") == COURSE_MANAGER_OK);
+    ASSERT_TEST(logInStudent(course_manager_test, 222222226) == COURSE_MANAGER_OK);
+    ASSERT_TEST(addGrade(course_manager_test, 1, 104701, "3.5", 90) == COURSE_MANAGER_OK);
+    ASSERT_TEST(sendFriendRequest(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(logOutStudent(course_manager_test) == COURSE_MANAGER_OK);
+    ASSERT_TEST(logInStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(handleFriendRequest(course_manager_test, 222222226, "accept") == COURSE_MANAGER_OK);
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK); // logs him out
+
+    // the removed student is hidden before it is reclaimed
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(logInStudent(course_manager_test, 111111118) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(logInStudent(course_manager_test, 222222226) == COURSE_MANAGER_OK);
+    ASSERT_TEST(unFriend(course_manager_test, 111111118) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(logOutStudent(course_manager_test) == COURSE_MANAGER_OK);
+
+    // a student with the same id can be added again right away
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    ASSERT_TEST(logInStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(unFriend(course_manager_test, 222222226) == COURSE_MANAGER_NOT_FRIEND);
+    ASSERT_TEST(logOutStudent(course_manager_test) == COURSE_MANAGER_OK);
+
+    // reclaiming in slices of one student
+    ASSERT_TEST(removeStudent(course_manager_test, 222222226) == COURSE_MANAGER_OK);
+    ASSERT_TEST(removeStudent(course_manager_test, 333333334) == COURSE_MANAGER_OK);
+    int slices = 1;
+    while (courseManagerReclaim(course_manager_test, 1) == false) {
+        slices++;
+    }
+    ASSERT_TEST(slices > 1);
+    ASSERT_TEST(courseManagerReclaim(course_manager_test, 1) == true);
+    ASSERT_TEST(logInStudent(course_manager_test, 222222226) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(addStudent(course_manager_test, 222222226, "Eran", "Channover") == COURSE_MANAGER_OK);
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testLazyRemoveAnalytics() {
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 234122, "3", 40);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 1, 234122, "3", 90);
+    printf("\n");
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 2 grades, average 65.00
+     */
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 2 grades
+     Mean: 65.00
+     Median: 40
+     25th percentile: 40
+     75th percentile: 90
+     90th percentile: 90
+     Fail rate: 50.00%
+     */
+    // the hidden student is left out of the analytics before it is reclaimed
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 1 grades, average 90.00
+     */
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 1 grades
+     Mean: 90.00
+     Median: 90
+     25th percentile: 90
+     75th percentile: 90
+     90th percentile: 90
+     Fail rate: 0.00%
+     */
+    // and the analytics are kept up to date after they were built again
+    addGrade(course_manager_test, 2, 234122, "3", 50);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 2 grades, average 70.00
+     */
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 1 grades
+     Mean: 50.00
+     Median: 50
+     25th percentile: 50
+     75th percentile: 50
+     90th percentile: 50
+     Fail rate: 100.00%
+     */
+    while (courseManagerReclaim(course_manager_test, RECLAIM_BUDGET) == false) {
+    }
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK); // prints the same
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testReclaimSliceBudget() {
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    for (int i = 1; i <= RECLAIM_STUDENTS; i++) {
+        ASSERT_TEST(addStudent(course_manager_test, i, "Test", "Tester") == COURSE_MANAGER_OK);
+    }
+    ASSERT_TEST(removeStudent(course_manager_test, RECLAIM_STUDENTS / 2) == COURSE_MANAGER_OK);
+    // a slice goes over at most its budget of students, so the pass takes all the slices it needs, and then one more
+    // slice destroys the removed student
+    int slices = 1;
+    while (courseManagerReclaim(course_manager_test, RECLAIM_BUDGET) == false) {
+        slices++;
+    }
+    ASSERT_TEST(slices == RECLAIM_STUDENTS / RECLAIM_BUDGET + 1);
+    ASSERT_TEST(logInStudent(course_manager_test, RECLAIM_STUDENTS / 2) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(logInStudent(course_manager_test, RECLAIM_STUDENTS) == COURSE_MANAGER_OK);
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testReclaimReleaseBudget() {
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    for (int id = 1; id <= RECLAIM_STUDENTS; id++) {
+        ASSERT_TEST(addStudent(course_manager_test, id, "Test", "Tester") == COURSE_MANAGER_OK);
+    }
+    for (int id = 1; id <= 2; id++) {
+        ASSERT_TEST(logInStudent(course_manager_test, id) == COURSE_MANAGER_OK);
+        for (int i = 0; i < RECLAIM_GRADES; i++) {
+            ASSERT_TEST(addGrade(course_manager_test, i % 4 + 1, RECLAIM_FIRST_COURSE + i, "3.0", 90) ==
+                        COURSE_MANAGER_OK);
+        }
+        ASSERT_TEST(logOutStudent(course_manager_test) == COURSE_MANAGER_OK);
+    }
+    // destroying a student with a long history is spread over the slices, by its grades and courses
+    ASSERT_TEST(removeStudent(course_manager_test, 1) == COURSE_MANAGER_OK);
+    int slices = 1;
+    while (courseManagerReclaim(course_manager_test, RECLAIM_BUDGET) == false) {
+        slices++;
+    }
+    ASSERT_TEST(slices > RECLAIM_STUDENTS / RECLAIM_BUDGET + 2 * RECLAIM_GRADES / RECLAIM_BUDGET);
+    ASSERT_TEST(logInStudent(course_manager_test, 1) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    // a student that is added again while the removed one is being released replaces it at once
+    ASSERT_TEST(removeStudent(course_manager_test, 2) == COURSE_MANAGER_OK);
+    for (int i = 0; i <= RECLAIM_STUDENTS / RECLAIM_BUDGET; i++) {
+        ASSERT_TEST(courseManagerReclaim(course_manager_test, RECLAIM_BUDGET) == false);
+    }
+    ASSERT_TEST(addStudent(course_manager_test, 2, "Test", "Tester") == COURSE_MANAGER_OK);
+    ASSERT_TEST(courseManagerReclaim(course_manager_test, RECLAIM_BUDGET) == true);
+    ASSERT_TEST(logInStudent(course_manager_test, 2) == COURSE_MANAGER_OK);
+    ASSERT_TEST(addGrade(course_manager_test, 1, RECLAIM_FIRST_COURSE, "3.0", 80) == COURSE_MANAGER_OK);
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
 static bool testLogInStudent() {
     //CourseManagerResult logInStudent(CourseManager course_manager, int id);
     CourseManager course_manager_test = courseManagerCreate();
@@ -505,6 +685,64 @@ static bool testPrintCleanReport() {
     return true;
 }
 
+static bool testPrintReportsCached() {
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 234122, "3", 60);
+    printf("\n");
+    ASSERT_TEST(printCleanReport(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCleanReport(course_manager_test, stdout) == COURSE_MANAGER_OK); // printed from the cache
+    // should print (twice)
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 60
+    ========================================
+    Points: 3.0		Average: 60.00
+     */
+    // a change of the grades is printed
+    updateGrade(course_manager_test, 234122, 90);
+    ASSERT_TEST(printCleanReport(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 90
+    ========================================
+    Points: 3.0		Average: 90.00
+     */
+    // a new student with the same id gets to the same version of his grades, but not to the removed student's report
+    ASSERT_TEST(printFullReport(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 104012, "5.5", 70);
+    addGrade(course_manager_test, 1, 104012, "5.5", 75);
+    ASSERT_TEST(printFullReport(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 90
+    ========================================
+    Semester 1		Points: 3.0		Average: 90.00		Success: 100%
+
+    Points: 3.0		Average: 90.00		Success: 100%
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 104012		Points: 5.5		Grade: 70
+    Course: 104012		Points: 5.5		Grade: 75
+    ========================================
+    Semester 1		Points: 5.5		Average: 75.00		Success: 100%
+
+    Points: 5.5		Average: 75.00		Success: 100%
+     */
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
 static bool testPrintBestGrades() {
     //CourseManagerResult printBestGrades(CourseManager course_manager, int amount, FILE* output_channel);
     CourseManager course_manager_test = courseManagerCreate();
@@ -733,6 +971,588 @@ static bool testPrintReferenceSources() {
     return true;
 }
 
+/**
+ * makeFriends - adds a friendship between the two students with the given ids, logging out the logged student
+ */
+static void makeFriends(CourseManager course_manager, int id1, int id2) {
+    logOutStudent(course_manager);
+    logInStudent(course_manager, id1);
+    sendFriendRequest(course_manager, id2);
+    logOutStudent(course_manager);
+    logInStudent(course_manager, id2);
+    handleFriendRequest(course_manager, id1, "accept");
+    logOutStudent(course_manager);
+}
+
+static bool testPrintReferenceNetwork() {
+    //CourseManagerResult printReferenceNetwork(CourseManager course_manager, int course_id, int amount, int depth,
+    // FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 3, 2, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    addStudent(course_manager_test, 444444445, "Test2", "Tester2");
+    // a chain of friends: 111111118 - 222222226 - 333333334 - 444444445, and a cycle back to the first one
+    makeFriends(course_manager_test, 111111118, 222222226);
+    makeFriends(course_manager_test, 222222226, 333333334);
+    makeFriends(course_manager_test, 333333334, 444444445);
+    makeFriends(course_manager_test, 444444445, 111111118);
+    logInStudent(course_manager_test, 444444445);
+    unFriend(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 104701, "3.5", 80);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 333333334);
+    addGrade(course_manager_test, 1, 104701, "3.5", 90);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 1, 104701, "3.5", 70);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 104701, "3.5", 100);
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, -3, 2, stdout) ==
+                COURSE_MANAGER_INVALID_PARAMETERS);
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 3, 0, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    printf("\n");
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 3, 1, stdout) == COURSE_MANAGER_OK);
+    // should print (like printReferenceSources)
+    /**
+     Eran Channover
+     */
+    printf("\n");
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 3, 2, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test Tester
+     Eran Channover
+     */
+    printf("\n");
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 2, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test Tester
+     Test2 Tester2
+     */
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 234118, 3, 5, stdout) == COURSE_MANAGER_OK);
+    // should print nothing
+    // a removed student is not printed, and the network does not go through him
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    ASSERT_TEST(removeStudent(course_manager_test, 333333334) == COURSE_MANAGER_OK);
+    printf("\n");
+    ASSERT_TEST(printReferenceNetwork(course_manager_test, 104701, 3, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Eran Channover
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintMutualFriends() {
+    //CourseManagerResult printMutualFriends(CourseManager course_manager, int otherId, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    addStudent(course_manager_test, 444444445, "Test2", "Tester2");
+    ASSERT_TEST(printMutualFriends(course_manager_test, 222222226, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    makeFriends(course_manager_test, 111111118, 333333334);
+    makeFriends(course_manager_test, 111111118, 444444445);
+    makeFriends(course_manager_test, 222222226, 444444445);
+    makeFriends(course_manager_test, 222222226, 333333334);
+    logInStudent(course_manager_test, 111111118);
+    ASSERT_TEST(printMutualFriends(course_manager_test, 555555556, stdout) == COURSE_MANAGER_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(printMutualFriends(course_manager_test, 111111118, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    printf("\n");
+    ASSERT_TEST(printMutualFriends(course_manager_test, 222222226, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test Tester
+     Test2 Tester2
+     */
+    ASSERT_TEST(printMutualFriends(course_manager_test, 333333334, stdout) == COURSE_MANAGER_OK);
+    // should print nothing
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    ASSERT_TEST(removeStudent(course_manager_test, 333333334) == COURSE_MANAGER_OK);
+    logInStudent(course_manager_test, 111111118);
+    printf("\n");
+    ASSERT_TEST(printMutualFriends(course_manager_test, 222222226, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test2 Tester2
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintFriendSuggestions() {
+    //CourseManagerResult printFriendSuggestions(CourseManager course_manager, int amount, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    ASSERT_TEST(printFriendSuggestions(course_manager_test, 3, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    addStudent(course_manager_test, 444444445, "Test2", "Tester2");
+    addStudent(course_manager_test, 555555556, "Test3", "Tester3");
+    addStudent(course_manager_test, 666666667, "Test4", "Tester4");
+    // 111111118 is friend of 222222226 and 333333334. 444444445 is a friend of both of them, 555555556 and
+    // 666666667 are friends of only one of them
+    makeFriends(course_manager_test, 111111118, 222222226);
+    makeFriends(course_manager_test, 111111118, 333333334);
+    makeFriends(course_manager_test, 444444445, 222222226);
+    makeFriends(course_manager_test, 444444445, 333333334);
+    makeFriends(course_manager_test, 666666667, 333333334);
+    makeFriends(course_manager_test, 555555556, 222222226);
+    logInStudent(course_manager_test, 111111118);
+    ASSERT_TEST(printFriendSuggestions(course_manager_test, 0, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    printf("\n");
+    ASSERT_TEST(printFriendSuggestions(course_manager_test, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test2 Tester2
+     Test3 Tester3
+     Test4 Tester4
+     */
+    printf("\n");
+    ASSERT_TEST(printFriendSuggestions(course_manager_test, 2, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Test2 Tester2
+     Test3 Tester3
+     */
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 444444445);
+    printf("\n");
+    ASSERT_TEST(printFriendSuggestions(course_manager_test, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Ariel Wershal
+     Test3 Tester3
+     Test4 Tester4
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintNetworkStats() {
+    //CourseManagerResult printNetworkStats(CourseManager course_manager, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    ASSERT_TEST(addStudent(course_manager_test, 111111118, "Ariel", "Wershal") == COURSE_MANAGER_OK);
+    ASSERT_TEST(printNetworkStats(course_manager_test, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    addStudent(course_manager_test, 444444445, "Test2", "Tester2");
+    makeFriends(course_manager_test, 111111118, 222222226);
+    makeFriends(course_manager_test, 222222226, 333333334);
+    logInStudent(course_manager_test, 111111118);
+    printf("\n");
+    ASSERT_TEST(printNetworkStats(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Study groups: 2
+     Largest study group: 3
+     Your study group: 3
+     */
+    // removing the middle friendship splits the group
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    ASSERT_TEST(unFriend(course_manager_test, 333333334) == COURSE_MANAGER_OK);
+    printf("\n");
+    ASSERT_TEST(printNetworkStats(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Study groups: 3
+     Largest study group: 2
+     Your study group: 2
+     */
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    makeFriends(course_manager_test, 333333334, 444444445);
+    logInStudent(course_manager_test, 444444445);
+    printf("\n");
+    ASSERT_TEST(printNetworkStats(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Study groups: 2
+     Largest study group: 2
+     Your study group: 2
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintCourseAverage() {
+    //CourseManagerResult printCourseAverage(CourseManager course_manager, int course_id, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 234122, "3", 80);
+    addGrade(course_manager_test, 1, 234122, "3", 40); // the second attempt counts as well
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 2, 234122, "3", 90);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 104012, stdout) == COURSE_MANAGER_COURSE_DOES_NOT_EXIST);
+    printf("\n");
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 3 grades, average 70.00
+     */
+    // the mirror is kept up to date after it was built
+    addGrade(course_manager_test, 2, 104012, "5.5", 100);
+    ASSERT_TEST(updateGrade(course_manager_test, 234122, 60) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 104012, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 104012: 1 grades, average 100.00
+     */
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 3 grades, average 60.00
+     */
+    ASSERT_TEST(removeGrade(course_manager_test, 2, 104012) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 104012, stdout) == COURSE_MANAGER_COURSE_DOES_NOT_EXIST);
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseAverage(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 1 grades, average 60.00
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintSemesterFailures() {
+    //CourseManagerResult printSemesterFailures(CourseManager course_manager, int semester, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    ASSERT_TEST(printSemesterFailures(course_manager_test, 1, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    ASSERT_TEST(printSemesterFailures(course_manager_test, 0, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    addGrade(course_manager_test, 1, 234122, "3", 54);
+    addGrade(course_manager_test, 1, 104012, "5.5", 55);
+    addGrade(course_manager_test, 2, 234122, "3", 30);
+    printf("\n");
+    ASSERT_TEST(printSemesterFailures(course_manager_test, 1, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Semester 1: 2 grades, 1 failed
+     */
+    courseManagerSetLazyRemoval(course_manager_test, true);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 1, 234122, "3", 20);
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printSemesterFailures(course_manager_test, 1, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Semester 1: 1 grades, 1 failed
+     */
+    ASSERT_TEST(printSemesterFailures(course_manager_test, 3, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Semester 3: 0 grades, 0 failed
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintGradeTotals() {
+    //CourseManagerResult printGradeTotals(CourseManager course_manager, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    ASSERT_TEST(printGradeTotals(course_manager_test, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    printf("\n");
+    ASSERT_TEST(printGradeTotals(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Grades: 0, points: 0.0, failed points: 0.0, average: 0.00
+     */
+    addGrade(course_manager_test, 1, 234122, "3", 80);
+    addGrade(course_manager_test, 1, 104012, "5.5", 40);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 2, 234122, "3", 100);
+    ASSERT_TEST(printGradeTotals(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Grades: 3, points: 11.5, failed points: 5.5, average: 66.09
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintCourseStats() {
+    //CourseManagerResult printCourseStats(CourseManager course_manager, int course_id, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_COURSE_DOES_NOT_EXIST);
+    addGrade(course_manager_test, 1, 234122, "3", 30);
+    addGrade(course_manager_test, 2, 234122, "3", 80); // replaces the effective grade of the first semester
+    addGrade(course_manager_test, 1, 234122, "3", 20); // an earlier semester does not count
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 1, 234122, "3", 60);
+    ASSERT_TEST(updateGrade(course_manager_test, 234122, 50) == COURSE_MANAGER_OK);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 333333334);
+    addGrade(course_manager_test, 1, 234122, "3", 100);
+    addGrade(course_manager_test, 1, 104012, "5.5", 70);
+    ASSERT_TEST(removeGrade(course_manager_test, 1, 104012) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseStats(course_manager_test, 104012, stdout) == COURSE_MANAGER_COURSE_DOES_NOT_EXIST);
+    printf("\n");
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 3 grades
+     Mean: 76.67
+     Median: 80
+     25th percentile: 50
+     75th percentile: 100
+     90th percentile: 100
+     Fail rate: 33.33%
+     */
+    ASSERT_TEST(removeStudent(course_manager_test, 222222226) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCourseStats(course_manager_test, 234122, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Course 234122: 2 grades
+     Mean: 90.00
+     Median: 80
+     25th percentile: 80
+     75th percentile: 100
+     90th percentile: 100
+     Fail rate: 0.00%
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintProgression() {
+    //CourseManagerResult printProgression(CourseManager course_manager, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    ASSERT_TEST(printProgression(course_manager_test, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 234122, "3", 70);
+    addGrade(course_manager_test, 2, 104012, "5.5", 90);
+    addGrade(course_manager_test, 4, 234122, "3", 85);
+    ASSERT_TEST(removeGrade(course_manager_test, 2, 104012) == COURSE_MANAGER_OK);
+    printf("\n");
+    ASSERT_TEST(printProgression(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     After semester 1: points 3.0, average 70.00
+     After semester 4: points 3.0, average 85.00
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintWhatIf() {
+    //CourseManagerResult printWhatIf(CourseManager course_manager, WhatIf scenario, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    WhatIf scenario = whatIfCreate();
+    whatIfAddChange(scenario, 234122, "3", 90);
+    ASSERT_TEST(printWhatIf(course_manager_test, scenario, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    addGrade(course_manager_test, 1, 234122, "3", 60);
+    addGrade(course_manager_test, 1, 104012, "5.5", 80);
+    printf("\n");
+    ASSERT_TEST(printWhatIf(course_manager_test, scenario, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    ========================================
+    Points: 8.5		Average: 83.53
+     */
+
+    // the sheet is not changed
+    ASSERT_TEST(updateGrade(course_manager_test, 234122, 65) == COURSE_MANAGER_OK);
+    whatIfAddChange(scenario, 234122, "3", 1000);
+    ASSERT_TEST(printWhatIf(course_manager_test, scenario, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    whatIfDestroy(scenario);
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintReportsAsOf() {
+    //int courseManagerBeginCommand(CourseManager course_manager);
+    //CourseManagerResult printFullReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel);
+    //CourseManagerResult printCleanReportAsOf(CourseManager course_manager, int sequence, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    ASSERT_TEST(courseManagerBeginCommand(course_manager_test) == 1);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    ASSERT_TEST(printFullReportAsOf(course_manager_test, 1, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    courseManagerBeginCommand(course_manager_test);
+    logInStudent(course_manager_test, 111111118);
+    courseManagerBeginCommand(course_manager_test);
+    addGrade(course_manager_test, 1, 234122, "3", 60);
+    addGrade(course_manager_test, 1, 104012, "5.5", 80); // the same command - replaces the version of the first grade
+    ASSERT_TEST(courseManagerBeginCommand(course_manager_test) == 4);
+    ASSERT_TEST(updateGrade(course_manager_test, 234122, 90) == COURSE_MANAGER_OK);
+    courseManagerBeginCommand(course_manager_test);
+    ASSERT_TEST(removeGrade(course_manager_test, 1, 104012) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printCleanReportAsOf(course_manager_test, -1, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    ASSERT_TEST(printCleanReportAsOf(course_manager_test, 6, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    printf("\n");
+    ASSERT_TEST(printFullReportAsOf(course_manager_test, 3, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 60
+    Course: 104012		Points: 5.5		Grade: 80
+    ========================================
+    Semester 1		Points: 8.5		Average: 72.94		Success: 100%
+
+    Points: 8.5		Average: 72.94		Success: 100%
+     */
+    ASSERT_TEST(printCleanReportAsOf(course_manager_test, 4, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 104012		Points: 5.5		Grade: 80
+    Course: 234122		Points: 3.0		Grade: 90
+    ========================================
+    Points: 8.5		Average: 83.53
+     */
+    ASSERT_TEST(printCleanReportAsOf(course_manager_test, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 90
+    ========================================
+    Points: 3.0		Average: 90.00
+     */
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testPrintRankAndTopStudents() {
+    //CourseManagerResult printRank(CourseManager course_manager, FILE* output_channel);
+    //CourseManagerResult printTopStudents(CourseManager course_manager, int amount, FILE* output_channel);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    ASSERT_TEST(printRank(course_manager_test, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    ASSERT_TEST(printTopStudents(course_manager_test, 2, stdout) == COURSE_MANAGER_NOT_LOGGED_IN);
+    logInStudent(course_manager_test, 111111118);
+    ASSERT_TEST(printTopStudents(course_manager_test, 0, stdout) == COURSE_MANAGER_INVALID_PARAMETERS);
+    addGrade(course_manager_test, 1, 234122, "3", 70);
+    addGrade(course_manager_test, 1, 104012, "5.5", 90);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 222222226);
+    addGrade(course_manager_test, 1, 234122, "3", 60);
+    ASSERT_TEST(updateGrade(course_manager_test, 234122, 95) == COURSE_MANAGER_OK);
+    logOutStudent(course_manager_test);
+    logInStudent(course_manager_test, 333333334);
+    printf("\n");
+    ASSERT_TEST(printRank(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Rank: 3 of 3, average: 0.00
+     */
+    addGrade(course_manager_test, 1, 234122, "3", 100);
+    ASSERT_TEST(removeGrade(course_manager_test, 1, 234122) == COURSE_MANAGER_OK);
+    addGrade(course_manager_test, 2, 234122, "3", 82);
+    ASSERT_TEST(printRank(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printTopStudents(course_manager_test, 5, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Rank: 3 of 3, average: 82.00
+     1. 222222226, average: 95.00
+     2. 111111118, average: 82.94
+     3. 333333334, average: 82.00
+     */
+    ASSERT_TEST(removeStudent(course_manager_test, 222222226) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printRank(course_manager_test, stdout) == COURSE_MANAGER_OK);
+    ASSERT_TEST(printTopStudents(course_manager_test, 1, stdout) == COURSE_MANAGER_OK);
+    // should print
+    /**
+     Rank: 2 of 2, average: 82.00
+     1. 111111118, average: 82.94
+     */
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
+static bool testCourseManagerFreezeFriendGraph() {
+    //FriendGraph courseManagerFreezeFriendGraph(CourseManager course_manager);
+    ASSERT_TEST(courseManagerFreezeFriendGraph(NULL) == NULL);
+    CourseManager course_manager_test = courseManagerCreate();
+    ASSERT_TEST(course_manager_test != NULL);
+    FriendGraph graph = courseManagerFreezeFriendGraph(course_manager_test);
+    ASSERT_TEST(graph != NULL && friendGraphGetVertexCount(graph) == 0);
+    addStudent(course_manager_test, 111111118, "Ariel", "Wershal");
+    addStudent(course_manager_test, 222222226, "Eran", "Channover");
+    addStudent(course_manager_test, 333333334, "Test", "Tester");
+    makeFriends(course_manager_test, 111111118, 222222226);
+    makeFriends(course_manager_test, 111111118, 333333334);
+    graph = courseManagerFreezeFriendGraph(course_manager_test);
+    ASSERT_TEST(friendGraphGetVertexCount(graph) == 3);
+    ASSERT_TEST(friendGraphGetEdgeCount(graph) == 4);
+    int degrees[3] = {0, 0, 0};
+    for (int vertex = 0; vertex < 3; vertex++) {
+        ASSERT_TEST(friendGraphHasVertex(graph, vertex));
+        friendGraphGetNeighbours(graph, vertex, &degrees[vertex]);
+    }
+    ASSERT_TEST(degrees[0] + degrees[1] + degrees[2] == 4);
+    ASSERT_TEST(degrees[0] == 2 || degrees[1] == 2 || degrees[2] == 2);
+    // nothing changed - the same snapshot is returned without building it again
+    int degree = 0;
+    const int* neighbours = friendGraphGetNeighbours(graph, 0, &degree);
+    ASSERT_TEST(courseManagerFreezeFriendGraph(course_manager_test) == graph);
+    ASSERT_TEST(friendGraphGetNeighbours(graph, 0, &degree) == neighbours);
+    // a removed student is not in the next snapshot
+    ASSERT_TEST(removeStudent(course_manager_test, 111111118) == COURSE_MANAGER_OK);
+    graph = courseManagerFreezeFriendGraph(course_manager_test);
+    ASSERT_TEST(friendGraphGetEdgeCount(graph) == 0);
+    int remaining = 0;
+    for (int vertex = 0; vertex < friendGraphGetVertexCount(graph); vertex++) {
+        remaining += friendGraphHasVertex(graph, vertex) ? 1 : 0;
+    }
+    ASSERT_TEST(remaining == 2);
+
+    destroyCourseManager(course_manager_test);
+    return true;
+}
+
 static bool testSendFacultyReqeust() {
     //CourseManagerResult sendFacultyReqeust(CourseManager course_manager, int course_id, char* request,
     // FILE* output_channel);
@@ -776,6 +1596,10 @@ int main() {
     RUN_TEST(testCourseManagerCreate);
     RUN_TEST(testAddStudent);
     RUN_TEST(testRemoveStudent);
+    RUN_TEST(testLazyRemoveStudent);
+    RUN_TEST(testReclaimSliceBudget);
+    RUN_TEST(testReclaimReleaseBudget);
+    RUN_TEST(testLazyRemoveAnalytics);
     RUN_TEST(testLogInStudent);
     RUN_TEST(testLogOutStudent);
     RUN_TEST(testSendFriendRequest);
@@ -786,9 +1610,23 @@ int main() {
     RUN_TEST(testUpdateGrade);
     RUN_TEST(testPrintFullReport);
     RUN_TEST(testPrintCleanReport);
+    RUN_TEST(testPrintReportsCached);
     RUN_TEST(testPrintBestGrades);
     RUN_TEST(testPrintWorstGrades);
     RUN_TEST(testPrintReferenceSources);
+    RUN_TEST(testPrintReferenceNetwork);
+    RUN_TEST(testPrintMutualFriends);
+    RUN_TEST(testPrintFriendSuggestions);
+    RUN_TEST(testPrintNetworkStats);
+    RUN_TEST(testCourseManagerFreezeFriendGraph);
+    RUN_TEST(testPrintCourseAverage);
+    RUN_TEST(testPrintSemesterFailures);
+    RUN_TEST(testPrintGradeTotals);
+    RUN_TEST(testPrintCourseStats);
+    RUN_TEST(testPrintWhatIf);
+    RUN_TEST(testPrintReportsAsOf);
+    RUN_TEST(testPrintRankAndTopStudents);
+    RUN_TEST(testPrintProgression);
     RUN_TEST(testSendFacultyReqeust);
     
     return 0;
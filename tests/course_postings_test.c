@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../course_postings.h"
+
+static bool testCoursePostingsCreate() {
+    //CoursePostings coursePostingsCreate();
+    CoursePostings postings = coursePostingsCreate();
+    ASSERT_TEST(postings != NULL);
+    int size = -1;
+    ASSERT_TEST(coursePostingsGet(postings, 104012, &size) == NULL);
+    ASSERT_TEST(size == 0);
+    coursePostingsDestroy(postings);
+    return true;
+}
+
+static bool testCoursePostingsSet() {
+    //CoursePostingsResult coursePostingsSet(CoursePostings postings, int course_id, int student_id, int best_grade);
+    CoursePostings postings = coursePostingsCreate();
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 300, 90) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 100, 70) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 200, 80) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 234122, 100, 60) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 100, 95) == COURSE_POSTINGS_OK); // update
+    ASSERT_TEST(coursePostingsSet(NULL, 104012, 100, 95) == COURSE_POSTINGS_NULL_ARGUMENT);
+    int size = 0;
+    const CoursePosting* list = coursePostingsGet(postings, 104012, &size);
+    ASSERT_TEST(size == 3);
+    ASSERT_TEST(list[0].student_id == 100 && list[0].best_grade == 95);
+    ASSERT_TEST(list[1].student_id == 200 && list[1].best_grade == 80);
+    ASSERT_TEST(list[2].student_id == 300 && list[2].best_grade == 90);
+    list = coursePostingsGet(postings, 234122, &size);
+    ASSERT_TEST(size == 1);
+    ASSERT_TEST(list[0].student_id == 100 && list[0].best_grade == 60);
+    ASSERT_TEST(coursePostingsGet(NULL, 234122, &size) == NULL);
+    ASSERT_TEST(size == 0);
+    ASSERT_TEST(coursePostingsGet(postings, 234122, NULL) == NULL);
+    coursePostingsDestroy(postings);
+    return true;
+}
+
+static bool testCoursePostingsRemove() {
+    //CoursePostingsResult coursePostingsRemove(CoursePostings postings, int course_id, int student_id);
+    CoursePostings postings = coursePostingsCreate();
+    ASSERT_TEST(coursePostingsRemove(postings, 104012, 100) == COURSE_POSTINGS_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 100, 70) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 200, 80) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsRemove(postings, 104012, 300) == COURSE_POSTINGS_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(coursePostingsRemove(NULL, 104012, 100) == COURSE_POSTINGS_NULL_ARGUMENT);
+    ASSERT_TEST(coursePostingsRemove(postings, 104012, 100) == COURSE_POSTINGS_OK);
+    int size = 0;
+    const CoursePosting* list = coursePostingsGet(postings, 104012, &size);
+    ASSERT_TEST(size == 1);
+    ASSERT_TEST(list[0].student_id == 200);
+    ASSERT_TEST(coursePostingsRemove(postings, 104012, 200) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsGet(postings, 104012, &size) == NULL);
+    ASSERT_TEST(size == 0);
+    // the course can get students again after it was emptied
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 200, 50) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsGet(postings, 104012, &size) != NULL);
+    ASSERT_TEST(size == 1);
+    coursePostingsDestroy(postings);
+    return true;
+}
+
+static bool testCoursePostingsLeaderboard() {
+    //CourseRank coursePostingsGetBest(CoursePostings postings, int course_id);
+    //CourseRank courseRankNext(CourseRank rank);
+    CoursePostings postings = coursePostingsCreate();
+    ASSERT_TEST(coursePostingsGetBest(postings, 104012) == NULL);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 300, 90) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 100, 70) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 200, 90) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 400, 50) == COURSE_POSTINGS_OK);
+    ASSERT_TEST(coursePostingsSet(postings, 104012, 400, 95) == COURSE_POSTINGS_OK); // moves to the top
+    ASSERT_TEST(coursePostingsRemove(postings, 104012, 100) == COURSE_POSTINGS_OK);
+    int expected_ids[] = {400, 200, 300};
+    int expected_grades[] = {95, 90, 90};
+    int counter = 0;
+    COURSE_RANK_FOREACH(rank, postings, 104012) {
+        ASSERT_TEST(courseRankGetPosting(rank)->student_id == expected_ids[counter]);
+        ASSERT_TEST(courseRankGetPosting(rank)->best_grade == expected_grades[counter]);
+        counter++;
+    }
+    ASSERT_TEST(counter == 3);
+    ASSERT_TEST(courseRankNext(NULL) == NULL);
+    ASSERT_TEST(courseRankGetPosting(NULL) == NULL);
+    coursePostingsDestroy(postings);
+    return true;
+}
+
+static bool testCoursePostingsManyStudents() {
+    // enough students for the leaderboard to use several levels
+    CoursePostings postings = coursePostingsCreate();
+    for (int id = 1; id <= 2000; id++) {
+        ASSERT_TEST(coursePostingsSet(postings, 104012, id, (id * 37) % 101) == COURSE_POSTINGS_OK);
+    }
+    for (int id = 1; id <= 2000; id += 3) {
+        ASSERT_TEST(coursePostingsSet(postings, 104012, id, (id * 11) % 101) == COURSE_POSTINGS_OK);
+    }
+    for (int id = 2; id <= 2000; id += 5) {
+        ASSERT_TEST(coursePostingsRemove(postings, 104012, id) == COURSE_POSTINGS_OK);
+    }
+    int size = 0;
+    ASSERT_TEST(coursePostingsGet(postings, 104012, &size) != NULL);
+    int counter = 0;
+    CoursePosting previous = {0, 101};
+    COURSE_RANK_FOREACH(rank, postings, 104012) {
+        const CoursePosting* current = courseRankGetPosting(rank);
+        ASSERT_TEST(current->best_grade < previous.best_grade ||
+                    (current->best_grade == previous.best_grade && current->student_id > previous.student_id));
+        previous = *current;
+        counter++;
+    }
+    ASSERT_TEST(counter == size);
+    coursePostingsDestroy(postings);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testCoursePostingsCreate);
+    RUN_TEST(testCoursePostingsSet);
+    RUN_TEST(testCoursePostingsRemove);
+    RUN_TEST(testCoursePostingsLeaderboard);
+    RUN_TEST(testCoursePostingsManyStudents);
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../friend_components.h"
+
+static bool testFriendComponentsCreate() {
+    //FriendComponents friendComponentsCreate();
+    FriendComponents components = friendComponentsCreate();
+    ASSERT_TEST(components != NULL);
+    ASSERT_TEST(friendComponentsGetCount(components) == 0);
+    ASSERT_TEST(friendComponentsGetLargestSize(components) == 0);
+    ASSERT_TEST(friendComponentsGetSize(components, 0) == 0);
+    ASSERT_TEST(friendComponentsGetCount(NULL) == -1);
+    ASSERT_TEST(friendComponentsGetLargestSize(NULL) == -1);
+    friendComponentsDestroy(components);
+    return true;
+}
+
+static bool testFriendComponentsAdd() {
+    //FriendComponentsResult friendComponentsAdd(FriendComponents components, int index);
+    FriendComponents components = friendComponentsCreate();
+    ASSERT_TEST(friendComponentsAdd(NULL, 0) == FRIEND_COMPONENTS_NULL_ARGUMENT);
+    ASSERT_TEST(friendComponentsAdd(components, -1) == FRIEND_COMPONENTS_INVALID_PARAMETER);
+    ASSERT_TEST(friendComponentsAdd(components, 0) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsAdd(components, 0) == FRIEND_COMPONENTS_ALREADY_EXISTS);
+    ASSERT_TEST(friendComponentsAdd(components, 1000) == FRIEND_COMPONENTS_OK); // grows
+    ASSERT_TEST(friendComponentsGetCount(components) == 2);
+    ASSERT_TEST(friendComponentsGetLargestSize(components) == 1);
+    ASSERT_TEST(friendComponentsGetSize(components, 1000) == 1);
+    ASSERT_TEST(friendComponentsGetSize(components, 999) == 0);
+    friendComponentsDestroy(components);
+    return true;
+}
+
+static bool testFriendComponentsUnite() {
+    //FriendComponentsResult friendComponentsUnite(FriendComponents components, int index1, int index2);
+    FriendComponents components = friendComponentsCreate();
+    for (int i = 0; i < 6; i++) {
+        friendComponentsAdd(components, i);
+    }
+    ASSERT_TEST(friendComponentsUnite(NULL, 0, 1) == FRIEND_COMPONENTS_NULL_ARGUMENT);
+    ASSERT_TEST(friendComponentsUnite(components, 0, 6) == FRIEND_COMPONENTS_DOES_NOT_EXIST);
+    ASSERT_TEST(friendComponentsUnite(components, 0, 1) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsUnite(components, 2, 3) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsUnite(components, 1, 3) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsUnite(components, 0, 2) == FRIEND_COMPONENTS_OK); // already in the same component
+    ASSERT_TEST(friendComponentsGetCount(components) == 3); // {0,1,2,3} {4} {5}
+    ASSERT_TEST(friendComponentsGetLargestSize(components) == 4);
+    ASSERT_TEST(friendComponentsGetSize(components, 3) == 4);
+    ASSERT_TEST(friendComponentsGetSize(components, 4) == 1);
+    ASSERT_TEST(friendComponentsUnite(components, 4, 5) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsGetCount(components) == 2);
+    ASSERT_TEST(friendComponentsGetSize(components, 5) == 2);
+    ASSERT_TEST(friendComponentsGetLargestSize(components) == 4);
+    friendComponentsDestroy(components);
+    return true;
+}
+
+static bool testFriendComponentsClear() {
+    //void friendComponentsClear(FriendComponents components);
+    FriendComponents components = friendComponentsCreate();
+    friendComponentsAdd(components, 0);
+    friendComponentsAdd(components, 1);
+    friendComponentsUnite(components, 0, 1);
+    friendComponentsClear(components);
+    ASSERT_TEST(friendComponentsGetCount(components) == 0);
+    ASSERT_TEST(friendComponentsGetLargestSize(components) == 0);
+    ASSERT_TEST(friendComponentsGetSize(components, 0) == 0);
+    ASSERT_TEST(friendComponentsAdd(components, 1) == FRIEND_COMPONENTS_OK);
+    ASSERT_TEST(friendComponentsGetSize(components, 1) == 1);
+    ASSERT_TEST(friendComponentsGetCount(components) == 1);
+    friendComponentsClear(NULL);
+    friendComponentsDestroy(components);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testFriendComponentsCreate);
+    RUN_TEST(testFriendComponentsAdd);
+    RUN_TEST(testFriendComponentsUnite);
+    RUN_TEST(testFriendComponentsClear);
+    return 0;
+}
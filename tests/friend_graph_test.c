@@ -0,0 +1,73 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../friend_graph.h"
+
+#define VERTICES 5
+
+/** the graph of the tests: 0 - 1, 0 - 3, 1 - 3. vertex 2 has no neighbours and vertex 4 is not in the graph */
+static const int test_degrees[VERTICES] = {2, 2, 0, 2, -1};
+static const int test_neighbours[VERTICES][2] = {{1, 3}, {0, 3}, {0, 0}, {0, 1}, {0, 0}};
+
+static int getTestNeighbours(int vertex, int* neighbours, void* context) {
+    int* calls = context;
+    (*calls)++;
+    if (neighbours != NULL) {
+        for (int i = 0; i < test_degrees[vertex]; i++) {
+            neighbours[i] = test_neighbours[vertex][i];
+        }
+    }
+    return test_degrees[vertex];
+}
+
+static bool testFriendGraphCreate() {
+    //FriendGraph friendGraphCreate();
+    FriendGraph graph = friendGraphCreate();
+    ASSERT_TEST(graph != NULL);
+    ASSERT_TEST(friendGraphGetVertexCount(graph) == 0);
+    ASSERT_TEST(friendGraphGetEdgeCount(graph) == 0);
+    ASSERT_TEST(friendGraphHasVertex(graph, 0) == false);
+    ASSERT_TEST(friendGraphGetVertexCount(NULL) == -1);
+    ASSERT_TEST(friendGraphGetEdgeCount(NULL) == -1);
+    friendGraphDestroy(graph);
+    return true;
+}
+
+static bool testFriendGraphBuild() {
+    //FriendGraphResult friendGraphBuild(FriendGraph graph, int vertex_count, FriendGraphNeighboursFunction neighbours,
+    // void* context);
+    FriendGraph graph = friendGraphCreate();
+    int calls = 0;
+    ASSERT_TEST(friendGraphBuild(NULL, VERTICES, getTestNeighbours, &calls) == FRIEND_GRAPH_NULL_ARGUMENT);
+    ASSERT_TEST(friendGraphBuild(graph, VERTICES, NULL, &calls) == FRIEND_GRAPH_NULL_ARGUMENT);
+    ASSERT_TEST(friendGraphBuild(graph, -1, getTestNeighbours, &calls) == FRIEND_GRAPH_INVALID_PARAMETER);
+    ASSERT_TEST(friendGraphBuild(graph, 0, getTestNeighbours, &calls) == FRIEND_GRAPH_OK);
+    ASSERT_TEST(friendGraphGetVertexCount(graph) == 0);
+    ASSERT_TEST(friendGraphBuild(graph, VERTICES, getTestNeighbours, &calls) == FRIEND_GRAPH_OK);
+    ASSERT_TEST(calls == VERTICES + 3); // the vertices with neighbours are asked twice
+    ASSERT_TEST(friendGraphGetVertexCount(graph) == VERTICES);
+    ASSERT_TEST(friendGraphGetEdgeCount(graph) == 6);
+    ASSERT_TEST(friendGraphHasVertex(graph, 2) == true);
+    ASSERT_TEST(friendGraphHasVertex(graph, 4) == false);
+    ASSERT_TEST(friendGraphHasVertex(graph, VERTICES) == false);
+    ASSERT_TEST(friendGraphHasVertex(graph, -1) == false);
+    int degree = -1;
+    const int* neighbours = friendGraphGetNeighbours(graph, 3, &degree);
+    ASSERT_TEST(degree == 2 && neighbours[0] == 0 && neighbours[1] == 1);
+    ASSERT_TEST(friendGraphGetNeighbours(graph, 2, &degree) == NULL && degree == 0);
+    ASSERT_TEST(friendGraphGetNeighbours(graph, 4, &degree) == NULL && degree == 0);
+    ASSERT_TEST(friendGraphGetNeighbours(graph, 0, NULL) == NULL);
+    // building again with less vertices reuses the memory
+    ASSERT_TEST(friendGraphBuild(graph, 3, getTestNeighbours, &calls) == FRIEND_GRAPH_OK);
+    ASSERT_TEST(friendGraphGetVertexCount(graph) == 3);
+    ASSERT_TEST(friendGraphGetEdgeCount(graph) == 4);
+    neighbours = friendGraphGetNeighbours(graph, 1, &degree);
+    ASSERT_TEST(degree == 2 && neighbours[0] == 0 && neighbours[1] == 3);
+    friendGraphDestroy(graph);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testFriendGraphCreate);
+    RUN_TEST(testFriendGraphBuild);
+    return 0;
+}
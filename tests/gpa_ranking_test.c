@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../gpa_ranking.h"
+
+#define MANY_STUDENTS 1000
+
+/** GpaRankingVisitor for the tests, that writes the ids of the students into the array the context points to */
+static void collectRankedId(int rank, int id, int grade_sum_x2, int points_x2, void* context) {
+    int* ids = context;
+    ids[rank - 1] = id;
+}
+
+static bool testGpaRankingCreate() {
+    //GpaRanking gpaRankingCreate();
+    GpaRanking ranking = gpaRankingCreate();
+    ASSERT_TEST(ranking != NULL);
+    ASSERT_TEST(gpaRankingGetSize(ranking) == 0);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 100, 0, 0) == -1);
+    ASSERT_TEST(gpaRankingGetSize(NULL) == -1);
+    ASSERT_TEST(gpaRankingGetRank(NULL, 100, 0, 0) == -1);
+    gpaRankingDestroy(ranking);
+    return true;
+}
+
+static bool testGpaRankingInsert() {
+    //GpaRankingResult gpaRankingInsert(GpaRanking ranking, int id, int grade_sum_x2, int points_x2);
+    GpaRanking ranking = gpaRankingCreate();
+    ASSERT_TEST(gpaRankingInsert(NULL, 100, 0, 0) == GPA_RANKING_NULL_ARGUMENT);
+    ASSERT_TEST(gpaRankingInsert(ranking, 100, -1, 2) == GPA_RANKING_INVALID_PARAMETER);
+    ASSERT_TEST(gpaRankingInsert(ranking, 100, 160, -2) == GPA_RANKING_INVALID_PARAMETER);
+    ASSERT_TEST(gpaRankingInsert(ranking, 100, 160, 2) == GPA_RANKING_OK); // average 80
+    ASSERT_TEST(gpaRankingInsert(ranking, 100, 320, 4) == GPA_RANKING_ALREADY_EXISTS); // the same average
+    ASSERT_TEST(gpaRankingInsert(ranking, 200, 540, 6) == GPA_RANKING_OK); // average 90
+    ASSERT_TEST(gpaRankingInsert(ranking, 300, 0, 0) == GPA_RANKING_OK); // no points
+    ASSERT_TEST(gpaRankingInsert(ranking, 400, 0, 2) == GPA_RANKING_OK); // average 0
+    ASSERT_TEST(gpaRankingInsert(ranking, 50, 240, 3) == GPA_RANKING_OK); // average 80, lower id
+    ASSERT_TEST(gpaRankingGetSize(ranking) == 5);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 200, 540, 6) == 1);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 50, 240, 3) == 2);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 100, 160, 2) == 3);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 100, 80, 1) == 3); // found by the average of the totals
+    ASSERT_TEST(gpaRankingGetRank(ranking, 400, 0, 2) == 4);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 300, 0, 0) == 5);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 100, 170, 2) == -1);
+    gpaRankingDestroy(ranking);
+    return true;
+}
+
+static bool testGpaRankingRemove() {
+    //GpaRankingResult gpaRankingRemove(GpaRanking ranking, int id, int grade_sum_x2, int points_x2);
+    GpaRanking ranking = gpaRankingCreate();
+    gpaRankingInsert(ranking, 100, 160, 2);
+    gpaRankingInsert(ranking, 200, 540, 6);
+    gpaRankingInsert(ranking, 300, 0, 0);
+    ASSERT_TEST(gpaRankingRemove(NULL, 100, 160, 2) == GPA_RANKING_NULL_ARGUMENT);
+    ASSERT_TEST(gpaRankingRemove(ranking, 100, 150, 2) == GPA_RANKING_DOES_NOT_EXIST);
+    ASSERT_TEST(gpaRankingRemove(ranking, 400, 160, 2) == GPA_RANKING_DOES_NOT_EXIST);
+    ASSERT_TEST(gpaRankingRemove(ranking, 200, 540, 6) == GPA_RANKING_OK);
+    ASSERT_TEST(gpaRankingRemove(ranking, 200, 540, 6) == GPA_RANKING_DOES_NOT_EXIST);
+    ASSERT_TEST(gpaRankingGetSize(ranking) == 2);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 100, 160, 2) == 1);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 300, 0, 0) == 2);
+    // the node of the removed student is reused
+    ASSERT_TEST(gpaRankingInsert(ranking, 200, 200, 2) == GPA_RANKING_OK);
+    ASSERT_TEST(gpaRankingGetRank(ranking, 200, 200, 2) == 1);
+    gpaRankingDestroy(ranking);
+    return true;
+}
+
+static bool testGpaRankingForEachTop() {
+    //int gpaRankingForEachTop(GpaRanking ranking, int amount, GpaRankingVisitor visitor, void* context);
+    GpaRanking ranking = gpaRankingCreate();
+    int ids[5] = {0};
+    ASSERT_TEST(gpaRankingForEachTop(ranking, 3, collectRankedId, ids) == 0);
+    gpaRankingInsert(ranking, 100, 160, 2);
+    gpaRankingInsert(ranking, 200, 540, 6);
+    gpaRankingInsert(ranking, 300, 0, 0);
+    gpaRankingInsert(ranking, 400, 140, 2);
+    ASSERT_TEST(gpaRankingForEachTop(NULL, 3, collectRankedId, ids) == -1);
+    ASSERT_TEST(gpaRankingForEachTop(ranking, 3, NULL, ids) == -1);
+    ASSERT_TEST(gpaRankingForEachTop(ranking, 3, collectRankedId, ids) == 3);
+    ASSERT_TEST(ids[0] == 200 && ids[1] == 100 && ids[2] == 400 && ids[3] == 0);
+    ASSERT_TEST(gpaRankingForEachTop(ranking, 5, collectRankedId, ids) == 4);
+    ASSERT_TEST(ids[3] == 300 && ids[4] == 0);
+    gpaRankingClear(ranking);
+    ASSERT_TEST(gpaRankingGetSize(ranking) == 0);
+    ASSERT_TEST(gpaRankingForEachTop(ranking, 5, collectRankedId, ids) == 0);
+    gpaRankingDestroy(ranking);
+    return true;
+}
+
+static bool testGpaRankingManyStudents() {
+    GpaRanking ranking = gpaRankingCreate();
+    // every student i has the average i % 101, and they are inserted in a scattered order
+    for (int i = 0; i < MANY_STUDENTS; i++) {
+        int id = (i * 379) % MANY_STUDENTS + 1;
+        ASSERT_TEST(gpaRankingInsert(ranking, id, (id % 101) * 4, 4) == GPA_RANKING_OK);
+    }
+    // remove every other student, so the tree is balanced again after removals too
+    for (int id = 2; id <= MANY_STUDENTS; id += 2) {
+        ASSERT_TEST(gpaRankingRemove(ranking, id, (id % 101) * 4, 4) == GPA_RANKING_OK);
+    }
+    ASSERT_TEST(gpaRankingGetSize(ranking) == MANY_STUDENTS / 2);
+    int* ids = malloc(sizeof(int) * MANY_STUDENTS / 2);
+    ASSERT_TEST(gpaRankingForEachTop(ranking, MANY_STUDENTS, collectRankedId, ids) == MANY_STUDENTS / 2);
+    for (int rank = 1; rank <= MANY_STUDENTS / 2; rank++) {
+        int id = ids[rank - 1];
+        ASSERT_TEST(id % 2 == 1);
+        ASSERT_TEST(gpaRankingGetRank(ranking, id, (id % 101) * 4, 4) == rank);
+        if (rank > 1) { // a lower average, or the same average with a higher id
+            int previous = ids[rank - 2];
+            ASSERT_TEST(previous % 101 > id % 101 || (previous % 101 == id % 101 && previous < id));
+        }
+    }
+    free(ids);
+    gpaRankingDestroy(ranking);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testGpaRankingCreate);
+    RUN_TEST(testGpaRankingInsert);
+    RUN_TEST(testGpaRankingRemove);
+    RUN_TEST(testGpaRankingForEachTop);
+    RUN_TEST(testGpaRankingManyStudents);
+    return 0;
+}
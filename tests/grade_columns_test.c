@@ -0,0 +1,157 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../grade_columns.h"
+
+#define MANY_GRADES 300
+
+static bool testGradeColumnsCreate() {
+    //GradeColumns gradeColumnsCreate();
+    GradeColumns columns = gradeColumnsCreate();
+    ASSERT_TEST(columns != NULL);
+    ASSERT_TEST(gradeColumnsGetSize(columns) == 0);
+    ASSERT_TEST(gradeColumnsGetSize(NULL) == -1);
+    ASSERT_TEST(gradeColumnsCountCourse(columns, 234122, NULL) == 0);
+    ASSERT_TEST(gradeColumnsCountSemester(columns, 1, NULL) == 0);
+    ASSERT_TEST(gradeColumnsCountCourse(NULL, 234122, NULL) == -1);
+    ASSERT_TEST(gradeColumnsCountSemester(NULL, 1, NULL) == -1);
+    gradeColumnsDestroy(columns);
+    return true;
+}
+
+static bool testGradeColumnsAppend() {
+    //GradeColumnsResult gradeColumnsAppend(GradeColumns columns, int student_id, Grade grade);
+    GradeColumns columns = gradeColumnsCreate();
+    Grade grade1 = NULL, grade2 = NULL;
+    gradeCreate(234122, "3", 80, 1, &grade1);
+    gradeCreate(104012, "5.5", 40, 2, &grade2);
+    ASSERT_TEST(gradeGetColumnRow(grade1) == -1);
+    ASSERT_TEST(gradeColumnsAppend(NULL, 100, grade1) == GRADE_COLUMNS_NULL_ARGUMENT);
+    ASSERT_TEST(gradeColumnsAppend(columns, 100, NULL) == GRADE_COLUMNS_NULL_ARGUMENT);
+    ASSERT_TEST(gradeColumnsAppend(columns, 100, grade1) == GRADE_COLUMNS_OK);
+    ASSERT_TEST(gradeColumnsAppend(columns, 100, grade1) == GRADE_COLUMNS_GRADE_ALREADY_EXISTS);
+    ASSERT_TEST(gradeColumnsAppend(columns, 200, grade2) == GRADE_COLUMNS_OK);
+    ASSERT_TEST(gradeColumnsGetSize(columns) == 2);
+    ASSERT_TEST(gradeGetColumnRow(grade1) == 0);
+    ASSERT_TEST(gradeGetColumnRow(grade2) == 1);
+    long long sum = 0;
+    ASSERT_TEST(gradeColumnsCountCourse(columns, 234122, &sum) == 1 && sum == 80);
+    int failed = 0;
+    ASSERT_TEST(gradeColumnsCountSemester(columns, 2, &failed) == 1 && failed == 1);
+    ASSERT_TEST(gradeColumnsCountSemester(columns, 1, &failed) == 1 && failed == 0);
+    gradeColumnsDestroy(columns); // the grades leave the mirror
+    ASSERT_TEST(gradeGetColumnRow(grade1) == -1);
+    ASSERT_TEST(gradeGetColumnRow(grade2) == -1);
+    gradeDestroy(grade1);
+    gradeDestroy(grade2);
+    return true;
+}
+
+static bool testGradeColumnsRemove() {
+    //GradeColumnsResult gradeColumnsRemove(GradeColumns columns, Grade grade);
+    GradeColumns columns = gradeColumnsCreate();
+    Grade grade1 = NULL, grade2 = NULL, grade3 = NULL;
+    gradeCreate(234122, "3", 80, 1, &grade1);
+    gradeCreate(234122, "3", 40, 1, &grade2);
+    gradeCreate(104012, "5.5", 100, 1, &grade3);
+    gradeColumnsAppend(columns, 100, grade1);
+    gradeColumnsAppend(columns, 100, grade2);
+    ASSERT_TEST(gradeColumnsRemove(NULL, grade1) == GRADE_COLUMNS_NULL_ARGUMENT);
+    ASSERT_TEST(gradeColumnsRemove(columns, NULL) == GRADE_COLUMNS_NULL_ARGUMENT);
+    ASSERT_TEST(gradeColumnsRemove(columns, grade3) == GRADE_COLUMNS_GRADE_DOES_NOT_EXIST);
+    gradeColumnsAppend(columns, 200, grade3);
+    // the last row moves into the removed one
+    ASSERT_TEST(gradeColumnsRemove(columns, grade1) == GRADE_COLUMNS_OK);
+    ASSERT_TEST(gradeColumnsRemove(columns, grade1) == GRADE_COLUMNS_GRADE_DOES_NOT_EXIST);
+    ASSERT_TEST(gradeGetColumnRow(grade1) == -1);
+    ASSERT_TEST(gradeGetColumnRow(grade3) == 0);
+    ASSERT_TEST(gradeColumnsGetSize(columns) == 2);
+    long long sum = 0;
+    ASSERT_TEST(gradeColumnsCountCourse(columns, 234122, &sum) == 1 && sum == 40);
+    ASSERT_TEST(gradeColumnsCountCourse(columns, 104012, &sum) == 1 && sum == 100);
+    ASSERT_TEST(gradeColumnsRemove(columns, grade3) == GRADE_COLUMNS_OK);
+    ASSERT_TEST(gradeColumnsRemove(columns, grade2) == GRADE_COLUMNS_OK);
+    ASSERT_TEST(gradeColumnsGetSize(columns) == 0);
+    gradeColumnsDestroy(columns);
+    gradeDestroy(grade1);
+    gradeDestroy(grade2);
+    gradeDestroy(grade3);
+    return true;
+}
+
+static bool testGradeColumnsUpdate() {
+    //GradeColumnsResult gradeColumnsUpdate(GradeColumns columns, Grade grade);
+    GradeColumns columns = gradeColumnsCreate();
+    Grade grade = NULL;
+    gradeCreate(234122, "3", 80, 1, &grade);
+    ASSERT_TEST(gradeColumnsUpdate(columns, grade) == GRADE_COLUMNS_GRADE_DOES_NOT_EXIST);
+    gradeColumnsAppend(columns, 100, grade);
+    gradeUpdateGradeNumber(grade, 30);
+    ASSERT_TEST(gradeColumnsUpdate(NULL, grade) == GRADE_COLUMNS_NULL_ARGUMENT);
+    ASSERT_TEST(gradeColumnsUpdate(columns, grade) == GRADE_COLUMNS_OK);
+    int failed = 0;
+    ASSERT_TEST(gradeColumnsCountSemester(columns, 1, &failed) == 1 && failed == 1);
+    gradeColumnsDestroy(columns);
+    gradeDestroy(grade);
+    return true;
+}
+
+static bool testGradeColumnsGetTotals() {
+    //int gradeColumnsGetTotals(GradeColumns columns, long long* points_x2, long long* failed_points_x2,
+    //                          long long* grade_points_x2);
+    GradeColumns columns = gradeColumnsCreate();
+    Grade grade1 = NULL, grade2 = NULL;
+    gradeCreate(234122, "3", 80, 1, &grade1);
+    gradeCreate(104012, "5.5", 40, 2, &grade2);
+    long long points_x2 = -1, failed_points_x2 = -1, grade_points_x2 = -1;
+    ASSERT_TEST(gradeColumnsGetTotals(NULL, &points_x2, NULL, NULL) == -1);
+    ASSERT_TEST(gradeColumnsGetTotals(columns, &points_x2, &failed_points_x2, &grade_points_x2) == 0);
+    ASSERT_TEST(points_x2 == 0 && failed_points_x2 == 0 && grade_points_x2 == 0);
+    gradeColumnsAppend(columns, 100, grade1);
+    gradeColumnsAppend(columns, 100, grade2);
+    ASSERT_TEST(gradeColumnsGetTotals(columns, &points_x2, &failed_points_x2, &grade_points_x2) == 2);
+    ASSERT_TEST(points_x2 == 17 && failed_points_x2 == 11 && grade_points_x2 == 6 * 80 + 11 * 40);
+    ASSERT_TEST(gradeColumnsGetTotals(columns, NULL, NULL, NULL) == 2);
+    gradeColumnsDestroy(columns);
+    gradeDestroy(grade1);
+    gradeDestroy(grade2);
+    return true;
+}
+
+static bool testGradeColumnsManyGrades() {
+    GradeColumns columns = gradeColumnsCreate();
+    Grade grades[MANY_GRADES];
+    for (int i = 0; i < MANY_GRADES; i++) {
+        grades[i] = NULL;
+        ASSERT_TEST(gradeCreate(1 + i % 3, "2", i % 101, 1 + i % 4, &grades[i]) == GRADE_OK);
+        ASSERT_TEST(gradeColumnsAppend(columns, i, grades[i]) == GRADE_COLUMNS_OK);
+    }
+    for (int i = 0; i < MANY_GRADES; i += 2) {
+        ASSERT_TEST(gradeColumnsRemove(columns, grades[i]) == GRADE_COLUMNS_OK);
+    }
+    ASSERT_TEST(gradeColumnsGetSize(columns) == MANY_GRADES / 2);
+    long long expected_sum = 0, sum = 0;
+    int expected_count = 0;
+    for (int i = 1; i < MANY_GRADES; i += 2) {
+        ASSERT_TEST(gradeGetColumnRow(grades[i]) >= 0 && gradeGetColumnRow(grades[i]) < MANY_GRADES / 2);
+        if (i % 3 == 0) {
+            expected_count++;
+            expected_sum += i % 101;
+        }
+    }
+    ASSERT_TEST(gradeColumnsCountCourse(columns, 1, &sum) == expected_count && sum == expected_sum);
+    gradeColumnsDestroy(columns);
+    for (int i = 0; i < MANY_GRADES; i++) {
+        gradeDestroy(grades[i]);
+    }
+    return true;
+}
+
+int main() {
+    RUN_TEST(testGradeColumnsCreate);
+    RUN_TEST(testGradeColumnsAppend);
+    RUN_TEST(testGradeColumnsRemove);
+    RUN_TEST(testGradeColumnsUpdate);
+    RUN_TEST(testGradeColumnsGetTotals);
+    RUN_TEST(testGradeColumnsManyGrades);
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <limits.h>
+#include "test_utilities.h"
+#include "../grade_kernels.h"
+
+#define PAIRS_COUNT 1000
+
+/**
+ * fillPairs - fills the arrays with pseudo random points (multiple by 2) and grades, some of them failed
+ */
+static void fillPairs(int* points_x2, int* grades, int count) {
+    unsigned int seed = 12345;
+    for (int i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        points_x2[i] = (int)((seed >> 8) % 21);
+        grades[i] = (int)((seed >> 16) % 101);
+    }
+}
+
+static bool testGradeKernelsSetLevel() {
+    //GradeKernelsLevel gradeKernelsSetLevel(GradeKernelsLevel level);
+    //GradeKernelsLevel gradeKernelsGetLevel();
+    GradeKernelsLevel best = gradeKernelsGetLevel(); // the best supported version is chosen by default
+    ASSERT_TEST(gradeKernelsSetLevel(GRADE_KERNELS_SCALAR) == GRADE_KERNELS_SCALAR);
+    ASSERT_TEST(gradeKernelsGetLevel() == GRADE_KERNELS_SCALAR);
+    ASSERT_TEST(gradeKernelsSetLevel(GRADE_KERNELS_AVX2) == best);
+    ASSERT_TEST(gradeKernelsGetLevel() == best);
+    return true;
+}
+
+static bool testGradeKernelsSums() {
+    //long long gradeKernelsSumPointsX2(const int* points_x2, int count);
+    //long long gradeKernelsSumFailedPointsX2(const int* points_x2, const int* grades, int count);
+    //long long gradeKernelsSumGradePointsX2(const int* points_x2, const int* grades, int count);
+    int points_x2[] = {6, 11, 4, 2, 8, 6, 3, 10, 7};
+    int grades[] = {100, 54, 55, 0, 90, 20, 60, 54, 77};
+    for (GradeKernelsLevel level = GRADE_KERNELS_SCALAR; level <= GRADE_KERNELS_AVX2; level++) {
+        gradeKernelsSetLevel(level);
+        ASSERT_TEST(gradeKernelsSumPointsX2(points_x2, 9) == 57);
+        ASSERT_TEST(gradeKernelsSumFailedPointsX2(points_x2, grades, 9) == 29);
+        ASSERT_TEST(gradeKernelsSumGradePointsX2(points_x2, grades, 9) == 3513);
+        ASSERT_TEST(gradeKernelsSumPointsX2(points_x2, 0) == 0);
+        ASSERT_TEST(gradeKernelsSumPointsX2(NULL, 9) == 0);
+        ASSERT_TEST(gradeKernelsSumFailedPointsX2(points_x2, NULL, 9) == 0);
+        ASSERT_TEST(gradeKernelsSumGradePointsX2(NULL, grades, 9) == 0);
+    }
+    gradeKernelsSetLevel(GRADE_KERNELS_AVX2);
+    return true;
+}
+
+static bool testGradeKernelsLevelsAgree() {
+    int* points_x2 = malloc(sizeof(int) * PAIRS_COUNT);
+    int* grades = malloc(sizeof(int) * PAIRS_COUNT);
+    ASSERT_TEST(points_x2 != NULL && grades != NULL);
+    fillPairs(points_x2, grades, PAIRS_COUNT);
+    // every count checks a different tail that does not fill a whole vector
+    for (int count = 1; count <= 40; count++) {
+        gradeKernelsSetLevel(GRADE_KERNELS_SCALAR);
+        long long points = gradeKernelsSumPointsX2(points_x2 + 1, count);
+        long long failed = gradeKernelsSumFailedPointsX2(points_x2 + 1, grades + 1, count);
+        long long grade_points = gradeKernelsSumGradePointsX2(points_x2 + 1, grades + 1, count);
+        for (GradeKernelsLevel level = GRADE_KERNELS_SSE2; level <= GRADE_KERNELS_AVX2; level++) {
+            gradeKernelsSetLevel(level);
+            ASSERT_TEST(gradeKernelsSumPointsX2(points_x2 + 1, count) == points);
+            ASSERT_TEST(gradeKernelsSumFailedPointsX2(points_x2 + 1, grades + 1, count) == failed);
+            ASSERT_TEST(gradeKernelsSumGradePointsX2(points_x2 + 1, grades + 1, count) == grade_points);
+        }
+    }
+    // the sums do not overflow with huge points
+    for (int i = 0; i < PAIRS_COUNT; i++) {
+        points_x2[i] = INT_MAX;
+        grades[i] = 100;
+    }
+    grades[PAIRS_COUNT - 1] = 0;
+    for (GradeKernelsLevel level = GRADE_KERNELS_SCALAR; level <= GRADE_KERNELS_AVX2; level++) {
+        gradeKernelsSetLevel(level);
+        ASSERT_TEST(gradeKernelsSumPointsX2(points_x2, PAIRS_COUNT) == (long long)INT_MAX * PAIRS_COUNT);
+        ASSERT_TEST(gradeKernelsSumFailedPointsX2(points_x2, grades, PAIRS_COUNT) == INT_MAX);
+        ASSERT_TEST(gradeKernelsSumGradePointsX2(points_x2, grades, PAIRS_COUNT) ==
+                    (long long)INT_MAX * 100 * (PAIRS_COUNT - 1));
+    }
+    gradeKernelsSetLevel(GRADE_KERNELS_AVX2);
+    free(points_x2);
+    free(grades);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testGradeKernelsSetLevel);
+    RUN_TEST(testGradeKernelsSums);
+    RUN_TEST(testGradeKernelsLevelsAgree);
+    return 0;
+}
@@ -190,6 +190,20 @@ static bool testGetCoursePointsX2() {
     return true;
 }
 
+static bool testGradeParsePointsX2() {
+    //bool gradeParsePointsX2(char* points, int* points_x2);
+    int points_x2 = -1;
+    ASSERT_TEST(gradeParsePointsX2("3.5", &points_x2) && points_x2 == 7);
+    ASSERT_TEST(gradeParsePointsX2("3.0", &points_x2) && points_x2 == 6);
+    ASSERT_TEST(gradeParsePointsX2("12", &points_x2) && points_x2 == 24);
+    ASSERT_TEST(!gradeParsePointsX2("3.8", &points_x2));
+    ASSERT_TEST(!gradeParsePointsX2(".5", &points_x2));
+    ASSERT_TEST(!gradeParsePointsX2("-1", &points_x2));
+    ASSERT_TEST(!gradeParsePointsX2(NULL, &points_x2));
+    ASSERT_TEST(!gradeParsePointsX2("3", NULL));
+    return true;
+}
+
 static bool testGetCourseId() {
     //int getCourseId(Grade grade);
     Grade grade_test = NULL;
@@ -250,6 +264,7 @@ int main() {
     RUN_TEST(testIsGradeIsForCourse);
     RUN_TEST(testGetGradeNumber);
     RUN_TEST(testGetCoursePointsX2);
+    RUN_TEST(testGradeParsePointsX2);
     RUN_TEST(testGetCourseId);
     RUN_TEST(testGetSemester);
     RUN_TEST(testGradeUpdateGradeNumber);
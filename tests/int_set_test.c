@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../int_set.h"
+
+static bool testIntSetCreate() {
+    //IntSet intSetCreate();
+    IntSet set = intSetCreate();
+    ASSERT_TEST(set != NULL);
+    ASSERT_TEST(intSetGetSize(set) == 0);
+    ASSERT_TEST(intSetGetElements(set) == NULL);
+    intSetDestroy(set);
+    return true;
+}
+
+static bool testIntSetAdd() {
+    //IntSetResult intSetAdd(IntSet set, int number);
+    IntSet set = intSetCreate();
+    ASSERT_TEST(intSetAdd(set, 333333334) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 111111118) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 222222226) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 111111118) == INT_SET_ITEM_ALREADY_EXISTS);
+    ASSERT_TEST(intSetAdd(NULL, 111111118) == INT_SET_NULL_ARGUMENT);
+    ASSERT_TEST(intSetGetSize(set) == 3);
+
+    // the numbers are kept sorted
+    const int* numbers = intSetGetElements(set);
+    ASSERT_TEST(numbers[0] == 111111118);
+    ASSERT_TEST(numbers[1] == 222222226);
+    ASSERT_TEST(numbers[2] == 333333334);
+
+    // more than the initial capacity
+    for (int i = 1; i <= 100; i++) {
+        ASSERT_TEST(intSetAdd(set, i) == INT_SET_OK);
+    }
+    ASSERT_TEST(intSetGetSize(set) == 103);
+    intSetDestroy(set);
+    return true;
+}
+
+static bool testIntSetIsIn() {
+    //bool intSetIsIn(IntSet set, int number);
+    IntSet set = intSetCreate();
+    ASSERT_TEST(intSetIsIn(set, 5) == false);
+    ASSERT_TEST(intSetAdd(set, 5) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 9) == INT_SET_OK);
+    ASSERT_TEST(intSetIsIn(set, 5) == true);
+    ASSERT_TEST(intSetIsIn(set, 9) == true);
+    ASSERT_TEST(intSetIsIn(set, 7) == false);
+    ASSERT_TEST(intSetIsIn(set, 10) == false);
+    ASSERT_TEST(intSetIsIn(NULL, 5) == false);
+    intSetDestroy(set);
+    return true;
+}
+
+static bool testIntSetRemove() {
+    //IntSetResult intSetRemove(IntSet set, int number);
+    IntSet set = intSetCreate();
+    ASSERT_TEST(intSetRemove(set, 5) == INT_SET_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(intSetAdd(set, 5) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 3) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 8) == INT_SET_OK);
+    ASSERT_TEST(intSetRemove(set, 5) == INT_SET_OK);
+    ASSERT_TEST(intSetRemove(set, 5) == INT_SET_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(intSetRemove(NULL, 3) == INT_SET_NULL_ARGUMENT);
+    ASSERT_TEST(intSetGetSize(set) == 2);
+    ASSERT_TEST(intSetGetElements(set)[0] == 3);
+    ASSERT_TEST(intSetGetElements(set)[1] == 8);
+    intSetDestroy(set);
+    return true;
+}
+
+static bool testIntSetCopy() {
+    //IntSet intSetCopy(IntSet set);
+    IntSet set = intSetCreate();
+    IntSet empty_copy = intSetCopy(set);
+    ASSERT_TEST(intSetGetSize(empty_copy) == 0);
+    ASSERT_TEST(intSetAdd(set, 2) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 1) == INT_SET_OK);
+    IntSet copy = intSetCopy(set);
+    ASSERT_TEST(intSetGetSize(copy) == 2);
+    ASSERT_TEST(intSetRemove(set, 1) == INT_SET_OK);
+    ASSERT_TEST(intSetIsIn(copy, 1) == true); // the copy is not affected
+    ASSERT_TEST(intSetAdd(copy, 3) == INT_SET_OK);
+    ASSERT_TEST(intSetCopy(NULL) == NULL);
+    intSetDestroy(set);
+    intSetDestroy(copy);
+    intSetDestroy(empty_copy);
+    return true;
+}
+
+static bool testIntSetForeach() {
+    //INT_SET_FOREACH(iterator, set)
+    IntSet set = intSetCreate();
+    ASSERT_TEST(intSetAdd(set, 30) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 10) == INT_SET_OK);
+    ASSERT_TEST(intSetAdd(set, 20) == INT_SET_OK);
+    int expected = 10, counter = 0;
+    INT_SET_FOREACH(number, set) {
+        ASSERT_TEST(number == expected);
+        expected += 10;
+        counter++;
+    }
+    ASSERT_TEST(counter == 3);
+    IntSet null_set = NULL;
+    INT_SET_FOREACH(number, null_set) {
+        counter += number;
+    }
+    ASSERT_TEST(counter == 3);
+    intSetDestroy(set);
+    return true;
+}
+
+/** counts the visited numbers, and checks that they are ascending */
+typedef struct common_numbers_t {
+    int count;
+    int last;
+    bool ascending;
+} common_numbers_t;
+
+static void countCommonNumber(int number, void* context) {
+    common_numbers_t* common = context;
+    if (common->count > 0 && number <= common->last) {
+        common->ascending = false;
+    }
+    common->last = number;
+    common->count++;
+}
+
+static bool testIntSetForEachCommon() {
+    //int intSetForEachCommon(IntSet set1, IntSet set2, IntSetVisitor visitor, void* context);
+    IntSet small = intSetCreate();
+    IntSet big = intSetCreate();
+    common_numbers_t common = {0, 0, true};
+    ASSERT_TEST(intSetForEachCommon(small, big, countCommonNumber, &common) == 0);
+    ASSERT_TEST(intSetForEachCommon(NULL, big, countCommonNumber, &common) == 0);
+    ASSERT_TEST(intSetForEachCommon(small, big, NULL, &common) == 0);
+    for (int i = 0; i < 1000; i++) {
+        intSetAdd(big, i * 3);
+    }
+    intSetAdd(small, -5);
+    intSetAdd(small, 0);
+    intSetAdd(small, 4);
+    intSetAdd(small, 300);
+    intSetAdd(small, 301);
+    intSetAdd(small, 2997);
+    intSetAdd(small, 3000);
+    ASSERT_TEST(intSetForEachCommon(small, big, countCommonNumber, &common) == 3); // 0, 300, 2997
+    ASSERT_TEST(common.count == 3 && common.ascending && common.last == 2997);
+    common.count = 0;
+    ASSERT_TEST(intSetForEachCommon(big, small, countCommonNumber, &common) == 3); // the order does not matter
+    ASSERT_TEST(common.count == 3 && common.ascending);
+    common.count = 0;
+    ASSERT_TEST(intSetForEachCommon(big, big, countCommonNumber, &common) == 1000);
+    ASSERT_TEST(common.count == 1000 && common.ascending && common.last == 2997);
+    intSetDestroy(small);
+    intSetDestroy(big);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testIntSetCreate);
+    RUN_TEST(testIntSetAdd);
+    RUN_TEST(testIntSetIsIn);
+    RUN_TEST(testIntSetRemove);
+    RUN_TEST(testIntSetCopy);
+    RUN_TEST(testIntSetForeach);
+    RUN_TEST(testIntSetForEachCommon);
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <string.h>
+#include "test_utilities.h"
+#include "../name_pool.h"
+
+static bool testNamePoolCreate() {
+    //NamePool namePoolCreate();
+    NamePool pool = namePoolCreate();
+    ASSERT_TEST(pool != NULL);
+    ASSERT_TEST(namePoolGetSize(pool) == 0);
+    ASSERT_TEST(namePoolGetSize(NULL) == -1);
+    namePoolDestroy(pool);
+    return true;
+}
+
+static bool testNamePoolIntern() {
+    //Name namePoolIntern(NamePool pool, const char* string);
+    NamePool pool = namePoolCreate();
+    char buffer[] = "Ariel";
+    Name ariel = namePoolIntern(pool, buffer);
+    ASSERT_TEST(ariel != NULL);
+    strcpy(buffer, "Eran"); // the pool keeps its own copy
+    ASSERT_TEST(strcmp(nameGetString(ariel), "Ariel") == 0);
+    Name eran = namePoolIntern(pool, "Eran");
+    Name ariel_again = namePoolIntern(pool, "Ariel");
+    ASSERT_TEST(ariel_again == ariel); // equal names are the same handle
+    ASSERT_TEST(eran != ariel);
+    ASSERT_TEST(namePoolGetSize(pool) == 2);
+    ASSERT_TEST(namePoolIntern(pool, NULL) == NULL);
+
+    // names without a pool are not shared
+    Name unshared = namePoolIntern(NULL, "Ariel");
+    ASSERT_TEST(unshared != NULL && unshared != ariel);
+    ASSERT_TEST(strcmp(nameGetString(unshared), "Ariel") == 0);
+    ASSERT_TEST(nameGetString(NULL) == NULL);
+
+    nameRelease(unshared);
+    nameRelease(ariel);
+    nameRelease(ariel_again);
+    nameRelease(eran);
+    namePoolDestroy(pool);
+    return true;
+}
+
+static bool testNameRelease() {
+    //void nameRelease(Name name);
+    NamePool pool = namePoolCreate();
+    Name name = namePoolIntern(pool, "Wershal");
+    ASSERT_TEST(nameRetain(name) == name);
+    nameRelease(name);
+    ASSERT_TEST(namePoolGetSize(pool) == 1); // still held once
+    nameRelease(name);
+    ASSERT_TEST(namePoolGetSize(pool) == 0);
+    nameRelease(NULL);
+    ASSERT_TEST(nameRetain(NULL) == NULL);
+
+    // more names than the initial number of buckets
+    Name names[500];
+    char string[10];
+    for (int i = 0; i < 500; i++) {
+        sprintf(string, "name%d", i);
+        names[i] = namePoolIntern(pool, string);
+        ASSERT_TEST(names[i] != NULL);
+    }
+    ASSERT_TEST(namePoolGetSize(pool) == 500);
+    ASSERT_TEST(namePoolIntern(pool, "name123") == names[123]);
+    nameRelease(names[123]);
+    for (int i = 0; i < 250; i++) {
+        nameRelease(names[i]);
+    }
+    ASSERT_TEST(namePoolGetSize(pool) == 250);
+
+    // names that outlive their pool
+    namePoolDestroy(pool);
+    ASSERT_TEST(strcmp(nameGetString(names[499]), "name499") == 0);
+    for (int i = 250; i < 500; i++) {
+        nameRelease(names[i]);
+    }
+    return true;
+}
+
+int main() {
+    RUN_TEST(testNamePoolCreate);
+    RUN_TEST(testNamePoolIntern);
+    RUN_TEST(testNameRelease);
+    return 0;
+}
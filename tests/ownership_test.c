@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../ownership.h"
+
+static int copy_calls = 0;
+
+static void* copyTestInt(void* element) {
+    if (element == NULL) return NULL;
+    if (isElementAdopted(element)) return element;
+    copy_calls++;
+    int* new_int = malloc(sizeof(*new_int));
+    if (new_int == NULL) return NULL;
+    *new_int = *(int*)element;
+    return new_int;
+}
+
+static void destroyTestInt(void* element) {
+    free(element);
+}
+
+static int compareTestInt(void* element1, void* element2) {
+    return *(int*)element1 - *(int*)element2;
+}
+
+static int* createTestInt(int value) {
+    int* new_int = malloc(sizeof(*new_int));
+    if (new_int != NULL) {
+        *new_int = value;
+    }
+    return new_int;
+}
+
+static bool testSetAddTake() {
+    //SetResult setAddTake(Set set, SetElement element);
+    Set set = setCreate(copyTestInt, destroyTestInt, compareTestInt);
+    copy_calls = 0;
+    int* number = createTestInt(5);
+    ASSERT_TEST(setAddTake(set, number) == SET_SUCCESS);
+    ASSERT_TEST(setGetFirst(set) == number); // the set holds the element itself
+    ASSERT_TEST(copy_calls == 0);
+
+    int* duplicate = createTestInt(5);
+    ASSERT_TEST(setAddTake(set, duplicate) == SET_ITEM_ALREADY_EXISTS);
+    free(duplicate); // still owned by the caller
+    ASSERT_TEST(setAddTake(set, NULL) == SET_NULL_ARGUMENT);
+
+    // a regular add still copies
+    int value = 7;
+    ASSERT_TEST(setAdd(set, &value) == SET_SUCCESS);
+    ASSERT_TEST(copy_calls == 1);
+    ASSERT_TEST(setGetSize(set) == 2);
+
+    setDestroy(set);
+    return true;
+}
+
+static bool testListInsertLastTake() {
+    //ListResult listInsertLastTake(List list, ListElement element);
+    List list = listCreate(copyTestInt, destroyTestInt);
+    copy_calls = 0;
+    int* first = createTestInt(1);
+    int* second = createTestInt(2);
+    ASSERT_TEST(listInsertLastTake(list, first) == LIST_SUCCESS);
+    ASSERT_TEST(listInsertLastTake(list, second) == LIST_SUCCESS);
+    ASSERT_TEST(copy_calls == 0);
+    ASSERT_TEST(listGetFirst(list) == first);
+    ASSERT_TEST(listGetNext(list) == second);
+
+    // copying the list still makes deep copies
+    List copy = listCopy(list);
+    ASSERT_TEST(copy_calls == 2);
+    ASSERT_TEST(listGetFirst(copy) != first);
+
+    listDestroy(copy);
+    listDestroy(list);
+    return true;
+}
+
+static bool testIsElementAdopted() {
+    //bool isElementAdopted(void* element);
+    int value = 3;
+    ASSERT_TEST(isElementAdopted(&value) == false);
+    ASSERT_TEST(isElementAdopted(NULL) == false);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testSetAddTake);
+    RUN_TEST(testListInsertLastTake);
+    RUN_TEST(testIsElementAdopted);
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <stdlib.h>
+#include <string.h>
+#include "test_utilities.h"
+#include "../report_cache.h"
+
+#define SMALL_BUDGET 512
+#define MANY_STUDENTS 1000
+
+/** The report a test renderer prints, with the number of times it was rendered */
+typedef struct test_report_t {
+    const char* text;
+    int renders;
+    bool out_of_memory;
+} test_report_t;
+
+static bool renderTestReport(void* context, FILE* output_channel) {
+    test_report_t* report = context;
+    report->renders++;
+    if (report->out_of_memory) return false;
+    fprintf(output_channel, "%s\n", report->text);
+    return true;
+}
+
+static bool testReportCacheCreate() {
+    //ReportCache reportCacheCreate(size_t budget);
+    ReportCache cache = reportCacheCreate(SMALL_BUDGET);
+    ASSERT_TEST(cache != NULL);
+    ASSERT_TEST(reportCacheGetCount(cache) == 0);
+    ASSERT_TEST(reportCacheGetBytes(cache) == 0);
+    ASSERT_TEST(!reportCacheContains(cache, 111111118, REPORT_KIND_FULL, 0));
+    ASSERT_TEST(reportCacheGetCount(NULL) == -1);
+    ASSERT_TEST(reportCacheGetBytes(NULL) == 0);
+    reportCacheDestroy(cache);
+    return true;
+}
+
+static bool testReportCachePrint() {
+    //ReportCacheResult reportCachePrint(ReportCache cache, int student_id, ReportKind kind, unsigned int version,
+    //                                   ReportRenderer renderer, void* context, FILE* output_channel);
+    ReportCache cache = reportCacheCreate(SMALL_BUDGET);
+    test_report_t report = {"full report, version 0", 0, false};
+    ASSERT_TEST(reportCachePrint(NULL, 1, REPORT_KIND_FULL, 0, renderTestReport, &report, stdout) ==
+                REPORT_CACHE_NULL_ARGUMENT);
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, NULL, &report, stdout) == REPORT_CACHE_NULL_ARGUMENT);
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, renderTestReport, &report, NULL) ==
+                REPORT_CACHE_NULL_ARGUMENT);
+    printf("\n");
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, renderTestReport, &report, stdout) ==
+                REPORT_CACHE_OK);
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, renderTestReport, &report, stdout) ==
+                REPORT_CACHE_OK);
+    // should print
+    /**
+    full report, version 0
+    full report, version 0
+     */
+    ASSERT_TEST(report.renders == 1);
+    ASSERT_TEST(reportCacheContains(cache, 1, REPORT_KIND_FULL, 0));
+    ASSERT_TEST(!reportCacheContains(cache, 1, REPORT_KIND_CLEAN, 0));
+    // a new version is rendered again, and replaces the old one
+    report.text = "full report, version 1";
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 1, renderTestReport, &report, stdout) ==
+                REPORT_CACHE_OK);
+    // should print
+    /**
+    full report, version 1
+     */
+    ASSERT_TEST(report.renders == 2);
+    ASSERT_TEST(reportCacheGetCount(cache) == 1);
+    ASSERT_TEST(!reportCacheContains(cache, 1, REPORT_KIND_FULL, 0));
+    ASSERT_TEST(reportCacheContains(cache, 1, REPORT_KIND_FULL, 1));
+    // a memory error of the renderer prints nothing, and caches nothing
+    test_report_t failing_report = {"clean report", 0, true};
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_CLEAN, 1, renderTestReport, &failing_report, stdout) ==
+                REPORT_CACHE_OUT_OF_MEMORY);
+    ASSERT_TEST(!reportCacheContains(cache, 1, REPORT_KIND_CLEAN, 1));
+    reportCacheDestroy(cache);
+    return true;
+}
+
+static bool testReportCacheScratchReuse() {
+    // the reports are rendered into the same scratch file, so a short report must not keep the end of a longer one
+    ReportCache cache = reportCacheCreate(SMALL_BUDGET);
+    test_report_t long_report = {"a long report of the first student", 0, false};
+    test_report_t short_report = {"short", 0, false};
+    FILE* output_channel = tmpfile();
+    ASSERT_TEST(output_channel != NULL);
+    reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, renderTestReport, &long_report, output_channel);
+    reportCachePrint(cache, 2, REPORT_KIND_FULL, 0, renderTestReport, &short_report, output_channel);
+    reportCachePrint(cache, 2, REPORT_KIND_FULL, 0, renderTestReport, &short_report, output_channel);
+    ASSERT_TEST(short_report.renders == 1);
+    const char* expected = "a long report of the first student\nshort\nshort\n";
+    char printed[SMALL_BUDGET] = {0};
+    rewind(output_channel);
+    ASSERT_TEST(fread(printed, 1, sizeof(printed) - 1, output_channel) == strlen(expected));
+    ASSERT_TEST(strcmp(printed, expected) == 0);
+    fclose(output_channel);
+    reportCacheDestroy(cache);
+    return true;
+}
+
+static bool testReportCacheBudget() {
+    ReportCache cache = reportCacheCreate(SMALL_BUDGET);
+    test_report_t report = {"a report that is printed by many students", 0, false};
+    FILE* output_channel = tmpfile();
+    ASSERT_TEST(output_channel != NULL);
+    for (int id = 1; id <= MANY_STUDENTS; id++) {
+        ASSERT_TEST(reportCachePrint(cache, id, REPORT_KIND_CLEAN, 0, renderTestReport, &report, output_channel) ==
+                    REPORT_CACHE_OK);
+        ASSERT_TEST(reportCacheGetBytes(cache) <= SMALL_BUDGET);
+        // printing the first report keeps it the most recent one, so it is never dropped
+        ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_CLEAN, 0, renderTestReport, &report, output_channel) ==
+                    REPORT_CACHE_OK);
+    }
+    ASSERT_TEST(report.renders == MANY_STUDENTS);
+    ASSERT_TEST(reportCacheGetCount(cache) > 1 && reportCacheGetCount(cache) < MANY_STUDENTS);
+    ASSERT_TEST(reportCacheContains(cache, 1, REPORT_KIND_CLEAN, 0));
+    ASSERT_TEST(reportCacheContains(cache, MANY_STUDENTS, REPORT_KIND_CLEAN, 0));
+    ASSERT_TEST(!reportCacheContains(cache, 2, REPORT_KIND_CLEAN, 0));
+    fclose(output_channel);
+    reportCacheDestroy(cache);
+    // a report larger than the whole budget is printed, but not cached
+    cache = reportCacheCreate(8);
+    printf("\n");
+    ASSERT_TEST(reportCachePrint(cache, 1, REPORT_KIND_FULL, 0, renderTestReport, &report, stdout) ==
+                REPORT_CACHE_OK);
+    // should print
+    /**
+    a report that is printed by many students
+     */
+    ASSERT_TEST(reportCacheGetCount(cache) == 0);
+    ASSERT_TEST(reportCacheGetBytes(cache) == 0);
+    reportCacheDestroy(cache);
+    return true;
+}
+
+static bool testReportCacheRemoveStudent() {
+    //void reportCacheRemoveStudent(ReportCache cache, int student_id);
+    ReportCache cache = reportCacheCreate(SMALL_BUDGET);
+    test_report_t report = {"report", 0, false};
+    FILE* output_channel = tmpfile();
+    ASSERT_TEST(output_channel != NULL);
+    reportCachePrint(cache, 1, REPORT_KIND_FULL, 3, renderTestReport, &report, output_channel);
+    reportCachePrint(cache, 1, REPORT_KIND_CLEAN, 3, renderTestReport, &report, output_channel);
+    reportCachePrint(cache, 2, REPORT_KIND_CLEAN, 0, renderTestReport, &report, output_channel);
+    reportCacheRemoveStudent(cache, 1);
+    reportCacheRemoveStudent(cache, 3);
+    reportCacheRemoveStudent(NULL, 1);
+    ASSERT_TEST(reportCacheGetCount(cache) == 1);
+    ASSERT_TEST(!reportCacheContains(cache, 1, REPORT_KIND_FULL, 3));
+    ASSERT_TEST(!reportCacheContains(cache, 1, REPORT_KIND_CLEAN, 3));
+    ASSERT_TEST(reportCacheContains(cache, 2, REPORT_KIND_CLEAN, 0));
+    fclose(output_channel);
+    reportCacheDestroy(cache);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testReportCacheCreate);
+    RUN_TEST(testReportCachePrint);
+    RUN_TEST(testReportCacheScratchReuse);
+    RUN_TEST(testReportCacheBudget);
+    RUN_TEST(testReportCacheRemoveStudent);
+    return 0;
+}
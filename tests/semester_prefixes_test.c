@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../semester_prefixes.h"
+
+#define MANY_SEMESTERS 100
+
+static bool testSemesterPrefixesCreate() {
+    //SemesterPrefixes semesterPrefixesCreate();
+    SemesterPrefixes prefixes = semesterPrefixesCreate();
+    ASSERT_TEST(prefixes != NULL);
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == 0);
+    ASSERT_TEST(semesterPrefixesGetCount(NULL) == -1);
+    int semester_number, points_x2, grade_sum_x2;
+    ASSERT_TEST(!semesterPrefixesGet(prefixes, 0, &semester_number, &points_x2, &grade_sum_x2));
+    semesterPrefixesDestroy(prefixes);
+    return true;
+}
+
+static bool testSemesterPrefixesAppend() {
+    //SemesterPrefixesResult semesterPrefixesAppend(SemesterPrefixes prefixes, int semester_number, int points_x2,
+    //                                              int grade_sum_x2);
+    SemesterPrefixes prefixes = semesterPrefixesCreate();
+    ASSERT_TEST(semesterPrefixesAppend(NULL, 1, 6, 480) == SEMESTER_PREFIXES_NULL_ARGUMENT);
+    ASSERT_TEST(semesterPrefixesAppend(prefixes, 1, 6, 480) == SEMESTER_PREFIXES_OK);
+    ASSERT_TEST(semesterPrefixesAppend(prefixes, 1, 8, 660) == SEMESTER_PREFIXES_INVALID_PARAMETER);
+    ASSERT_TEST(semesterPrefixesAppend(prefixes, 4, 8, 660) == SEMESTER_PREFIXES_OK);
+    ASSERT_TEST(semesterPrefixesAppend(prefixes, 3, 8, 660) == SEMESTER_PREFIXES_INVALID_PARAMETER);
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == 2);
+    int semester_number, points_x2, grade_sum_x2;
+    ASSERT_TEST(semesterPrefixesGet(prefixes, 1, &semester_number, &points_x2, &grade_sum_x2));
+    ASSERT_TEST(semester_number == 4 && points_x2 == 8 && grade_sum_x2 == 660);
+    ASSERT_TEST(semesterPrefixesGet(prefixes, 0, &semester_number, &points_x2, &grade_sum_x2));
+    ASSERT_TEST(semester_number == 1 && points_x2 == 6 && grade_sum_x2 == 480);
+    ASSERT_TEST(!semesterPrefixesGet(prefixes, 2, &semester_number, &points_x2, &grade_sum_x2));
+    ASSERT_TEST(!semesterPrefixesGet(prefixes, -1, &semester_number, &points_x2, &grade_sum_x2));
+    ASSERT_TEST(!semesterPrefixesGet(prefixes, 0, NULL, &points_x2, &grade_sum_x2));
+    semesterPrefixesDestroy(prefixes);
+    return true;
+}
+
+static bool testSemesterPrefixesInvalidateFrom() {
+    //void semesterPrefixesInvalidateFrom(SemesterPrefixes prefixes, int semester_number);
+    SemesterPrefixes prefixes = semesterPrefixesCreate();
+    for (int i = 1; i <= MANY_SEMESTERS; i++) {
+        ASSERT_TEST(semesterPrefixesAppend(prefixes, i * 2, i, i * 100) == SEMESTER_PREFIXES_OK);
+    }
+    semesterPrefixesInvalidateFrom(prefixes, MANY_SEMESTERS * 2 + 1); // after all the semesters
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == MANY_SEMESTERS);
+    semesterPrefixesInvalidateFrom(prefixes, 21); // a semester without a prefix - the ones after it are invalid
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == 10);
+    semesterPrefixesInvalidateFrom(prefixes, 20);
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == 9);
+    // the invalid prefixes are written over
+    ASSERT_TEST(semesterPrefixesAppend(prefixes, 19, 7, 700) == SEMESTER_PREFIXES_OK);
+    int semester_number, points_x2, grade_sum_x2;
+    ASSERT_TEST(semesterPrefixesGet(prefixes, 9, &semester_number, &points_x2, &grade_sum_x2));
+    ASSERT_TEST(semester_number == 19 && points_x2 == 7 && grade_sum_x2 == 700);
+    semesterPrefixesInvalidateFrom(prefixes, 1);
+    ASSERT_TEST(semesterPrefixesGetCount(prefixes) == 0);
+    semesterPrefixesInvalidateFrom(NULL, 1);
+    semesterPrefixesDestroy(prefixes);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testSemesterPrefixesCreate);
+    RUN_TEST(testSemesterPrefixesAppend);
+    RUN_TEST(testSemesterPrefixesInvalidateFrom);
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../semester_table.h"
+
+static bool testSemesterTableCreate() {
+    //SemesterTable semesterTableCreate();
+    SemesterTable table = semesterTableCreate();
+    ASSERT_TEST(table != NULL);
+    ASSERT_TEST(semesterTableGetSize(table) == 0);
+    ASSERT_TEST(semesterTableGet(table, 1) == NULL);
+    ASSERT_TEST(semesterTableNext(table, 0) == NULL);
+    ASSERT_TEST(semesterTableGetSize(NULL) == -1);
+    semesterTableDestroy(table);
+    return true;
+}
+
+static bool testSemesterTableAdd() {
+    //SemesterTableResult semesterTableAdd(SemesterTable table, int semester_number, CourseCatalog courses,
+    //                                     Semester *semester);
+    SemesterTable table = semesterTableCreate();
+    Semester semester1 = NULL, semester5 = NULL, semester_huge = NULL, other = NULL;
+    ASSERT_TEST(semesterTableAdd(table, 5, NULL, &semester5) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableAdd(table, 1, NULL, &semester1) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableAdd(table, 2000000000, NULL, &semester_huge) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableAdd(table, 5, NULL, &other) == SEMESTER_TABLE_SEMESTER_ALREADY_EXISTS);
+    ASSERT_TEST(semesterTableAdd(table, 0, NULL, &other) == SEMESTER_TABLE_INVALID_PARAMETER);
+    ASSERT_TEST(semesterTableAdd(table, -3, NULL, &other) == SEMESTER_TABLE_INVALID_PARAMETER);
+    ASSERT_TEST(semesterTableAdd(NULL, 3, NULL, &other) == SEMESTER_TABLE_NULL_ARGUMENT);
+    ASSERT_TEST(semesterTableAdd(table, 3, NULL, NULL) == SEMESTER_TABLE_NULL_ARGUMENT);
+    ASSERT_TEST(other == NULL);
+    ASSERT_TEST(semesterTableGetSize(table) == 3);
+    ASSERT_TEST(semesterTableGet(table, 5) == semester5);
+    ASSERT_TEST(semesterTableGet(table, 1) == semester1);
+    ASSERT_TEST(semesterTableGet(table, 2000000000) == semester_huge);
+    ASSERT_TEST(semesterTableGet(table, 4) == NULL);
+    ASSERT_TEST(semesterTableGet(table, 100) == NULL);
+    ASSERT_TEST(semesterTableGet(table, 0) == NULL);
+    ASSERT_TEST(semesterTableGet(NULL, 1) == NULL);
+    ASSERT_TEST(semesterGetNumber(semester5) == 5);
+    ASSERT_TEST(semesterAddGrade(semester5, 104012, "3.5", 90) == SEMESTER_OK);
+    ASSERT_TEST(semesterGetCourseLastGrade(semesterTableGet(table, 5), 104012) == 90);
+    semesterTableDestroy(table);
+    return true;
+}
+
+static bool testSemesterTableRemove() {
+    //SemesterTableResult semesterTableRemove(SemesterTable table, int semester_number);
+    SemesterTable table = semesterTableCreate();
+    Semester semester = NULL;
+    ASSERT_TEST(semesterTableRemove(table, 1) == SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST);
+    ASSERT_TEST(semesterTableAdd(table, 1, NULL, &semester) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableAdd(table, 3000, NULL, &semester) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableRemove(table, 1) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableRemove(table, 1) == SEMESTER_TABLE_SEMESTER_DOES_NOT_EXIST);
+    ASSERT_TEST(semesterTableRemove(NULL, 3000) == SEMESTER_TABLE_NULL_ARGUMENT);
+    ASSERT_TEST(semesterTableGet(table, 1) == NULL);
+    ASSERT_TEST(semesterTableGetSize(table) == 1);
+    ASSERT_TEST(semesterTableRemove(table, 3000) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterTableGetSize(table) == 0);
+    ASSERT_TEST(semesterTableNext(table, 0) == NULL);
+    semesterTableDestroy(table);
+    return true;
+}
+
+static bool testSemesterTableForeach() {
+    //SEMESTER_TABLE_FOREACH(iterator, table)
+    SemesterTable table = semesterTableCreate();
+    int semesters[] = {7, 2000000000, 1, 1024, 3, 1023, 50000};
+    int sorted_semesters[] = {1, 3, 7, 1023, 1024, 50000, 2000000000};
+    Semester semester = NULL;
+    for (int i = 0; i < 7; i++) {
+        ASSERT_TEST(semesterTableAdd(table, semesters[i], NULL, &semester) == SEMESTER_TABLE_OK);
+    }
+    int counter = 0;
+    SEMESTER_TABLE_FOREACH(current_semester, table) {
+        ASSERT_TEST(semesterGetNumber(current_semester) == sorted_semesters[counter]);
+        counter++;
+    }
+    ASSERT_TEST(counter == 7);
+    ASSERT_TEST(semesterGetNumber(semesterTableNext(table, 7)) == 1023);
+    ASSERT_TEST(semesterGetNumber(semesterTableNext(table, 1024)) == 50000);
+    ASSERT_TEST(semesterTableNext(table, 2000000000) == NULL);
+    ASSERT_TEST(semesterTableNext(NULL, 0) == NULL);
+    semesterTableDestroy(table);
+    return true;
+}
+
+static bool testSemesterTableCopy() {
+    //SemesterTable semesterTableCopy(SemesterTable table);
+    SemesterTable table = semesterTableCreate();
+    Semester semester = NULL;
+    ASSERT_TEST(semesterTableAdd(table, 2, NULL, &semester) == SEMESTER_TABLE_OK);
+    ASSERT_TEST(semesterAddGrade(semester, 104012, "3.5", 90) == SEMESTER_OK);
+    ASSERT_TEST(semesterTableAdd(table, 5000, NULL, &semester) == SEMESTER_TABLE_OK);
+    SemesterTable copy = semesterTableCopy(table);
+    ASSERT_TEST(copy != NULL);
+    ASSERT_TEST(semesterTableGetSize(copy) == 2);
+    ASSERT_TEST(semesterTableGet(copy, 2) != semesterTableGet(table, 2));
+    ASSERT_TEST(semesterTableRemove(table, 2) == SEMESTER_TABLE_OK);
+    // the copy is not affected
+    ASSERT_TEST(semesterGetCourseLastGrade(semesterTableGet(copy, 2), 104012) == 90);
+    ASSERT_TEST(semesterGetNumber(semesterTableGet(copy, 5000)) == 5000);
+    ASSERT_TEST(semesterTableCopy(NULL) == NULL);
+    semesterTableDestroy(table);
+    semesterTableDestroy(copy);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testSemesterTableCreate);
+    RUN_TEST(testSemesterTableAdd);
+    RUN_TEST(testSemesterTableRemove);
+    RUN_TEST(testSemesterTableForeach);
+    RUN_TEST(testSemesterTableCopy);
+    return 0;
+}
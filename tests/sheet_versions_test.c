@@ -0,0 +1,170 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../sheet_versions.h"
+
+#define MANY_VERSIONS 100
+
+static bool testSheetVersionsCreate() {
+    //SheetVersions sheetVersionsCreate();
+    SheetVersions versions = sheetVersionsCreate();
+    ASSERT_TEST(versions != NULL);
+    ASSERT_TEST(sheetVersionsGetCount(versions) == 0);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 10) == 0);
+    ASSERT_TEST(sheetVersionsGetCount(NULL) == -1);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(NULL, 10) == -1);
+    sheetVersionsDestroy(versions);
+    return true;
+}
+
+static bool testSheetVersionsRecordSemester() {
+    //SheetVersionsResult sheetVersionsRecordSemester(SheetVersions versions, int sequence, int semester_number,
+    //                                                Semester semester);
+    SheetVersions versions = sheetVersionsCreate();
+    Semester semester1 = NULL, semester2 = NULL;
+    semesterCreate(1, &semester1);
+    semesterCreate(2, &semester2);
+    semesterAddGrade(semester1, 234122, "3", 80);
+    ASSERT_TEST(sheetVersionsRecordSemester(NULL, 1, 1, semester1) == SHEET_VERSIONS_NULL_ARGUMENT);
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 1, 0, semester1) == SHEET_VERSIONS_INVALID_PARAMETER);
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 1, 1, semester1) == SHEET_VERSIONS_OK);
+    semesterAddGrade(semester2, 104012, "5.5", 90);
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 3, 2, semester2) == SHEET_VERSIONS_OK);
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 2, 2, semester2) == SHEET_VERSIONS_INVALID_PARAMETER);
+    // a removed semester
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 5, 1, NULL) == SHEET_VERSIONS_OK);
+    ASSERT_TEST(sheetVersionsGetCount(versions) == 3);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 0) == 0);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 1) == 1);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 2) == 1);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 3) == 2);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 4) == 2);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 5) == 1);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 100) == 1);
+    // a version with the same sequence number replaces the last one
+    ASSERT_TEST(sheetVersionsRecordSemester(versions, 5, 1, semester1) == SHEET_VERSIONS_OK);
+    ASSERT_TEST(sheetVersionsGetCount(versions) == 3);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 5) == 2);
+    semesterDestroy(semester1);
+    semesterDestroy(semester2);
+    sheetVersionsDestroy(versions);
+    return true;
+}
+
+static bool testSheetVersionsRecordEmpty() {
+    //SheetVersionsResult sheetVersionsRecordEmpty(SheetVersions versions, int sequence);
+    SheetVersions versions = sheetVersionsCreate();
+    Semester semester = NULL;
+    semesterCreate(1, &semester);
+    semesterAddGrade(semester, 234122, "3", 80);
+    sheetVersionsRecordSemester(versions, 1, 1, semester);
+    sheetVersionsRecordSemester(versions, 1, 2, semester);
+    ASSERT_TEST(sheetVersionsRecordEmpty(NULL, 2) == SHEET_VERSIONS_NULL_ARGUMENT);
+    ASSERT_TEST(sheetVersionsRecordEmpty(versions, 0) == SHEET_VERSIONS_INVALID_PARAMETER);
+    ASSERT_TEST(sheetVersionsRecordEmpty(versions, 2) == SHEET_VERSIONS_OK);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 1) == 2);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, 2) == 0);
+    semesterDestroy(semester);
+    sheetVersionsDestroy(versions);
+    return true;
+}
+
+static bool testSheetVersionsPrint() {
+    //SheetVersionsResult sheetVersionsPrintFull(SheetVersions versions, int sequence, FILE* output_channel);
+    //SheetVersionsResult sheetVersionsPrintClean(SheetVersions versions, int sequence, FILE* output_channel);
+    SheetVersions versions = sheetVersionsCreate();
+    Semester semester1 = NULL, semester2 = NULL;
+    semesterCreate(1, &semester1);
+    semesterCreate(2, &semester2);
+    semesterAddGrade(semester1, 234122, "3", 40);
+    semesterAddGrade(semester1, 394808, "1", 90);
+    sheetVersionsRecordSemester(versions, 1, 1, semester1);
+    semesterAddGrade(semester2, 234122, "3", 85);
+    semesterAddGrade(semester2, 394808, "1", 70);
+    sheetVersionsRecordSemester(versions, 2, 2, semester2);
+    // a change of the semester after it was recorded does not change the recorded versions
+    semesterUpdateGrade(semester1, 234122, 100);
+    ASSERT_TEST(sheetVersionsPrintFull(NULL, 1, stdout) == SHEET_VERSIONS_NULL_ARGUMENT);
+    ASSERT_TEST(sheetVersionsPrintClean(versions, 1, NULL) == SHEET_VERSIONS_NULL_ARGUMENT);
+    printf("\n");
+    ASSERT_TEST(sheetVersionsPrintFull(versions, 1, stdout) == SHEET_VERSIONS_OK);
+    // should print
+    /**
+    Course: 234122		Points: 3.0		Grade: 40
+    Course: 394808		Points: 1.0		Grade: 90
+    ========================================
+    Semester 1		Points: 4.0		Average: 52.50		Success: 25%
+
+    Points: 4.0		Average: 52.50		Success: 25%
+     */
+    ASSERT_TEST(sheetVersionsPrintClean(versions, 2, stdout) == SHEET_VERSIONS_OK);
+    // should print
+    /**
+    Course: 234122		Points: 3.0		Grade: 85
+    Course: 394808		Points: 1.0		Grade: 90
+    Course: 394808		Points: 1.0		Grade: 70
+    ========================================
+    Points: 5.0		Average: 83.00
+     */
+    ASSERT_TEST(sheetVersionsPrintClean(versions, 0, stdout) == SHEET_VERSIONS_OK);
+    // should print
+    /**
+    ========================================
+    Points: 0.0		Average: 0.00
+     */
+    semesterDestroy(semester1);
+    semesterDestroy(semester2);
+    sheetVersionsDestroy(versions);
+    return true;
+}
+
+static bool testSheetVersionsCopy() {
+    //SheetVersions sheetVersionsCopy(SheetVersions versions);
+    ASSERT_TEST(sheetVersionsCopy(NULL) == NULL);
+    SheetVersions versions = sheetVersionsCreate();
+    Semester semester = NULL;
+    semesterCreate(1, &semester);
+    semesterAddGrade(semester, 234122, "3", 80);
+    sheetVersionsRecordSemester(versions, 1, 1, semester);
+    sheetVersionsRecordSemester(versions, 2, 3, semester);
+    SheetVersions copy = sheetVersionsCopy(versions);
+    ASSERT_TEST(copy != NULL);
+    // the copy keeps the shared versions after the original is destroyed, and records its own versions
+    sheetVersionsDestroy(versions);
+    ASSERT_TEST(sheetVersionsGetCount(copy) == 2);
+    ASSERT_TEST(sheetVersionsRecordSemester(copy, 3, 2, semester) == SHEET_VERSIONS_OK);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(copy, 1) == 1);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(copy, 2) == 2);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(copy, 3) == 3);
+    semesterDestroy(semester);
+    sheetVersionsDestroy(copy);
+    return true;
+}
+
+static bool testSheetVersionsManyVersions() {
+    SheetVersions versions = sheetVersionsCreate();
+    Semester semester = NULL;
+    semesterCreate(1, &semester);
+    semesterAddGrade(semester, 234122, "3", 80);
+    for (int i = 0; i < MANY_VERSIONS; i++) { // every version adds a semester, every other sequence number
+        ASSERT_TEST(sheetVersionsRecordSemester(versions, i * 2, i + 1, semester) == SHEET_VERSIONS_OK);
+    }
+    ASSERT_TEST(sheetVersionsGetCount(versions) == MANY_VERSIONS);
+    ASSERT_TEST(sheetVersionsGetSemesterCount(versions, -1) == 0);
+    for (int i = 0; i < MANY_VERSIONS; i++) {
+        ASSERT_TEST(sheetVersionsGetSemesterCount(versions, i * 2) == i + 1);
+        ASSERT_TEST(sheetVersionsGetSemesterCount(versions, i * 2 + 1) == i + 1);
+    }
+    semesterDestroy(semester);
+    sheetVersionsDestroy(versions);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testSheetVersionsCreate);
+    RUN_TEST(testSheetVersionsRecordSemester);
+    RUN_TEST(testSheetVersionsRecordEmpty);
+    RUN_TEST(testSheetVersionsPrint);
+    RUN_TEST(testSheetVersionsCopy);
+    RUN_TEST(testSheetVersionsManyVersions);
+    return 0;
+}
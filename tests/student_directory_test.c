@@ -0,0 +1,119 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../student_directory.h"
+
+#define MANY_STUDENTS 500
+
+static bool testStudentDirectoryCreate() {
+    //StudentDirectory studentDirectoryCreate();
+    StudentDirectory directory = studentDirectoryCreate();
+    ASSERT_TEST(directory != NULL);
+    ASSERT_TEST(studentDirectoryGetSize(directory) == 0);
+    ASSERT_TEST(studentDirectoryGetSlotCount(directory) == 0);
+    ASSERT_TEST(studentDirectoryGet(directory, 100) == NULL);
+    ASSERT_TEST(studentDirectoryGetSlot(directory, 100) == -1);
+    ASSERT_TEST(studentDirectoryGetSize(NULL) == -1);
+    ASSERT_TEST(studentDirectoryGetSlotCount(NULL) == -1);
+    studentDirectoryDestroy(directory);
+    return true;
+}
+
+static bool testStudentDirectoryAdd() {
+    //StudentDirectoryResult studentDirectoryAdd(StudentDirectory directory, Student student);
+    StudentDirectory directory = studentDirectoryCreate();
+    Student student1 = NULL, student2 = NULL;
+    studentCreate(100, "Harry", "Potter", &student1);
+    studentCreate(200, "Ron", "Weasley", &student2);
+    ASSERT_TEST(studentDirectoryAdd(NULL, student1) == STUDENT_DIRECTORY_NULL_ARGUMENT);
+    ASSERT_TEST(studentDirectoryAdd(directory, NULL) == STUDENT_DIRECTORY_NULL_ARGUMENT);
+    ASSERT_TEST(studentDirectoryAdd(directory, student1) == STUDENT_DIRECTORY_OK);
+    ASSERT_TEST(studentDirectoryAdd(directory, student1) == STUDENT_DIRECTORY_STUDENT_ALREADY_EXISTS);
+    ASSERT_TEST(studentDirectoryAdd(directory, student2) == STUDENT_DIRECTORY_OK);
+    ASSERT_TEST(studentDirectoryGetSize(directory) == 2);
+    ASSERT_TEST(studentDirectoryGet(directory, 100) == student1);
+    ASSERT_TEST(studentDirectoryGet(directory, 200) == student2);
+    ASSERT_TEST(studentDirectoryGet(directory, 300) == NULL);
+    ASSERT_TEST(studentDirectoryGet(NULL, 100) == NULL);
+    int slot1 = studentDirectoryGetSlot(directory, 100);
+    int slot2 = studentDirectoryGetSlot(directory, 200);
+    ASSERT_TEST(slot1 >= 0 && slot1 < studentDirectoryGetSlotCount(directory));
+    ASSERT_TEST(slot2 >= 0 && slot2 < studentDirectoryGetSlotCount(directory));
+    ASSERT_TEST(slot1 != slot2);
+    ASSERT_TEST(studentDirectoryGetBySlot(directory, slot1) == student1);
+    ASSERT_TEST(studentDirectoryGetBySlot(directory, slot2) == student2);
+    ASSERT_TEST(studentDirectoryGetBySlot(directory, 2) == NULL);
+    ASSERT_TEST(studentDirectoryGetBySlot(directory, -1) == NULL);
+    studentDirectoryDestroy(directory); // the students are not destroyed with the directory
+    studentDestroy(student1);
+    studentDestroy(student2);
+    return true;
+}
+
+static bool testStudentDirectoryRemove() {
+    //StudentDirectoryResult studentDirectoryRemove(StudentDirectory directory, int id);
+    StudentDirectory directory = studentDirectoryCreate();
+    Student student1 = NULL, student2 = NULL, student3 = NULL;
+    studentCreate(100, "Harry", "Potter", &student1);
+    studentCreate(200, "Ron", "Weasley", &student2);
+    studentCreate(300, "Hermione", "Granger", &student3);
+    studentDirectoryAdd(directory, student1);
+    studentDirectoryAdd(directory, student2);
+    ASSERT_TEST(studentDirectoryRemove(NULL, 100) == STUDENT_DIRECTORY_NULL_ARGUMENT);
+    ASSERT_TEST(studentDirectoryRemove(directory, 300) == STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST);
+    int removed_slot = studentDirectoryGetSlot(directory, 100);
+    ASSERT_TEST(studentDirectoryRemove(directory, 100) == STUDENT_DIRECTORY_OK);
+    ASSERT_TEST(studentDirectoryRemove(directory, 100) == STUDENT_DIRECTORY_STUDENT_DOES_NOT_EXIST);
+    ASSERT_TEST(studentDirectoryGet(directory, 100) == NULL);
+    ASSERT_TEST(studentDirectoryGetSlot(directory, 100) == -1);
+    ASSERT_TEST(studentDirectoryGet(directory, 200) == student2);
+    ASSERT_TEST(studentDirectoryGetBySlot(directory, removed_slot) == NULL);
+    ASSERT_TEST(studentDirectoryGetSize(directory) == 1);
+    // the slot of the removed student is reused
+    ASSERT_TEST(studentDirectoryAdd(directory, student3) == STUDENT_DIRECTORY_OK);
+    ASSERT_TEST(studentDirectoryGetSlot(directory, 300) == removed_slot);
+    ASSERT_TEST(studentDirectoryGetSlotCount(directory) == 2);
+    studentDirectoryDestroy(directory);
+    studentDestroy(student1);
+    studentDestroy(student2);
+    studentDestroy(student3);
+    return true;
+}
+
+static bool testStudentDirectoryManyStudents() {
+    StudentDirectory directory = studentDirectoryCreate();
+    Student students[MANY_STUDENTS];
+    for (int i = 0; i < MANY_STUDENTS; i++) {
+        students[i] = NULL;
+        ASSERT_TEST(studentCreate((i + 1) * 64, "Neville", "Longbottom", &students[i]) == STUDENT_OK);
+        ASSERT_TEST(studentDirectoryAdd(directory, students[i]) == STUDENT_DIRECTORY_OK);
+    }
+    // remove every other student, so the entries after them have to be moved back
+    for (int i = 0; i < MANY_STUDENTS; i += 2) {
+        ASSERT_TEST(studentDirectoryRemove(directory, (i + 1) * 64) == STUDENT_DIRECTORY_OK);
+    }
+    ASSERT_TEST(studentDirectoryGetSize(directory) == MANY_STUDENTS / 2);
+    bool* used_slots = calloc(MANY_STUDENTS, sizeof(bool));
+    for (int i = 0; i < MANY_STUDENTS; i++) {
+        Student expected = (i % 2 == 0) ? NULL : students[i];
+        ASSERT_TEST(studentDirectoryGet(directory, (i + 1) * 64) == expected);
+        if (expected == NULL) continue;
+        int slot = studentDirectoryGetSlot(directory, (i + 1) * 64);
+        ASSERT_TEST(slot >= 0 && slot < MANY_STUDENTS && !used_slots[slot]);
+        used_slots[slot] = true;
+    }
+    free(used_slots);
+    ASSERT_TEST(studentDirectoryGetSlotCount(directory) == MANY_STUDENTS);
+    studentDirectoryDestroy(directory);
+    for (int i = 0; i < MANY_STUDENTS; i++) {
+        studentDestroy(students[i]);
+    }
+    return true;
+}
+
+int main() {
+    RUN_TEST(testStudentDirectoryCreate);
+    RUN_TEST(testStudentDirectoryAdd);
+    RUN_TEST(testStudentDirectoryRemove);
+    RUN_TEST(testStudentDirectoryManyStudents);
+    return 0;
+}
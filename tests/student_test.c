@@ -20,6 +20,34 @@ static bool testStudentCreate() {
     return true;
 }
 
+static bool testStudentCreateWithSharedData() {
+    //StudentResult studentCreateWithSharedData(int id, char* firstName, char* lastName, NamePool names,
+    //                                         CourseCatalog courses, Student *student);
+    NamePool names = namePoolCreate();
+    CourseCatalog courses = courseCatalogCreate();
+    Student student_test = NULL, student_test2 = NULL, student_test3 = NULL;
+    ASSERT_TEST(studentCreateWithSharedData(111111118, "Ariel", "Cohen", names, courses, &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentCreateWithSharedData(222222226, "Eran", "Cohen", names, courses, &student_test2) == STUDENT_OK);
+    ASSERT_TEST(namePoolGetSize(names) == 3); // "Cohen" is stored once
+    ASSERT_TEST(studentAddGrade(student_test, 1, 104012, "5.5", 90) == STUDENT_OK);
+    ASSERT_TEST(studentAddGrade(student_test, 2, 104012, "5.5", 95) == STUDENT_OK);
+    ASSERT_TEST(studentAddGrade(student_test2, 1, 104012, "5.5", 80) == STUDENT_OK);
+    ASSERT_TEST(studentAddGrade(student_test2, 1, 104012, "5", 80) == STUDENT_OK);
+    ASSERT_TEST(courseCatalogGetSize(courses) == 2); // the same course with different points is another entry
+    ASSERT_TEST(studentCreateWithSharedData(0, "Eran", "Cohen", names, courses, &student_test3)
+                == STUDENT_INVALID_PARAMETER);
+    ASSERT_TEST(studentCreateWithSharedData(333333334, NULL, "Cohen", names, courses, &student_test3)
+                == STUDENT_NULL_ARGUMENT);
+    studentDestroy(student_test);
+    ASSERT_TEST(namePoolGetSize(names) == 2);
+    studentDestroy(student_test2);
+    ASSERT_TEST(namePoolGetSize(names) == 0);
+    ASSERT_TEST(courseCatalogGetSize(courses) == 0);
+    namePoolDestroy(names);
+    courseCatalogDestroy(courses);
+    return true;
+}
+
 static bool testStudentCopy() {
     //SetElement studentCopy(SetElement student);
     Student student_test = NULL;
@@ -127,6 +155,71 @@ static bool testStudentGetStudentFriends() {
     return true;
 }
 
+/** collects the visited ids into an array (used to test the studentForEach functions) */
+typedef struct visited_ids_t {
+    int ids[4];
+    int count;
+} visited_ids_t;
+
+static void collectVisitedId(int id, void* context) {
+    visited_ids_t* visited = context;
+    if (visited->count < 4) {
+        visited->ids[visited->count] = id;
+    }
+    visited->count++;
+}
+
+static bool testStudentForEachFriend() {
+    //void studentForEachFriend(Student student, StudentIdVisitor visitor, void* context);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    Student student_test2 = NULL;
+    ASSERT_TEST(studentCreate(222222226, "Eran", "Channover", &student_test2) == STUDENT_OK);
+    Student student_test3 = NULL;
+    ASSERT_TEST(studentCreate(333333334, "test", "tester", &student_test3) == STUDENT_OK);
+    ASSERT_TEST(addFriend(student_test, student_test3) == STUDENT_OK);
+    ASSERT_TEST(addFriend(student_test, student_test2) == STUDENT_OK);
+
+    visited_ids_t visited = {{0}, 0};
+    studentForEachFriend(student_test, collectVisitedId, &visited);
+    ASSERT_TEST(visited.count == 2);
+    ASSERT_TEST(visited.ids[0] == 222222226);
+    ASSERT_TEST(visited.ids[1] == 333333334);
+
+    visited.count = 0;
+    studentForEachFriend(student_test2, collectVisitedId, &visited);
+    ASSERT_TEST(visited.count == 0);
+    studentForEachFriend(NULL, collectVisitedId, &visited);
+    ASSERT_TEST(visited.count == 0);
+
+    studentDestroy(student_test);
+    studentDestroy(student_test2);
+    studentDestroy(student_test3);
+    return true;
+}
+
+static bool testStudentForEachFriendRequest() {
+    //void studentForEachFriendRequest(Student student, StudentIdVisitor visitor, void* context);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    Student student_test2 = NULL;
+    ASSERT_TEST(studentCreate(222222226, "Eran", "Channover", &student_test2) == STUDENT_OK);
+    ASSERT_TEST(addFriendRequest(student_test, student_test2) == STUDENT_OK);
+
+    visited_ids_t visited = {{0}, 0};
+    studentForEachFriendRequest(student_test2, collectVisitedId, &visited);
+    ASSERT_TEST(visited.count == 1);
+    ASSERT_TEST(visited.ids[0] == 111111118);
+
+    visited.count = 0;
+    studentForEachFriendRequest(student_test, collectVisitedId, &visited);
+    ASSERT_TEST(visited.count == 0);
+
+    studentDestroy(student_test);
+    studentDestroy(student_test2);
+    return true;
+}
+
 static bool testAddFriendRequest() {
     //StudentResult addFriendRequest(Student student, Student friend);
     Student student_test = NULL;
@@ -233,6 +326,10 @@ static bool testIsFriend() {
     ASSERT_TEST(isFriend(NULL, student_test2) == false);
     ASSERT_TEST(isFriend(student_test, NULL) == false);
     ASSERT_TEST(isFriend(student_test, student_test) == true);
+    ASSERT_TEST(isFriendById(student_test, 222222226) == true);
+    ASSERT_TEST(isFriendById(student_test, 333333334) == false);
+    ASSERT_TEST(isFriendById(student_test, 111111118) == false);
+    ASSERT_TEST(isFriendById(NULL, 222222226) == false);
 
     studentDestroy(student_test);
     studentDestroy(student_test2);
@@ -575,6 +672,326 @@ static bool testStudentGetBestGradeInCourse() {
     return true;
 }
 
+static void collectCourseId(int course_id, void* context) {
+    int** next = context;
+    **next = course_id;
+    (*next)++;
+}
+
+static bool testStudentForEachCourse() {
+    //void studentForEachCourse(Student student, CourseIdVisitor visitor, void* context);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentGetId(student_test) == 111111118);
+    ASSERT_TEST(studentGetId(NULL) == -1);
+    ASSERT_TEST(studentAddGrade(student_test, 2, 234122, "3.0", 90) == STUDENT_OK);
+    ASSERT_TEST(studentAddGrade(student_test, 1, 104012, "5.5", 84) == STUDENT_OK);
+    ASSERT_TEST(studentAddGrade(student_test, 1, 234122, "3.0", 50) == STUDENT_OK);
+    int courses[3] = {0, 0, 0};
+    int* next = courses;
+    studentForEachCourse(student_test, collectCourseId, &next);
+    ASSERT_TEST(next == courses + 2);
+    ASSERT_TEST(courses[0] == 104012 && courses[1] == 234122);
+    studentDestroy(student_test);
+    return true;
+}
+
+static void collectFriendId(int id, void* context) {
+    int** next = context;
+    **next = id;
+    (*next)++;
+}
+
+static bool testStudentForEachMutualFriend() {
+    //int studentForEachMutualFriend(Student student1, Student student2, StudentIdVisitor visitor, void* context);
+    Student student_test = NULL, student_test2 = NULL, student_test3 = NULL, student_test4 = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentCreate(222222226, "Eran", "Channover", &student_test2) == STUDENT_OK);
+    ASSERT_TEST(studentCreate(333333334, "test", "tester", &student_test3) == STUDENT_OK);
+    ASSERT_TEST(studentCreate(444444445, "test2", "tester2", &student_test4) == STUDENT_OK);
+    int mutual[4] = {0, 0, 0, 0};
+    int* next = mutual;
+    ASSERT_TEST(studentForEachMutualFriend(student_test, student_test2, collectFriendId, &next) == 0);
+    addFriend(student_test, student_test3);
+    addFriend(student_test, student_test4);
+    addFriend(student_test2, student_test4);
+    addFriend(student_test2, student_test3);
+    addFriend(student_test2, student_test);
+    ASSERT_TEST(studentForEachMutualFriend(student_test, student_test2, collectFriendId, &next) == 2);
+    ASSERT_TEST(next == mutual + 2);
+    ASSERT_TEST(mutual[0] == 333333334 && mutual[1] == 444444445);
+    ASSERT_TEST(studentForEachMutualFriend(NULL, student_test2, collectFriendId, &next) == 0);
+    studentDestroy(student_test);
+    studentDestroy(student_test2);
+    studentDestroy(student_test3);
+    studentDestroy(student_test4);
+    return true;
+}
+
+/** GradeVisitor for the tests, that sums the grade numbers into the int the context points to */
+static void sumGradeNumbers(Grade grade, void* context) {
+    *(int*)context += getGradeNumber(grade);
+}
+
+static bool testStudentForEachGrade() {
+    //void studentForEachGrade(Student student, GradeVisitor visitor, void* context);
+    //Grade studentGetLastGradeObject(Student student, int semester, int course_id);
+    //int studentGetCourseLastSemester(Student student, int course_id);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    int sum = 0;
+    studentForEachGrade(student_test, sumGradeNumbers, &sum);
+    ASSERT_TEST(sum == 0);
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    studentAddGrade(student_test, 1, 234122, "3", 40);
+    studentAddGrade(student_test, 3, 234122, "3", 90);
+    studentAddGrade(student_test, 2, 104012, "5.5", 7);
+    studentForEachGrade(student_test, sumGradeNumbers, &sum);
+    ASSERT_TEST(sum == 217);
+    ASSERT_TEST(getGradeNumber(studentGetLastGradeObject(student_test, 1, 234122)) == 40);
+    ASSERT_TEST(studentGetLastGradeObject(student_test, 2, 234122) == NULL);
+    ASSERT_TEST(studentGetLastGradeObject(student_test, 4, 234122) == NULL);
+    ASSERT_TEST(studentGetLastGradeObject(NULL, 1, 234122) == NULL);
+    ASSERT_TEST(studentGetCourseLastSemester(student_test, 234122) == 3);
+    ASSERT_TEST(studentGetCourseLastSemester(student_test, 104012) == 2);
+    ASSERT_TEST(studentGetCourseLastSemester(student_test, 114071) == -1);
+    ASSERT_TEST(studentGetCourseLastSemester(NULL, 234122) == -1);
+    studentDestroy(student_test);
+    return true;
+}
+
+/** EffectiveGradeVisitor for the tests, that sums the course ids and the grades into the array the context points to */
+static void sumEffectiveGrades(int course_id, int grade, void* context) {
+    int* sums = context;
+    sums[0] += course_id;
+    sums[1] += grade;
+}
+
+static bool testStudentEffectiveGrades() {
+    //int studentGetEffectiveGrade(Student student, int course_id, int semester);
+    //void studentForEachEffectiveGrade(Student student, EffectiveGradeVisitor visitor, void* context);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 234122, 1) == -1);
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    studentAddGrade(student_test, 3, 234122, "3", 40);
+    studentAddGrade(student_test, 3, 234122, "3", 50);
+    studentAddGrade(student_test, 1, 394808, "1", 90); // a sport course - every semester counts
+    studentAddGrade(student_test, 2, 394808, "1", 95);
+    // only the last grade in the last semester counts, whatever the semester is
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 234122, 1) == 50);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 234122, 3) == 50);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 394808, 1) == 90);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 394808, 2) == 95);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 394808, 3) == -1);
+    ASSERT_TEST(studentGetEffectiveGrade(NULL, 234122, 1) == -1);
+    int sums[2] = {0, 0};
+    studentForEachEffectiveGrade(student_test, sumEffectiveGrades, sums);
+    ASSERT_TEST(sums[0] == 234122 + 394808 * 2);
+    ASSERT_TEST(sums[1] == 50 + 90 + 95);
+    studentDestroy(student_test);
+    return true;
+}
+
+static bool testStudentGetEffectiveTotals() {
+    //void studentGetEffectiveTotals(Student student, int* points_x2, int* grade_sum_x2);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    int points_x2 = -1, grade_sum_x2 = -1;
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 0 && grade_sum_x2 == 0);
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    studentAddGrade(student_test, 3, 234122, "3", 40);
+    studentAddGrade(student_test, 3, 234122, "3", 50);
+    studentAddGrade(student_test, 1, 394808, "1", 90);
+    studentAddGrade(student_test, 2, 394808, "1", 95);
+    ASSERT_TEST(studentAddGrade(student_test, 2, 394808, "1", 101) == STUDENT_INVALID_PARAMETER);
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 6 + 2 + 2);
+    ASSERT_TEST(grade_sum_x2 == 50 * 6 + 90 * 2 + 95 * 2);
+    ASSERT_TEST(studentUpdateGrade(student_test, 234122, 70) == STUDENT_OK);
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 10 && grade_sum_x2 == 70 * 6 + 90 * 2 + 95 * 2);
+    ASSERT_TEST(studentRemoveGrade(student_test, 3, 234122) == STUDENT_OK);
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 10 && grade_sum_x2 == 40 * 6 + 90 * 2 + 95 * 2);
+    ASSERT_TEST(studentRemoveGrade(student_test, 2, 394808) == STUDENT_OK);
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 8 && grade_sum_x2 == 40 * 6 + 90 * 2);
+    // the copy keeps the totals
+    Student copy = studentCopy(student_test);
+    studentGetEffectiveTotals(copy, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 8 && grade_sum_x2 == 40 * 6 + 90 * 2);
+    studentDestroy(copy);
+    studentDestroy(student_test);
+    return true;
+}
+
+static bool testStudentGetWhatIfTotals() {
+    //StudentResult studentGetWhatIfTotals(Student student, WhatIf scenario, int* points_x2, int* grade_sum_x2);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    studentAddGrade(student_test, 3, 234122, "3", 50);
+    studentAddGrade(student_test, 1, 394808, "1", 90);
+    WhatIf scenario = whatIfCreate();
+    int points_x2 = -1, grade_sum_x2 = -1;
+    ASSERT_TEST(studentGetWhatIfTotals(NULL, scenario, &points_x2, &grade_sum_x2) == STUDENT_NULL_ARGUMENT);
+    ASSERT_TEST(studentGetWhatIfTotals(student_test, NULL, &points_x2, &grade_sum_x2) == STUDENT_NULL_ARGUMENT);
+    ASSERT_TEST(studentGetWhatIfTotals(student_test, scenario, NULL, &grade_sum_x2) == STUDENT_NULL_ARGUMENT);
+    // without changes - the effective totals
+    ASSERT_TEST(studentGetWhatIfTotals(student_test, scenario, &points_x2, &grade_sum_x2) == STUDENT_OK);
+    ASSERT_TEST(points_x2 == 6 + 2 && grade_sum_x2 == 50 * 6 + 90 * 2);
+    // a retake replaces the effective grade, a new course and a sport course are added
+    whatIfAddChange(scenario, 234122, "3", 90);
+    whatIfAddChange(scenario, 104012, "5.5", 70);
+    whatIfAddChange(scenario, 394808, "1", 100);
+    ASSERT_TEST(studentGetWhatIfTotals(student_test, scenario, &points_x2, &grade_sum_x2) == STUDENT_OK);
+    ASSERT_TEST(points_x2 == 6 + 11 + 2 + 2);
+    ASSERT_TEST(grade_sum_x2 == 90 * 6 + 70 * 11 + 90 * 2 + 100 * 2);
+    // the student is not changed
+    studentGetEffectiveTotals(student_test, &points_x2, &grade_sum_x2);
+    ASSERT_TEST(points_x2 == 6 + 2 && grade_sum_x2 == 50 * 6 + 90 * 2);
+    ASSERT_TEST(studentGetEffectiveGrade(student_test, 234122, 3) == 50);
+    whatIfAddChange(scenario, 234122, "3", 101);
+    ASSERT_TEST(studentGetWhatIfTotals(student_test, scenario, &points_x2, &grade_sum_x2) ==
+                STUDENT_INVALID_PARAMETER);
+    whatIfDestroy(scenario);
+    studentDestroy(student_test);
+    return true;
+}
+
+static bool testStudentPrintProgression() {
+    //StudentResult studentPrintProgression(Student student, FILE* output_channel);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentPrintProgression(student_test, stdout) == STUDENT_OK); // prints nothing
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    studentAddGrade(student_test, 1, 394808, "1", 90);
+    studentAddGrade(student_test, 2, 394808, "1", 95); // a sport course - every semester counts
+    studentAddGrade(student_test, 2, 104012, "4", 70);
+    studentAddGrade(student_test, 3, 234122, "3", 40);
+    studentAddGrade(student_test, 3, 234122, "3", 50); // overrides the grade of the first semester
+    ASSERT_TEST(studentPrintProgression(student_test, stdout) == STUDENT_OK);
+    // should print
+    /**
+     After semester 1: points 4.0, average 82.50
+     After semester 2: points 9.0, average 78.33
+     After semester 3: points 9.0, average 68.33
+     */
+    ASSERT_TEST(studentUpdateGrade(student_test, 234122, 60) == STUDENT_OK); // only the third semester changes
+    studentAddGrade(student_test, 2, 234122, "3", 100);
+    ASSERT_TEST(studentPrintProgression(student_test, stdout) == STUDENT_OK);
+    // should print
+    /**
+     After semester 1: points 4.0, average 82.50
+     After semester 2: points 9.0, average 85.00
+     After semester 3: points 9.0, average 71.67
+     */
+    ASSERT_TEST(studentRemoveGrade(student_test, 3, 234122) == STUDENT_OK);
+    ASSERT_TEST(studentRemoveGrade(student_test, 3, 234122) == STUDENT_OK); // the third semester is removed
+    ASSERT_TEST(studentPrintProgression(student_test, stdout) == STUDENT_OK);
+    // should print
+    /**
+     After semester 1: points 4.0, average 82.50
+     After semester 2: points 9.0, average 85.00
+     */
+    ASSERT_TEST(studentPrintProgression(NULL, stdout) == STUDENT_OUT_OF_MEMORY);
+    studentDestroy(student_test);
+    return true;
+}
+
+static bool testStudentPrintReportsAsOf() {
+    //StudentResult studentRecordVersion(Student student, int sequence, int semester_number);
+    //StudentResult studentPrintFullReportAsOf(Student student, int sequence, FILE* output_channel);
+    //StudentResult studentPrintCleanReportAsOf(Student student, int sequence, FILE* output_channel);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentRecordVersion(NULL, 1, 1) == STUDENT_NULL_ARGUMENT);
+    studentAddGrade(student_test, 1, 234122, "3", 40);
+    // the first version records the whole sheet
+    ASSERT_TEST(studentRecordVersion(student_test, 1, 1) == STUDENT_OK);
+    studentAddGrade(student_test, 2, 234122, "3", 85);
+    ASSERT_TEST(studentRecordVersion(student_test, 2, 2) == STUDENT_OK);
+    ASSERT_TEST(studentUpdateGrade(student_test, 234122, 95) == STUDENT_OK);
+    ASSERT_TEST(studentRecordVersion(student_test, 4, 2) == STUDENT_OK);
+    ASSERT_TEST(studentRecordVersion(student_test, 3, 2) == STUDENT_INVALID_PARAMETER);
+    ASSERT_TEST(studentRecordVersion(student_test, 4, 0) == STUDENT_INVALID_PARAMETER);
+    printf("\n");
+    ASSERT_TEST(studentPrintFullReportAsOf(student_test, 3, stdout) == STUDENT_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 40
+    ========================================
+    Semester 1		Points: 3.0		Average: 40.00		Success: 0%
+
+    Course: 234122		Points: 3.0		Grade: 85
+    ========================================
+    Semester 2		Points: 3.0		Average: 85.00		Success: 100%
+
+    Points: 3.0		Average: 85.00		Success: 50%
+     */
+    ASSERT_TEST(studentPrintCleanReportAsOf(student_test, 4, stdout) == STUDENT_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 95
+    ========================================
+    Points: 3.0		Average: 95.00
+     */
+    ASSERT_TEST(studentPrintCleanReportAsOf(student_test, 0, stdout) == STUDENT_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    ========================================
+    Points: 0.0		Average: 0.00
+     */
+    // a copy keeps the versions of the original
+    Student student_copy = studentCopy(student_test);
+    ASSERT_TEST(student_copy != NULL);
+    studentDestroy(student_test);
+    ASSERT_TEST(studentPrintCleanReportAsOf(student_copy, 1, stdout) == STUDENT_OK);
+    // should print
+    /**
+    Grade sheet of Ariel Wershal, id 111111118
+    ========================================
+    Course: 234122		Points: 3.0		Grade: 40
+    ========================================
+    Points: 3.0		Average: 40.00
+     */
+    ASSERT_TEST(studentPrintFullReportAsOf(NULL, 1, stdout) == STUDENT_OUT_OF_MEMORY);
+    ASSERT_TEST(studentPrintCleanReportAsOf(student_copy, 1, NULL) == STUDENT_OUT_OF_MEMORY);
+    studentDestroy(student_copy);
+    return true;
+}
+
+static bool testStudentGetVersion() {
+    //unsigned int studentGetVersion(Student student);
+    Student student_test = NULL;
+    ASSERT_TEST(studentCreate(111111118, "Ariel", "Wershal", &student_test) == STUDENT_OK);
+    ASSERT_TEST(studentGetVersion(student_test) == 0);
+    ASSERT_TEST(studentGetVersion(NULL) == 0);
+    studentAddGrade(student_test, 1, 234122, "3", 80);
+    ASSERT_TEST(studentGetVersion(student_test) == 1);
+    // a change that fails does not advance the version
+    ASSERT_TEST(studentAddGrade(student_test, 1, 234122, "3", 101) == STUDENT_INVALID_PARAMETER);
+    ASSERT_TEST(studentUpdateGrade(student_test, 104012, 90) == STUDENT_COURSE_DOES_NOT_EXIST);
+    ASSERT_TEST(studentGetVersion(student_test) == 1);
+    ASSERT_TEST(studentUpdateGrade(student_test, 234122, 90) == STUDENT_OK);
+    ASSERT_TEST(studentRemoveGrade(student_test, 1, 234122) == STUDENT_OK);
+    ASSERT_TEST(studentGetVersion(student_test) == 3);
+    Student student_copy = studentCopy(student_test);
+    ASSERT_TEST(student_copy != NULL);
+    ASSERT_TEST(studentGetVersion(student_copy) == 3);
+    studentDestroy(student_copy);
+    studentDestroy(student_test);
+    return true;
+}
+
 static bool testStudentPrintName() {
     //void studentPrintName(Student student, FILE* output_channel);
     Student student_test = NULL;
@@ -585,19 +1002,35 @@ static bool testStudentPrintName() {
     //should print
     //Ariel Wershal
 
+    // names that are too long to be stored inline
+    Student long_names_student = NULL;
+    ASSERT_TEST(studentCreate(222222226, "Maximilianusthethird", "Ben-Avraham-Rosenthal", &long_names_student)
+                == STUDENT_OK);
+    Student long_names_copy = studentCopy(long_names_student);
+    ASSERT_TEST(long_names_copy != NULL);
+    studentDestroy(long_names_student);
+    printf("\n");
+    studentPrintName(long_names_copy, stdout);
+    //should print
+    //Maximilianusthethird Ben-Avraham-Rosenthal
+
     studentPrintName(NULL, stdout);
     studentPrintName(student_test, NULL);
 
     studentDestroy(student_test);
+    studentDestroy(long_names_copy);
     return true;
 }
 
 int main() {
     RUN_TEST(testStudentCreate);
+    RUN_TEST(testStudentCreateWithSharedData);
     RUN_TEST(testStudentCopy);
     RUN_TEST(testStudentCompare);
     RUN_TEST(testGetStudentFromSet);
     RUN_TEST(testStudentGetStudentFriends);
+    RUN_TEST(testStudentForEachFriend);
+    RUN_TEST(testStudentForEachFriendRequest);
     RUN_TEST(testAddFriendRequest);
     RUN_TEST(testRemoveFriendRequest);
     RUN_TEST(testIsThereFriendRequest);
@@ -614,6 +1047,15 @@ int main() {
     RUN_TEST(testStudentPrintCleanReport);
     RUN_TEST(testStudentPrintBestOrWorstGrades);
     RUN_TEST(testStudentGetBestGradeInCourse);
+    RUN_TEST(testStudentForEachCourse);
+    RUN_TEST(testStudentForEachMutualFriend);
+    RUN_TEST(testStudentForEachGrade);
+    RUN_TEST(testStudentEffectiveGrades);
+    RUN_TEST(testStudentGetEffectiveTotals);
+    RUN_TEST(testStudentGetWhatIfTotals);
+    RUN_TEST(testStudentPrintProgression);
+    RUN_TEST(testStudentPrintReportsAsOf);
+    RUN_TEST(testStudentGetVersion);
     RUN_TEST(testStudentPrintName);
 
     return 0;
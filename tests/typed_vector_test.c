@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../id_vector.h"
+#include "../typed_containers.h"
+
+static bool testIdVectorInsert() {
+    //VectorResult idVectorInsert(IdVector* vector, int element);
+    IdVector vector;
+    idVectorInit(&vector);
+    ASSERT_TEST(idVectorSize(&vector) == 0);
+    ASSERT_TEST(idVectorInsert(&vector, 30) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 10) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 20) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 10) == VECTOR_ITEM_ALREADY_EXISTS);
+    ASSERT_TEST(idVectorSize(&vector) == 3);
+    ASSERT_TEST(*idVectorAt(&vector, 0) == 10);
+    ASSERT_TEST(*idVectorAt(&vector, 1) == 20);
+    ASSERT_TEST(*idVectorAt(&vector, 2) == 30);
+    for (int i = 100; i > 0; i--) { // more than the initial capacity, in reverse order
+        ASSERT_TEST(idVectorInsert(&vector, -i) == VECTOR_OK);
+    }
+    ASSERT_TEST(idVectorSize(&vector) == 103);
+    ASSERT_TEST(*idVectorAt(&vector, 0) == -100);
+    idVectorDestroy(&vector);
+    ASSERT_TEST(idVectorSize(&vector) == 0);
+    return true;
+}
+
+static bool testIdVectorFind() {
+    //int* idVectorFind(const IdVector* vector, int key);
+    IdVector vector;
+    idVectorInit(&vector);
+    ASSERT_TEST(idVectorFind(&vector, 5) == NULL);
+    ASSERT_TEST(idVectorInsert(&vector, 5) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 9) == VECTOR_OK);
+    ASSERT_TEST(*idVectorFind(&vector, 5) == 5);
+    ASSERT_TEST(*idVectorFind(&vector, 9) == 9);
+    ASSERT_TEST(idVectorFind(&vector, 7) == NULL);
+    ASSERT_TEST(idVectorFind(&vector, 10) == NULL);
+    ASSERT_TEST(idVectorLowerBound(&vector, 7) == 1);
+    ASSERT_TEST(idVectorLowerBound(&vector, 10) == 2);
+    idVectorDestroy(&vector);
+    return true;
+}
+
+static bool testIdVectorRemove() {
+    //VectorResult idVectorRemove(IdVector* vector, int key);
+    IdVector vector;
+    idVectorInit(&vector);
+    ASSERT_TEST(idVectorRemove(&vector, 5) == VECTOR_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(idVectorInsert(&vector, 5) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 3) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 8) == VECTOR_OK);
+    ASSERT_TEST(idVectorRemove(&vector, 5) == VECTOR_OK);
+    ASSERT_TEST(idVectorRemove(&vector, 5) == VECTOR_ITEM_DOES_NOT_EXIST);
+    ASSERT_TEST(idVectorSize(&vector) == 2);
+    ASSERT_TEST(*idVectorAt(&vector, 0) == 3);
+    ASSERT_TEST(*idVectorAt(&vector, 1) == 8);
+    idVectorDestroy(&vector);
+    return true;
+}
+
+static bool testIdVectorCopy() {
+    //VectorResult idVectorCopy(IdVector* destination, const IdVector* source);
+    IdVector vector, copy, empty_copy;
+    idVectorInit(&vector);
+    idVectorInit(&copy);
+    idVectorInit(&empty_copy);
+    ASSERT_TEST(idVectorCopy(&empty_copy, &vector) == VECTOR_OK);
+    ASSERT_TEST(idVectorSize(&empty_copy) == 0);
+    ASSERT_TEST(idVectorInsert(&vector, 2) == VECTOR_OK);
+    ASSERT_TEST(idVectorInsert(&vector, 1) == VECTOR_OK);
+    ASSERT_TEST(idVectorCopy(&copy, &vector) == VECTOR_OK);
+    ASSERT_TEST(idVectorRemove(&vector, 1) == VECTOR_OK);
+    ASSERT_TEST(idVectorSize(&copy) == 2);
+    ASSERT_TEST(idVectorFind(&copy, 1) != NULL); // the copy is not affected
+    idVectorDestroy(&vector);
+    idVectorDestroy(&copy);
+    idVectorDestroy(&empty_copy);
+    return true;
+}
+
+static bool testSemesterVector() {
+    //SORTED_VECTOR_DEFINE(SemesterVector, ...)
+    SemesterVector vector;
+    semesterVectorInit(&vector);
+    Semester semester1 = NULL, semester3 = NULL;
+    ASSERT_TEST(semesterCreate(1, &semester1) == SEMESTER_OK);
+    ASSERT_TEST(semesterCreate(3, &semester3) == SEMESTER_OK);
+    SemesterEntry entry3 = {3, semester3}, entry1 = {1, semester1};
+    ASSERT_TEST(semesterVectorInsert(&vector, entry3) == VECTOR_OK);
+    ASSERT_TEST(semesterVectorInsert(&vector, entry1) == VECTOR_OK);
+    ASSERT_TEST(semesterVectorInsert(&vector, entry1) == VECTOR_ITEM_ALREADY_EXISTS);
+    ASSERT_TEST(semesterVectorAt(&vector, 0)->semester_number == 1);
+    ASSERT_TEST(semesterVectorFind(&vector, 3)->semester == semester3);
+    ASSERT_TEST(semesterVectorFind(&vector, 2) == NULL);
+    ASSERT_TEST(semesterVectorRemove(&vector, 1) == VECTOR_OK);
+    ASSERT_TEST(semesterVectorSize(&vector) == 1);
+    semesterVectorDestroy(&vector); // the semesters themselves are not destroyed by the vector
+    semesterDestroy(semester1);
+    semesterDestroy(semester3);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testIdVectorInsert);
+    RUN_TEST(testIdVectorFind);
+    RUN_TEST(testIdVectorRemove);
+    RUN_TEST(testIdVectorCopy);
+    RUN_TEST(testSemesterVector);
+    return 0;
+}
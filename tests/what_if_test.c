@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include "test_utilities.h"
+#include "../what_if.h"
+
+#define MANY_CHANGES 100
+
+static bool testWhatIfCreate() {
+    //WhatIf whatIfCreate();
+    WhatIf scenario = whatIfCreate();
+    ASSERT_TEST(scenario != NULL);
+    ASSERT_TEST(whatIfGetCount(scenario) == 0);
+    ASSERT_TEST(whatIfIsValid(scenario));
+    ASSERT_TEST(whatIfGetCount(NULL) == -1);
+    ASSERT_TEST(!whatIfIsValid(NULL));
+    int course_id, points_x2, grade;
+    ASSERT_TEST(!whatIfGetChange(scenario, 0, &course_id, &points_x2, &grade));
+    whatIfDestroy(scenario);
+    return true;
+}
+
+static bool testWhatIfAddChange() {
+    //WhatIfResult whatIfAddChange(WhatIf scenario, int course_id, char* points, int grade);
+    WhatIf scenario = whatIfCreate();
+    ASSERT_TEST(whatIfAddChange(NULL, 234122, "3", 90) == WHAT_IF_NULL_ARGUMENT);
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, NULL, 90) == WHAT_IF_NULL_ARGUMENT);
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, "3", 90) == WHAT_IF_OK);
+    ASSERT_TEST(whatIfAddChange(scenario, 104012, "5.5", 75) == WHAT_IF_OK);
+    ASSERT_TEST(whatIfIsValid(scenario));
+    // a course that is added again replaces its earlier change
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, "3.5", 95) == WHAT_IF_OK);
+    ASSERT_TEST(whatIfGetCount(scenario) == 2);
+    int course_id, points_x2, grade;
+    ASSERT_TEST(whatIfGetChange(scenario, 0, &course_id, &points_x2, &grade));
+    ASSERT_TEST(course_id == 234122 && points_x2 == 7 && grade == 95);
+    ASSERT_TEST(whatIfGetChange(scenario, 1, &course_id, &points_x2, &grade));
+    ASSERT_TEST(course_id == 104012 && points_x2 == 11 && grade == 75);
+    ASSERT_TEST(!whatIfGetChange(scenario, 2, &course_id, &points_x2, &grade));
+    ASSERT_TEST(!whatIfGetChange(scenario, -1, &course_id, &points_x2, &grade));
+    ASSERT_TEST(!whatIfGetChange(scenario, 0, NULL, &points_x2, &grade));
+    whatIfDestroy(scenario);
+    return true;
+}
+
+static bool testWhatIfInvalidChange() {
+    WhatIf scenario = whatIfCreate();
+    ASSERT_TEST(whatIfAddChange(scenario, 1000000, "3", 90) == WHAT_IF_INVALID_PARAMETER);
+    ASSERT_TEST(!whatIfIsValid(scenario));
+    whatIfDestroy(scenario);
+    scenario = whatIfCreate();
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, "3", 90) == WHAT_IF_OK);
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, "3.7", 90) == WHAT_IF_INVALID_PARAMETER);
+    ASSERT_TEST(whatIfAddChange(scenario, 234122, "3", 101) == WHAT_IF_INVALID_PARAMETER);
+    ASSERT_TEST(whatIfAddChange(scenario, 0, "3", 90) == WHAT_IF_INVALID_PARAMETER);
+    ASSERT_TEST(!whatIfIsValid(scenario));
+    // the invalid changes are not kept, and a valid change does not make the scenario valid again
+    ASSERT_TEST(whatIfGetCount(scenario) == 1);
+    ASSERT_TEST(whatIfAddChange(scenario, 104012, "5.5", 75) == WHAT_IF_OK);
+    ASSERT_TEST(!whatIfIsValid(scenario));
+    whatIfDestroy(scenario);
+    return true;
+}
+
+static bool testWhatIfManyChanges() {
+    WhatIf scenario = whatIfCreate();
+    for (int i = 0; i < MANY_CHANGES; i++) {
+        ASSERT_TEST(whatIfAddChange(scenario, 100000 + i, "2.5", i) == WHAT_IF_OK);
+    }
+    ASSERT_TEST(whatIfGetCount(scenario) == MANY_CHANGES);
+    int course_id, points_x2, grade;
+    for (int i = 0; i < MANY_CHANGES; i++) {
+        ASSERT_TEST(whatIfGetChange(scenario, i, &course_id, &points_x2, &grade));
+        ASSERT_TEST(course_id == 100000 + i && points_x2 == 5 && grade == i);
+    }
+    whatIfDestroy(scenario);
+    return true;
+}
+
+int main() {
+    RUN_TEST(testWhatIfCreate);
+    RUN_TEST(testWhatIfAddChange);
+    RUN_TEST(testWhatIfInvalidChange);
+    RUN_TEST(testWhatIfManyChanges);
+    return 0;
+}
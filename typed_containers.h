@@ -0,0 +1,23 @@
+#ifndef EX3_TYPED_CONTAINERS_H
+#define EX3_TYPED_CONTAINERS_H
+
+#include "typed_vector.h"
+#include "semester.h"
+
+/**
+ * The type-specialized containers (see typed_vector.h) for the element types of this project. the students' ids
+ * container is in id_vector.h.
+ */
+
+/** SemesterEntry - a semester kept by value together with its number, so finding it does not touch the semester */
+typedef struct semester_entry_t {
+    int semester_number;
+    Semester semester;
+} SemesterEntry;
+
+#define SEMESTER_ENTRY_KEY(entry) ((entry).semester_number)
+
+/** SemesterVector - the semesters of a student, sorted by the semester number */
+SORTED_VECTOR_DEFINE(SemesterVector, semesterVector, SemesterEntry, int, SEMESTER_ENTRY_KEY, VECTOR_COMPARE_INTS)
+
+#endif //EX3_TYPED_CONTAINERS_H
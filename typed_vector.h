@@ -0,0 +1,153 @@
+#ifndef EX3_TYPED_VECTOR_H
+#define EX3_TYPED_VECTOR_H
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Macros that generate type-specialized dynamic arrays (in the style of klib's kvec/khash).
+ *
+ * Unlike set.h/list.h, the elements are stored by value in one contiguous array, and the key extraction and key
+ * comparison are macros - so they are compiled inline instead of being called through function pointers.
+ *
+ * VECTOR_DEFINE(Name, prefix, type) defines the struct type Name and the following static inline functions:
+ *  prefixInit       - initializes an empty vector (no allocation)
+ *  prefixDestroy    - deallocates the elements array (the elements themselves are not destroyed)
+ *  prefixSize       - returns the number of elements
+ *  prefixAt         - returns a pointer to the element at the given index
+ *  prefixReserve    - makes sure the vector can hold the given number of elements without reallocating
+ *  prefixAppend     - adds an element at the end
+ *  prefixInsertAt   - adds an element at the given index
+ *  prefixRemoveAt   - removes the element at the given index
+ *  prefixCopy       - copies all the elements of one vector into another (empty) vector
+ *
+ * SORTED_VECTOR_DEFINE(Name, prefix, type, key_type, KEY_OF, COMPARE_KEYS) also keeps the elements sorted by their
+ * key, without duplicates, and adds:
+ *  prefixLowerBound - returns the index of the first element whose key is not smaller than the given key
+ *  prefixFind       - returns a pointer to the element with the given key (binary search), or NULL
+ *  prefixInsert     - adds an element in its sorted place
+ *  prefixRemove     - removes the element with the given key
+ * KEY_OF(element) must evaluate to the key of an element, and COMPARE_KEYS(key1, key2) to a negative number, 0 or a
+ * positive number (like strcmp).
+ */
+
+/** Type used for returning error codes from the generated functions */
+typedef enum VectorResult_t {
+    VECTOR_OK,
+    VECTOR_OUT_OF_MEMORY,
+    VECTOR_ITEM_ALREADY_EXISTS,
+    VECTOR_ITEM_DOES_NOT_EXIST
+} VectorResult;
+
+#define VECTOR_INITIAL_CAPACITY 4
+
+#define VECTOR_DEFINE(Name, prefix, type) \
+typedef struct { \
+    type* elements; \
+    int size; \
+    int capacity; \
+} Name; \
+\
+static inline void prefix##Init(Name* vector) { \
+    vector->elements = NULL; \
+    vector->size = 0; \
+    vector->capacity = 0; \
+} \
+\
+static inline void prefix##Destroy(Name* vector) { \
+    free(vector->elements); \
+    prefix##Init(vector); \
+} \
+\
+static inline int prefix##Size(const Name* vector) { \
+    return vector->size; \
+} \
+\
+static inline type* prefix##At(const Name* vector, int index) { \
+    return vector->elements + index; \
+} \
+\
+static inline VectorResult prefix##Reserve(Name* vector, int capacity) { \
+    if (capacity <= vector->capacity) return VECTOR_OK; \
+    type* new_elements = (type*) realloc(vector->elements, sizeof(type) * capacity); \
+    if (new_elements == NULL) return VECTOR_OUT_OF_MEMORY; \
+    vector->elements = new_elements; \
+    vector->capacity = capacity; \
+    return VECTOR_OK; \
+} \
+\
+static inline VectorResult prefix##InsertAt(Name* vector, int index, type element) { \
+    if (vector->size == vector->capacity) { \
+        int new_capacity = (vector->capacity == 0) ? VECTOR_INITIAL_CAPACITY : vector->capacity * 2; \
+        if (prefix##Reserve(vector, new_capacity) != VECTOR_OK) return VECTOR_OUT_OF_MEMORY; \
+    } \
+    memmove(vector->elements + index + 1, vector->elements + index, sizeof(type) * (vector->size - index)); \
+    vector->elements[index] = element; \
+    vector->size++; \
+    return VECTOR_OK; \
+} \
+\
+static inline VectorResult prefix##Append(Name* vector, type element) { \
+    return prefix##InsertAt(vector, vector->size, element); \
+} \
+\
+static inline void prefix##RemoveAt(Name* vector, int index) { \
+    memmove(vector->elements + index, vector->elements + index + 1, sizeof(type) * (vector->size - index - 1)); \
+    vector->size--; \
+} \
+\
+static inline VectorResult prefix##Copy(Name* destination, const Name* source) { \
+    if (prefix##Reserve(destination, source->size) != VECTOR_OK) return VECTOR_OUT_OF_MEMORY; \
+    if (source->size > 0) { \
+        memcpy(destination->elements, source->elements, sizeof(type) * source->size); \
+    } \
+    destination->size = source->size; \
+    return VECTOR_OK; \
+}
+
+#define SORTED_VECTOR_DEFINE(Name, prefix, type, key_type, KEY_OF, COMPARE_KEYS) \
+VECTOR_DEFINE(Name, prefix, type) \
+\
+static inline int prefix##LowerBound(const Name* vector, key_type key) { \
+    int low = 0, high = vector->size; \
+    while (low < high) { \
+        int middle = low + (high - low) / 2; \
+        if (COMPARE_KEYS(KEY_OF(vector->elements[middle]), key) < 0) { \
+            low = middle + 1; \
+        } else { \
+            high = middle; \
+        } \
+    } \
+    return low; \
+} \
+\
+static inline type* prefix##Find(const Name* vector, key_type key) { \
+    int index = prefix##LowerBound(vector, key); \
+    if (index < vector->size && COMPARE_KEYS(KEY_OF(vector->elements[index]), key) == 0) { \
+        return vector->elements + index; \
+    } \
+    return NULL; \
+} \
+\
+static inline VectorResult prefix##Insert(Name* vector, type element) { \
+    int index = prefix##LowerBound(vector, KEY_OF(element)); \
+    if (index < vector->size && COMPARE_KEYS(KEY_OF(vector->elements[index]), KEY_OF(element)) == 0) { \
+        return VECTOR_ITEM_ALREADY_EXISTS; \
+    } \
+    return prefix##InsertAt(vector, index, element); \
+} \
+\
+static inline VectorResult prefix##Remove(Name* vector, key_type key) { \
+    int index = prefix##LowerBound(vector, key); \
+    if (index == vector->size || COMPARE_KEYS(KEY_OF(vector->elements[index]), key) != 0) { \
+        return VECTOR_ITEM_DOES_NOT_EXIST; \
+    } \
+    prefix##RemoveAt(vector, index); \
+    return VECTOR_OK; \
+}
+
+/** Key extraction and comparison for vectors whose elements are their own keys (ints) */
+#define VECTOR_ELEMENT_AS_KEY(element) (element)
+#define VECTOR_COMPARE_INTS(key1, key2) (((key1) > (key2)) - ((key1) < (key2)))
+
+#endif //EX3_TYPED_VECTOR_H
@@ -0,0 +1,127 @@
+#include "what_if.h"
+#include <stdlib.h>
+#include "grade.h"
+
+#define WHAT_IF_INITIAL_CAPACITY 8
+
+typedef struct what_if_change_t {
+    int course_id;
+    int points_x2;
+    int grade;
+} what_if_change_t;
+
+typedef struct what_if_t {
+    what_if_change_t* changes;
+    int count;
+    int capacity;
+    bool valid; // false if a change with invalid parameters was added
+} what_if_t;
+
+/**
+ * whatIfCreate - creates a new scenario without changes
+ * @return
+ * NULL - if allocations failed.
+ * A new WhatIf in case of success.
+ */
+WhatIf whatIfCreate() {
+    WhatIf scenario = (WhatIf) malloc(sizeof(*scenario));
+    if (scenario == NULL) return NULL;
+    scenario->changes = NULL;
+    scenario->count = 0;
+    scenario->capacity = 0;
+    scenario->valid = true;
+    return scenario;
+}
+
+/**
+ * whatIfAddChange - adds the hypothetical grade of the given course to the scenario
+ * @param scenario - the scenario to add the grade to
+ * @param course_id - the id of the course (must be positive number lower than 1000000)
+ * @param points - the points of the course (must be in the format of X or X.0 or X.5, while X is an array of digits)
+ * @param grade - the hypothetical grade (must be number between 0 and 100)
+ * @return
+ * WHAT_IF_NULL_ARGUMENT - if scenario or points is NULL
+ * WHAT_IF_INVALID_PARAMETER - if one of the parameters is not valid (the scenario is marked as not valid, so it can
+ * not be evaluated)
+ * WHAT_IF_OUT_OF_MEMORY - if there was a memory error (the scenario is not changed)
+ * WHAT_IF_OK - otherwise
+ */
+WhatIfResult whatIfAddChange(WhatIf scenario, int course_id, char* points, int grade) {
+    if (scenario == NULL || points == NULL) return WHAT_IF_NULL_ARGUMENT;
+    int points_x2;
+    if (course_id >= 1000000 || course_id <= 0 || !gradeParsePointsX2(points, &points_x2) || grade < 0 ||
+        grade > 100) {
+        scenario->valid = false;
+        return WHAT_IF_INVALID_PARAMETER;
+    }
+    // a scenario has a few changes, so searching them is cheaper than keeping them sorted
+    for (int i = 0; i < scenario->count; i++) {
+        if (scenario->changes[i].course_id == course_id) {
+            scenario->changes[i].points_x2 = points_x2;
+            scenario->changes[i].grade = grade;
+            return WHAT_IF_OK;
+        }
+    }
+    if (scenario->count == scenario->capacity) {
+        int new_capacity = (scenario->capacity == 0) ? WHAT_IF_INITIAL_CAPACITY : scenario->capacity * 2;
+        what_if_change_t* new_changes = (what_if_change_t*) realloc(scenario->changes,
+                                                                    sizeof(*new_changes) * new_capacity);
+        if (new_changes == NULL) return WHAT_IF_OUT_OF_MEMORY;
+        scenario->changes = new_changes;
+        scenario->capacity = new_capacity;
+    }
+    what_if_change_t* change = &scenario->changes[scenario->count++];
+    change->course_id = course_id;
+    change->points_x2 = points_x2;
+    change->grade = grade;
+    return WHAT_IF_OK;
+}
+
+/**
+ * whatIfIsValid - checks if all the changes that were added to the scenario were valid
+ * @param scenario - the scenario
+ * @return false if a change with invalid parameters was added (or scenario is NULL), true otherwise
+ */
+bool whatIfIsValid(WhatIf scenario) {
+    return scenario != NULL && scenario->valid;
+}
+
+/**
+ * whatIfGetCount - returns the number of changes in the scenario (the number of different courses)
+ * @param scenario - the scenario
+ * @return the number of changes. -1 if scenario is NULL
+ */
+int whatIfGetCount(WhatIf scenario) {
+    if (scenario == NULL) return -1;
+    return scenario->count;
+}
+
+/**
+ * whatIfGetChange - returns the change with the given index (the changes are kept in the order their courses were
+ * first added)
+ * @param scenario - the scenario to search in
+ * @param index - the index of the change (lower than the number of changes)
+ * @param course_id - pointer to save the id of the course to
+ * @param points_x2 - pointer to save the points of the course multiple by 2 to
+ * @param grade - pointer to save the hypothetical grade to
+ * @return true if the change was returned, false if there is no change with this index (or one of the arguments is
+ * NULL)
+ */
+bool whatIfGetChange(WhatIf scenario, int index, int* course_id, int* points_x2, int* grade) {
+    if (scenario == NULL || course_id == NULL || points_x2 == NULL || grade == NULL) return false;
+    if (index < 0 || index >= scenario->count) return false;
+    *course_id = scenario->changes[index].course_id;
+    *points_x2 = scenario->changes[index].points_x2;
+    *grade = scenario->changes[index].grade;
+    return true;
+}
+
+/**
+ * whatIfDestroy - deallocate all the memory of the scenario
+ * @param scenario - the scenario to destroy. if scenario is NULL nothing will be done
+ */
+void whatIfDestroy(WhatIf scenario) {
+    if (scenario == NULL) return;
+    free(scenario->changes);
+    free(scenario);
+}
@@ -0,0 +1,80 @@
+#ifndef EX3_WHAT_IF_H
+#define EX3_WHAT_IF_H
+
+#include <stdbool.h>
+
+/**
+ * A hypothetical scenario of a grade sheet: a set of grades that the student would get in a new semester, after all
+ * the semesters of his sheet (like "what if I retake 234122 and get 90").
+ *
+ * The scenario is only an overlay of changes - it does not copy the sheet, and it is evaluated against the effective
+ * totals the student keeps, so evaluating it takes O(changes). a course appears in the scenario once: if it is added
+ * again, the later grade replaces the earlier one (like the last grade of a course in a semester).
+ */
+typedef struct what_if_t *WhatIf;
+
+/** Type used for returning error codes from functions */
+typedef enum WhatIfResult_t {
+    WHAT_IF_OK,
+    WHAT_IF_NULL_ARGUMENT,
+    WHAT_IF_OUT_OF_MEMORY,
+    WHAT_IF_INVALID_PARAMETER
+} WhatIfResult;
+
+/**
+ * whatIfCreate - creates a new scenario without changes
+ * @return
+ * NULL - if allocations failed.
+ * A new WhatIf in case of success.
+ */
+WhatIf whatIfCreate();
+
+/**
+ * whatIfAddChange - adds the hypothetical grade of the given course to the scenario
+ * @param scenario - the scenario to add the grade to
+ * @param course_id - the id of the course (must be positive number lower than 1000000)
+ * @param points - the points of the course (must be in the format of X or X.0 or X.5, while X is an array of digits)
+ * @param grade - the hypothetical grade (must be number between 0 and 100)
+ * @return
+ * WHAT_IF_NULL_ARGUMENT - if scenario or points is NULL
+ * WHAT_IF_INVALID_PARAMETER - if one of the parameters is not valid (the scenario is marked as not valid, so it can
+ * not be evaluated)
+ * WHAT_IF_OUT_OF_MEMORY - if there was a memory error (the scenario is not changed)
+ * WHAT_IF_OK - otherwise
+ */
+WhatIfResult whatIfAddChange(WhatIf scenario, int course_id, char* points, int grade);
+
+/**
+ * whatIfIsValid - checks if all the changes that were added to the scenario were valid
+ * @param scenario - the scenario
+ * @return false if a change with invalid parameters was added (or scenario is NULL), true otherwise
+ */
+bool whatIfIsValid(WhatIf scenario);
+
+/**
+ * whatIfGetCount - returns the number of changes in the scenario (the number of different courses)
+ * @param scenario - the scenario
+ * @return the number of changes. -1 if scenario is NULL
+ */
+int whatIfGetCount(WhatIf scenario);
+
+/**
+ * whatIfGetChange - returns the change with the given index (the changes are kept in the order their courses were
+ * first added)
+ * @param scenario - the scenario to search in
+ * @param index - the index of the change (lower than the number of changes)
+ * @param course_id - pointer to save the id of the course to
+ * @param points_x2 - pointer to save the points of the course multiple by 2 to
+ * @param grade - pointer to save the hypothetical grade to
+ * @return true if the change was returned, false if there is no change with this index (or one of the arguments is
+ * NULL)
+ */
+bool whatIfGetChange(WhatIf scenario, int index, int* course_id, int* points_x2, int* grade);
+
+/**
+ * whatIfDestroy - deallocate all the memory of the scenario
+ * @param scenario - the scenario to destroy. if scenario is NULL nothing will be done
+ */
+void whatIfDestroy(WhatIf scenario);
+
+#endif //EX3_WHAT_IF_H